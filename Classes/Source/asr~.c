@@ -2,6 +2,7 @@
 
 #include "m_pd.h"
 #include <math.h>
+#include "envbank.h"
 
 #define LOG001 log(0.001)
 
@@ -20,18 +21,58 @@ typedef struct _asr{
     int      x_log;
     int      x_nleft;
     int      x_gate_status;
+    int      x_bank;    // number of envelopes in bank mode, 0 for one
+    t_envbank x_eb;
+    t_float **x_outs;
+    t_clock  *x_clock;
 } t_asr;
 
 static t_class *asr_class;
+static t_class *asr_bank_class; // the only one with a list method
 
 static void asr_float(t_asr *x, t_floatarg f){
+    if(x->x_bank){
+        pd_error(x, "[asr~]: bank mode needs a 'voice gate' list");
+        return;
+    }
     if(f != 0 && !x->x_status) // on
         outlet_float(x->x_out2, x->x_status = 1);
     x->x_f_gate = f;
 }
 
 static void asr_log(t_asr *x, t_floatarg f){
-    x->x_log = (int)(f != 0);
+    x->x_eb.e_log = x->x_log = (int)(f != 0);
+}
+
+// bank mode: 'voice gate' or 'voice pitch velocity' from [voices]
+static void asr_list(t_asr *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    if(ac < 2){
+        pd_error(x, "[asr~]: bank mode needs a 'voice gate' list");
+        return;
+    }
+    int voice = (int)atom_getfloat(av);
+    if(envbank_gate(&x->x_eb, voice, atom_getfloat(av + ac - 1))){
+        t_atom at[2];
+        SETFLOAT(at, voice);
+        SETFLOAT(at + 1, 1);
+        outlet_list(x->x_out2, &s_list, 2, at);
+    }
+}
+
+// report the envelopes that ended and weren't triggered again
+static void asr_tick(t_asr *x){
+    t_envbank *e = &x->x_eb;
+    for(int k = 0; k < e->e_nended; k++){
+        int voice = e->e_ended[k];
+        if(e->e_slot[voice] < 0){
+            t_atom at[2];
+            SETFLOAT(at, voice);
+            SETFLOAT(at + 1, 0);
+            outlet_list(x->x_out2, &s_list, 2, at);
+        }
+    }
+    e->e_nended = 0;
 }
 
 static t_int *asr_perform(t_int *w){
@@ -119,25 +160,42 @@ static t_int *asr_perform(t_int *w){
     return (w + 7);
 }
 
+// the parameters are read once per block
+static t_int *asr_bank_perform(t_int *w){
+    t_asr *x = (t_asr *)(w[1]);
+    int nblock = (int)(w[2]);
+    envbank_params(&x->x_eb, ((t_float *)(w[3]))[0], 0, 1, ((t_float *)(w[4]))[0]);
+    envbank_perform(&x->x_eb, nblock, x->x_outs);
+    if(x->x_eb.e_nended)
+        clock_delay(x->x_clock, 0);
+    return(w + 5);
+}
+
 static void asr_dsp(t_asr *x, t_signal **sp){
     x->x_sr_khz = sp[0]->s_sr * 0.001;
+    if(x->x_bank){
+        envbank_dsp(&x->x_eb, sp[0]->s_n, sp[0]->s_sr);
+        for(int j = 0; j < x->x_bank; j++)
+            x->x_outs[j] = sp[3 + j]->s_vec;
+        dsp_add(asr_bank_perform, 4, x, sp[0]->s_n, sp[1]->s_vec, sp[2]->s_vec);
+        return;
+    }
     dsp_add(asr_perform, 6, x, sp[0]->s_n,
             sp[0]->s_vec, sp[1]->s_vec, sp[2]->s_vec, sp[3]->s_vec);
 }
 
+static void asr_free(t_asr *x){
+    if(x->x_bank){
+        envbank_free(&x->x_eb);
+        freebytes(x->x_outs, x->x_bank * sizeof(t_float *));
+        clock_free(x->x_clock);
+    }
+}
+
 static void *asr_new(t_symbol *s, int ac, t_atom *av){
-    t_asr *x = (t_asr *)pd_new(asr_class);
     t_symbol *cursym = s; // avoid warning
-    x->x_sr_khz = sys_getsr() * 0.001;
-    x->x_last = 0.;
-    x->x_target = 0.;
-    x->x_incr = 0.;
-    x->x_nleft = 0;
-    x->x_gate_status = 0;
-    x->x_log = 0;
     float a = 0, r = 0;
-    int symarg = 0;
-    int argnum = 0;
+    int argnum = 0, islog = 0, bank = 0;
     while(ac > 0){
         if(av->a_type == A_FLOAT){
             float argval = atom_getfloatarg(0, ac, av);
@@ -155,12 +213,16 @@ static void *asr_new(t_symbol *s, int ac, t_atom *av){
             ac--;
             av++;
         }
-        else if(av->a_type == A_SYMBOL && !symarg && !argnum){
-            symarg = 1;
+        else if(av->a_type == A_SYMBOL && !argnum){
             cursym = atom_getsymbolarg(0, ac, av);
             if(cursym == gensym("-log")){
                 ac--, av++;
-                x->x_log = 1;
+                islog = 1;
+            }
+            else if(cursym == gensym("-bank") && ac >= 2){
+                int n = (int)atom_getfloatarg(1, ac, av);
+                bank = n < 1 ? 1 : n;
+                ac -= 2, av += 2;
             }
             else
                 goto errstate;
@@ -168,23 +230,48 @@ static void *asr_new(t_symbol *s, int ac, t_atom *av){
         else
             goto errstate;
     }
+    // bank mode has its own class with a 'voice gate' list method
+    t_asr *x = (t_asr *)pd_new(bank ? asr_bank_class : asr_class);
+    x->x_sr_khz = sys_getsr() * 0.001;
+    x->x_last = 0.;
+    x->x_target = 0.;
+    x->x_incr = 0.;
+    x->x_nleft = 0;
+    x->x_gate_status = 0;
+    x->x_log = islog;
+    x->x_bank = bank;
     x->x_inlet_attack = inlet_new((t_object *)x, (t_pd *)x, &s_signal, &s_signal);
         pd_float((t_pd *)x->x_inlet_attack, a);
     x->x_inlet_release = inlet_new((t_object *)x, (t_pd *)x, &s_signal, &s_signal);
         pd_float((t_pd *)x->x_inlet_release, r);
-    outlet_new((t_object *)x, &s_signal);
+    if(x->x_bank){ // one outlet per envelope
+        envbank_init(&x->x_eb, x->x_bank, sys_getsr());
+        x->x_eb.e_log = x->x_log;
+        x->x_outs = (t_float **)getbytes(x->x_bank * sizeof(t_float *));
+        for(int j = 0; j < x->x_bank; j++)
+            outlet_new((t_object *)x, &s_signal);
+        x->x_clock = clock_new(x, (t_method)asr_tick);
+    }
+    else
+        outlet_new((t_object *)x, &s_signal);
     x->x_out2 = outlet_new((t_object *)x, &s_float);
     return(x);
 errstate:
-    pd_error(x, "[asr~]: improper args");
+    pd_error(NULL, "[asr~]: improper args");
     return(NULL);
 }
 
 void asr_tilde_setup(void){
-    asr_class = class_new(gensym("asr~"), (t_newmethod)asr_new, 0,
-        sizeof(t_asr), 0, A_GIMME, 0);
-    class_addmethod(asr_class, nullfn, gensym("signal"), 0);
-    class_addmethod(asr_class, (t_method) asr_dsp, gensym("dsp"), A_CANT, 0);
-    class_addfloat(asr_class, (t_method)asr_float);
-    class_addmethod(asr_class, (t_method)asr_log, gensym("log"), A_DEFFLOAT, 0);
+    asr_class = class_new(gensym("asr~"), (t_newmethod)asr_new,
+        (t_method)asr_free, sizeof(t_asr), 0, A_GIMME, 0);
+    asr_bank_class = class_new(gensym("asr~"), 0, (t_method)asr_free,
+        sizeof(t_asr), 0, 0);
+    t_class *classes[2] = {asr_class, asr_bank_class};
+    for(int i = 0; i < 2; i++){
+        class_addmethod(classes[i], nullfn, gensym("signal"), 0);
+        class_addmethod(classes[i], (t_method) asr_dsp, gensym("dsp"), A_CANT, 0);
+        class_addfloat(classes[i], (t_method)asr_float);
+        class_addmethod(classes[i], (t_method)asr_log, gensym("log"), A_DEFFLOAT, 0);
+    }
+    class_addlist(asr_bank_class, (t_method)asr_list);
 }
@@ -1,123 +1,169 @@
 #include "m_pd.h"
 
 #define COEFFS 5   // number of coeffs per filter stage
-#define MAX_COEFFS 250 // defining max number of coeffs to take
-#define STAGES 50 // number of stages = MAX_COEFFS/COEFFS
+#define MAX_CHANS 64
 
 static t_class *biquads_class;
 
 typedef struct _biquads{
     t_object  x_obj;
-    t_inlet  *x_coefflet;
-    t_outlet *x_outlet;
-    double    x_xnm1[STAGES];
-    double    x_xnm2[STAGES];
-    double    x_ynm1[STAGES];
-    double    x_ynm2[STAGES];
     t_int     x_bypass;
-    int 	  x_numfilt; // number of biquad filters
-	double 	  x_coeff[MAX_COEFFS]; // array of coeffs
-// the coeff array is an easy/cheap way of doing this
-// without malloc/calloc-ing - maybe worth changing in the future
+    int       x_numfilt; // number of biquad filters
+    int       x_size;    // allocated filters, grows with the longest list
+    int       x_nch;     // number of channels running the same cascade
+    double   *x_coeff;   // array of coeffs, COEFFS per filter
+    // transposed direct form II state, 'x_nch' values per filter
+    double   *x_s1;
+    double   *x_s2;
+    double   *x_work;    // the block of all channels, interleaved
+    int       x_nwork;
+    t_float **x_ins;
+    t_float **x_outs;
 }t_biquads;
 
-void *biquads_new(void);
-
 void biquads_clear(t_biquads *x){
-    for(int i = 0; i < x->x_numfilt; i++)
-        x->x_xnm1[i] = x->x_xnm2[i] = x->x_ynm1[i] = x->x_ynm2[i] = 0.f;
+    for(int i = 0; i < x->x_numfilt * x->x_nch; i++)
+        x->x_s1[i] = x->x_s2[i] = 0;
 }
 
 void biquads_bypass(t_biquads *x, t_floatarg f){
     x->x_bypass = f != 0;
 }
 
+static void biquads_resize(t_biquads *x, int numfilt){
+    int size = x->x_size, nch = x->x_nch;
+    x->x_coeff = (double *)resizebytes(x->x_coeff,
+        COEFFS * size * sizeof(double), COEFFS * numfilt * sizeof(double));
+    x->x_s1 = (double *)resizebytes(x->x_s1,
+        size * nch * sizeof(double), numfilt * nch * sizeof(double));
+    x->x_s2 = (double *)resizebytes(x->x_s2,
+        size * nch * sizeof(double), numfilt * nch * sizeof(double));
+    for(int i = size * nch; i < numfilt * nch; i++)
+        x->x_s1[i] = x->x_s2[i] = 0;
+    x->x_size = numfilt;
+}
+
 static void biquads_list(t_biquads *x, t_symbol *s, int argc, t_atom *argv){
     s = NULL;
-	int numfilt = (int)(argc/COEFFS); // nearest multiple - anything over is ignored
-	if(numfilt > STAGES)
-		numfilt = STAGES;
-	x->x_numfilt = numfilt;
-	int curfilt = 0; // filter counter
-	while(curfilt < numfilt){
-        int curidx = COEFFS*curfilt; // current starting index
-        t_float b1 = atom_getfloatarg(curidx, argc, argv);
-        t_float b2 = atom_getfloatarg(curidx+1, argc, argv);
-		t_float a0 = atom_getfloatarg(curidx+2, argc, argv);
-		t_float a1 = atom_getfloatarg(curidx+3, argc, argv);
-		t_float a2 = atom_getfloatarg(curidx+4, argc, argv);
-		x->x_coeff[curidx] = (double)b1;
-		x->x_coeff[curidx+1] = (double)b2;
-		x->x_coeff[curidx+2] = (double)a0;
-		x->x_coeff[curidx+3] = (double)a1;
-		x->x_coeff[curidx+4] = (double)a2;
-		curfilt++;
-	};
+    int numfilt = (int)(argc/COEFFS); // nearest multiple - anything over is ignored
+    if(numfilt > x->x_size)
+        biquads_resize(x, numfilt);
+    // stages that were not running start from silence
+    for(int i = x->x_numfilt * x->x_nch; i < numfilt * x->x_nch; i++)
+        x->x_s1[i] = x->x_s2[i] = 0;
+    x->x_numfilt = numfilt;
+    for(int i = 0; i < numfilt * COEFFS; i++)
+        x->x_coeff[i] = (double)atom_getfloatarg(i, argc, argv);
+}
+
+// one channel: each section runs over the whole block with its state in
+// registers, the block goes through the cascade one section at a time
+static void biquads_mono(t_biquads *x, double *w, int nblock){
+    for(int k = 0; k < x->x_numfilt; k++){
+        double *c = x->x_coeff + COEFFS*k;
+        double b1 = c[0], b2 = c[1], a0 = c[2], a1 = c[3], a2 = c[4];
+        double s1 = x->x_s1[k], s2 = x->x_s2[k];
+        for(int i = 0; i < nblock; i++){
+            double xn = w[i];
+            double yn = a0*xn + s1;
+            s1 = a1*xn + b1*yn + s2;
+            s2 = a2*xn + b2*yn;
+            w[i] = yn; // next stage's xn is previous yn!
+        }
+        x->x_s1[k] = s1;
+        x->x_s2[k] = s2;
+    }
+}
+
+// many channels: the same section runs on all channels of a sample at once,
+// so the inner loop over interleaved channels vectorizes
+static void biquads_multi(t_biquads *x, double *w, int nblock){
+    int nch = x->x_nch;
+    for(int k = 0; k < x->x_numfilt; k++){
+        double *c = x->x_coeff + COEFFS*k;
+        double b1 = c[0], b2 = c[1], a0 = c[2], a1 = c[3], a2 = c[4];
+        double *s1 = x->x_s1 + k*nch, *s2 = x->x_s2 + k*nch;
+        for(int i = 0; i < nblock; i++){
+            double *v = w + i*nch;
+            for(int ch = 0; ch < nch; ch++){
+                double xn = v[ch];
+                double yn = a0*xn + s1[ch];
+                s1[ch] = a1*xn + b1*yn + s2[ch];
+                s2[ch] = a2*xn + b2*yn;
+                v[ch] = yn;
+            }
+        }
+    }
 }
 
-static t_int * biquads_perform(t_int *w){
+static t_int *biquads_perform(t_int *w){
     t_biquads *x = (t_biquads *)(w[1]);
     int nblock = (int)(w[2]);
-    t_float *in = (t_float *)(w[3]);
-    t_float *out = (t_float *)(w[4]);
-    t_int bypass = x->x_bypass;
-    int numfilt = x->x_numfilt;
-    while(nblock--){
-      if(bypass)
-          *out++ = *in++;
-      else{
-          double xn = *in++;
-          int curfilt = 0; // filter section counter
-          while(curfilt < numfilt){
-              int curidx = COEFFS*curfilt; // current starting index
-              double b1 = x->x_coeff[curidx];
-              double b2 = x->x_coeff[curidx+1];
-              double a0 = x->x_coeff[curidx+2];
-              double a1 = x->x_coeff[curidx+3];
-              double a2 = x->x_coeff[curidx+4];
-              double xnm1 = x->x_xnm1[curfilt];
-              double xnm2 = x->x_xnm2[curfilt];
-              double ynm1 = x->x_ynm1[curfilt];
-              double ynm2 = x->x_ynm2[curfilt];
-              double yn = a0*xn + a1*xnm1 + a2*xnm2 + b1*ynm1 + b2*ynm2; // biquad section
-              x->x_xnm2[curfilt] = xnm1;
-              x->x_xnm1[curfilt] = xn;
-              x->x_ynm2[curfilt] = ynm1;
-              x->x_ynm1[curfilt] = yn;
-              xn = yn; // next stage's xn is previous yn!
-              curfilt++; // iterate the filter section counter
-        };
-        *out++ = xn; // xn is the cascaded output
-      };
-  };
-  return(w + 5);
+    int nch = x->x_nch;
+    double *work = x->x_work;
+    // copy all inputs first, an output may share its buffer with another input
+    for(int ch = 0; ch < nch; ch++){
+        t_float *in = x->x_ins[ch];
+        for(int i = 0; i < nblock; i++)
+            work[i*nch + ch] = in[i];
+    }
+    if(!x->x_bypass){
+        if(nch == 1)
+            biquads_mono(x, work, nblock);
+        else
+            biquads_multi(x, work, nblock);
+    }
+    for(int ch = 0; ch < nch; ch++){
+        t_float *out = x->x_outs[ch];
+        for(int i = 0; i < nblock; i++)
+            out[i] = work[i*nch + ch];
+    }
+    return(w + 3);
 }
 
 static void biquads_dsp(t_biquads *x, t_signal **sp){
-  dsp_add(biquads_perform, 4, x, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec);
+    int nch = x->x_nch, n = sp[0]->s_n;
+    if(n * nch != x->x_nwork){
+        x->x_work = (double *)resizebytes(x->x_work,
+            x->x_nwork * sizeof(double), n * nch * sizeof(double));
+        x->x_nwork = n * nch;
+    }
+    for(int ch = 0; ch < nch; ch++){
+        x->x_ins[ch] = sp[ch]->s_vec;
+        x->x_outs[ch] = sp[nch + ch]->s_vec;
+    }
+    dsp_add(biquads_perform, 2, x, n);
 }
 
-static void *biquads_free(t_biquads *x){
-	outlet_free(x->x_outlet);
-	return (void *)x;
+static void biquads_free(t_biquads *x){
+    freebytes(x->x_coeff, COEFFS * x->x_size * sizeof(double));
+    freebytes(x->x_s1, x->x_size * x->x_nch * sizeof(double));
+    freebytes(x->x_s2, x->x_size * x->x_nch * sizeof(double));
+    freebytes(x->x_work, x->x_nwork * sizeof(double));
+    freebytes(x->x_ins, x->x_nch * sizeof(t_float *));
+    freebytes(x->x_outs, x->x_nch * sizeof(t_float *));
 }
 
-void *biquads_new(void){
-  t_biquads *x = (t_biquads *)pd_new(biquads_class);
-  x->x_outlet = outlet_new(&x->x_obj, &s_signal);
-  x->x_bypass = 0;
-  x->x_numfilt = 0; // setting number of filters to 0 initially bc no coeffs
-  int i;
-  for(i = 0; i < MAX_COEFFS; i++) // zeroing out coeff array
-	x->x_coeff[i] = 0.f;
-  for(i = 0; i < STAGES; i++) // zeroing out filter's memory
-	x->x_xnm1[i] = x->x_xnm2[i] = x->x_ynm1[i] = x->x_ynm2[i] = 0.f;
-  return(x);
+static void *biquads_new(t_floatarg f){
+    t_biquads *x = (t_biquads *)pd_new(biquads_class);
+    int nch = f < 1 ? 1 : f > MAX_CHANS ? MAX_CHANS : (int)f;
+    x->x_nch = nch;
+    x->x_bypass = 0;
+    x->x_numfilt = x->x_size = 0; // no filters initially bc no coeffs
+    x->x_nwork = 0;
+    x->x_ins = (t_float **)getbytes(nch * sizeof(t_float *));
+    x->x_outs = (t_float **)getbytes(nch * sizeof(t_float *));
+    biquads_resize(x, 2);
+    for(int ch = 1; ch < nch; ch++)
+        inlet_new(&x->x_obj, &x->x_obj.ob_pd, &s_signal, &s_signal);
+    for(int ch = 0; ch < nch; ch++)
+        outlet_new(&x->x_obj, &s_signal);
+    return(x);
 }
 
 void biquads_tilde_setup(void){
     biquads_class = class_new(gensym("biquads~"), (t_newmethod)biquads_new,
-        (t_method)biquads_free, sizeof(t_biquads), CLASS_DEFAULT, 0);
+        (t_method)biquads_free, sizeof(t_biquads), CLASS_DEFAULT, A_DEFFLOAT, 0);
     class_addmethod(biquads_class, nullfn, gensym("signal"), 0);
     class_addmethod(biquads_class, (t_method) biquads_dsp, gensym("dsp"), A_CANT, 0);
     class_addmethod(biquads_class, (t_method) biquads_clear, gensym("clear"), 0);
@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <complex.h>
+#include "blep.h"
 
 #if _MSC_VER
 #define t_complex _Dcomplex
@@ -16,23 +17,12 @@
 #define t_complex complex double
 #endif
 
-// TODO: some of these aren't used
 #define LPHASOR      (8*sizeof(uint32_t)) // the phasor logsize
 #define VOICES       8 // the number of waveform voices
-#define LLENGTH      6 // the loglength of a fractional delayed basic waveform
-#define LOVERSAMPLE  6 // the log of the oversampling factor (nb of fract delayed waveforms)
-#define LPAD         1 // the log of the time padding factor (to reduce time aliasing)
-#define LTABLE       (LLENGTH+LOVERSAMPLE)
-#define N            (1<<LTABLE)
-#define M            (1<<(LTABLE+LPAD))
-#define S            (1<<LOVERSAMPLE)
-#define L            (1<<LLENGTH)
-#define CUTOFF       0.8 // fraction of nyquist for impulse cutoff
-#define NBPERIODS    ((t_float)(L) * CUTOFF / 2.0)
-
-// sample buffers
-static t_float bli[N]; // band limited impulse
-static t_float bls[N]; // band limited step
+#define LOVERSAMPLE  BLEP_LOVERSAMPLE
+#define LTABLE       BLEP_LTABLE
+#define N            BLEP_N
+#define S            BLEP_S
 
 t_class *blimp_class;
 
@@ -189,7 +179,7 @@ typedef struct blimp{
 static inline uint32_t _float_to_phase(t_float f){return ((uint32_t)(f * 4294967296.0)) & ~(S-1);}
 
 // flat table: better for linear interpolation
-static inline t_float _play_voice_lint(t_float *table, t_int *index, t_float frac, t_float scale){
+static inline t_float _play_voice_lint(const float *table, t_int *index, t_float frac, t_float scale){
     int i = *index;
     // perform linear interpolation
     t_float f = (((1.0 - frac) * table[i]) + (table[i+1] * frac)) * scale;
@@ -201,7 +191,7 @@ static inline t_float _play_voice_lint(t_float *table, t_int *index, t_float fra
 }
 
 // get one sample from the bandlimited discontinuity wavetable playback syth
-static inline t_float _get_bandlimited_discontinuity(t_blimpctl *ctl, t_float *table){
+static inline t_float _get_bandlimited_discontinuity(t_blimpctl *ctl, const float *table){
     t_float sum = 0.0;
     for(int i = 0; i < VOICES; i++) // sum  all voices
         sum += _play_voice_lint(table, ctl->c_index+i, ctl->c_frac[i], ctl->c_vscale[i]);
@@ -256,7 +246,7 @@ static t_int *blimp_perform_imp(t_int *w){
     set_butter_hp(ctl->c_butter, 0.85 * (*freq / sys_getsr()));
     while(n--){
         t_float frequency = *freq++;
-        t_float sample = _get_bandlimited_discontinuity(ctl, bli);
+        t_float sample = _get_bandlimited_discontinuity(ctl, blep_bli);
         // highpass filter output to remove DC offset and low frequency aliasing
         butter_bang_smooth(ctl->c_butter, sample, &sample, 0.05);
         *out++ = sample * 2;
@@ -274,126 +264,6 @@ static void blimp_phase2(t_blimp *x, t_float f){
     x->x_ctl.c_phase2 = _float_to_phase(f);
 }
 
-// CLASS DATA INIT (tables)
-
-// some vector ops
-
-// clear a buffer
-static inline void _clear(t_float *array, int size){
-    memset(array, 0, sizeof(t_float)*size);
-}
-
-// compute complex log
-static inline void _clog(t_float *real, t_float *imag, int size){
-    for(int k = 0; k<size; k++){
-        t_float r = real[k];
-        t_float i = imag[k];
-        t_float radius = sqrt(r*r+i*i);
-        real[k] = log(radius);
-        imag[k] = atan2(i,r);
-    }
-}
-
-// compute complex exp
-static inline void _cexp(t_float *real, t_float *imag, int size){
-    for(int k = 0; k < size; k++){
-        t_float r = exp(real[k]);
-        t_float i = imag[k];
-        real[k] = r * cos(i);
-        imag[k] = r * sin(i);
-    }
-}
-
-// compute fft
-static inline void _fft(t_float *real, t_float *imag, int size){
-    t_float scale = 1.0 / sqrt((t_float)size);
-    for(int i = 0; i<size; i++){
-        real[i] *= scale;
-        imag[i] *= scale;
-    }
-    mayer_fft(size, real, imag);
-}
-
-// compute ifft
-static inline void _ifft(t_float *real, t_float *imag, int size){
-    t_float scale = 1.0 / sqrt((t_float)size);
-    for(int i = 0; i<size; i++){
-        real[i] *= scale;
-        imag[i] *= scale;
-    }
-    mayer_ifft(size, real, imag);
-}
-
-// convert an integer index to a phase: [0 -> pi, -pi -> 0]
-static inline t_float _i2theta(int i, int size){
-    t_float p = 2.0 * M_PI * (t_float)i / (t_float)size;
-    if(p >= M_PI) p -= 2.0 * M_PI;
-    return p;
-}
-
-// store waveform as one chunk
-static void _store(t_float *dst, t_float *src, t_float scale, int size){
-    for(int i = 0; i<size; i++)
-        dst[i] = scale * src[i];
-}
-
-// create a minimum phase bandlimited impulse
-static void build_tables(void){
-    // table size = M>=N (time padding to reduce time aliasing)
-    // we work in the complex domain to eliminate the need to avoid
-    // negative spectral components
-    t_float real[M];
-    t_float imag[M];
-    t_float sum,scale;
-    int i;
-    // create windowed sinc
-    _clear(imag, M);
-    real[0] = 1.0;
-    for(i = 1; i<M; i++){
-        t_float tw = _i2theta(i,M);
-        t_float ts = tw * NBPERIODS * (t_float)(M) / (t_float)(N);
-        // sinc
-        real[i] = sin(ts)/ts;
-        // blackman window
-        real[i] *= 0.42 + 0.5 * (cos(tw)) + 0.08 * (cos(2.0*tw));
-    }
-    // compute cepstrum
-    _fft(real, imag, M);
-    _clog(real, imag, M);
-    _ifft(real, imag, M);
-    // kill anti-causal part (contribution of non minimum phase zeros)
-    // should we kill nyquist too ??
-    for(i = M/2 + 1; i < M; i++){
-        real[i] *= 0.0000;
-        imag[i] *= 0.0000;
-    }
-    // compute inverse cepstrum
-    _fft(real, imag, M);
-    _cexp(real, imag, M);
-    _ifft(real, imag, M);
-    // from here on, discard the padded part [N->M-1]
-    // and work with the first N samples
-    
-    // normalize impulse (integral = 1)
-    sum = 0.0;
-    for(i = 0; i < N; i++)
-        sum += real[i];
-    scale = 1.0 / sum;
-    for(i = 0; i < N; i++)
-        real[i] *= scale;
-    // store bli table
-    _store(bli, real, (t_float)S, N);
-    // _printm(bli, "h", N);
-    // integrate impulse and invert to produce a step function from 1->0 
-    sum = 0.0;
-    for(i = 0; i < N; i++){
-        sum += real[i];
-        real[i] = (1.0 - sum);
-    }
-    // store decimated bls tables
-    _store(bls, real, 1.0, N);
-}
-
 static void blimp_dsp(t_blimp *x, t_signal **sp){
     x->x_ctl.c_phase_inc_scale = 4.0 * ((t_float)(1<<(LPHASOR-2))) / sys_getsr();
     dsp_add(blimp_perform_imp, 4, &x->x_ctl, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec);
@@ -421,7 +291,6 @@ static void *blimp_new(t_symbol *s){
 }
 
 void setup_bl0x2eimp_tilde(void){
-    build_tables();
     blimp_class = class_new(gensym("bl.imp~"), (t_newmethod)blimp_new,
         0, sizeof(t_blimp), 0, A_DEFSYMBOL, A_NULL);
     CLASS_MAINSIGNALIN(blimp_class, t_blimp, x_f);
@@ -6,24 +6,13 @@
 // Valimaki. http://www.acoustics.hut.fi/publications/papers/smc2010-phaseshaping/
 
 #include "m_pd.h"
-#include <math.h>
-#include <stdint.h>
-
-#define PI     3.1415926535897931
-#define TWO_PI 6.2831853071795862
-
-typedef struct _polyblep{
-    t_float pulse_width;    // Pulse width for square, morph-to-saw for triangle
-    t_float phase;          // The current phase of the oscillator.
-    t_float freq_in_seconds_per_sample;
-    t_float sr;
-    t_float last_phase_offset;
-}t_polyblep;
+#include "polyblep.h"
 
 typedef struct blvsaw{
     t_object x_obj;
     t_float x_f;
     t_polyblep x_polyblep;
+    t_polyblep_buf x_buf;
     t_inlet* x_inlet_sync;
     t_inlet* x_inlet_phase;
     t_inlet* x_inlet_width;
@@ -31,92 +20,22 @@ typedef struct blvsaw{
 
 t_class *bl_vsaw;
 
-static t_float phasewrap(t_float phase){
-    while (phase < 0.0)
-        phase += 1.0;
-    while(phase >= 1.0)
-        phase -= 1.0;
-    return(phase);
-}
-
-static t_float square(t_float x){
-    return(x * x);
-}
-
-static t_float blamp(t_float phase, t_float dt){
-    if(phase < dt){
-        phase = phase / dt - 1.0;
-        return(-1.0 / 3.0 * square(phase) * phase);
-    }
-    else if(phase > 1.0 - dt){
-        phase = (phase - 1.0) / dt + 1.0;
-        return(1.0 / 3.0 * square(phase) * phase);
-    }
-    else
-        return(0.0);
-}
-
-static t_float vsaw(const t_polyblep* x){
-    t_float pulse_width = fmax(0.0001, fmin(0.9999, x->pulse_width));
-    t_float t1 = x->phase + 0.5 * pulse_width;
-    t1 = phasewrap(t1);
-    t_float t2 = x->phase + 1 - 0.5 * pulse_width;
-    t2 = phasewrap(t2);
-    t_float y = x->phase * 2;
-    if(y >= 2 - pulse_width)
-        y = (y - 2) / pulse_width;
-    else if(y >= pulse_width)
-        y = 1 - (y - pulse_width) / (1 - pulse_width);
-    else
-        y /= pulse_width;
-    y += x->freq_in_seconds_per_sample / (pulse_width - pulse_width * pulse_width)
-        * (blamp(t1, x->freq_in_seconds_per_sample) - blamp(t2, x->freq_in_seconds_per_sample));
-    return(y);
-}
-
-static t_int* blvsaw_perform(t_int *w) {
-    t_polyblep* x      = (t_polyblep*)(w[1]);
-    t_int n            = (t_int)(w[2]);
-    t_float* freq_vec  = (t_float *)(w[3]);
-    t_float* width_vec = (t_float *)(w[4]);
-    t_float* sync_vec  = (t_float *)(w[5]);
-    t_float* phase_vec = (t_float *)(w[6]);
-    t_float* out       = (t_float *)(w[7]);
-    while(n--){
-        t_float freq = *freq_vec++;
-        t_float sync = *sync_vec++;
-        t_float phase_offset = *phase_vec++;
-        t_float pulse_width = *width_vec++;
-        x->freq_in_seconds_per_sample = freq / x->sr; // Update frequency
-        // Update pulse width, limit between 0 and 1
-        x->pulse_width = fmax(fmin(0.9999, pulse_width), 0.0001);
-        t_float y;
-        if(sync > 0 && sync <= 1){ // Phase sync
-            x->phase = sync;
-            x->phase = phasewrap(x->phase);
-        }
-        else{ // Phase modulation
-            double phase_dev = phase_offset - x->last_phase_offset;
-            if(phase_dev >= 1 || phase_dev <= -1)
-                phase_dev = fmod(phase_dev, 1);
-            x->phase = phasewrap(x->phase + phase_dev);
-        }
-        y = vsaw(x);
-        x->phase += x->freq_in_seconds_per_sample;
-        x->phase = phasewrap(x->phase);
-        x->last_phase_offset = phase_offset;
-        *out++ = y;  // Send to output
-    }
+static t_int* blvsaw_perform(t_int *w){
+    t_blvsaw* x = (t_blvsaw*)(w[1]);
+    polyblep_perform(&x->x_polyblep, &x->x_buf, (int)(w[2]), (t_float *)(w[3]),
+        (t_float *)(w[4]), (t_float *)(w[5]), (t_float *)(w[6]), (t_float *)(w[7]));
     return(w+8);
 }
 
 static void blvsaw_dsp(t_blvsaw *x, t_signal **sp){
     x->x_polyblep.sr = sp[0]->s_sr;
-    dsp_add(blvsaw_perform, 7, &x->x_polyblep, sp[0]->s_n, sp[0]->s_vec,
+    polyblep_buf_resize(&x->x_buf, sp[0]->s_n);
+    dsp_add(blvsaw_perform, 7, x, sp[0]->s_n, sp[0]->s_vec,
         sp[1]->s_vec, sp[2]->s_vec, sp[3]->s_vec, sp[4]->s_vec);
  }
 
 static void blvsaw_free(t_blvsaw *x){
+    polyblep_buf_free(&x->x_buf);
     inlet_free(x->x_inlet_sync);
     inlet_free(x->x_inlet_phase);
     inlet_free(x->x_inlet_width);
@@ -125,9 +44,8 @@ static void blvsaw_free(t_blvsaw *x){
 static void* blvsaw_new(t_symbol *s, int ac, t_atom *av){
     s = NULL;
     t_blvsaw* x = (t_blvsaw *)pd_new(bl_vsaw);
-    x->x_polyblep.pulse_width = 0;
-    x->x_polyblep.freq_in_seconds_per_sample = 0;
-    x->x_polyblep.phase = 0.0;
+    polyblep_init(&x->x_polyblep, POLYBLEP_VSAW, 0);
+    polyblep_buf_init(&x->x_buf);
     t_float init_freq = 0, init_phase = 0;
     if(ac && av->a_type == A_FLOAT){
         init_freq = av->a_w.w_float;
@@ -0,0 +1,179 @@
+// compressor, runs on the dynamics core (shared/dynamics.c)
+
+#include "m_pd.h"
+#include "dynamics.h"
+
+#define MAX_CHANS 64
+#define REPORT_PERIOD 1024 // samples between gain reduction reports
+
+typedef struct _compress{
+    t_object    x_obj;
+    t_dynamics  x_dyn;
+    int         x_count;
+    t_clock    *x_clock;
+    t_outlet   *x_out_gr;
+    t_float   **x_ins;
+    t_float   **x_outs;
+}t_compress;
+
+static t_class *compress_class;
+
+static void compress_tick(t_compress *x){
+    outlet_float(x->x_out_gr, dyn_reduction(&x->x_dyn));
+}
+
+static void compress_thresh(t_compress *x, t_floatarg f){
+    x->x_dyn.d_thresh = f;
+}
+
+static void compress_ratio(t_compress *x, t_floatarg f){
+    x->x_dyn.d_ratio = f;
+    dyn_update(&x->x_dyn);
+}
+
+static void compress_attack(t_compress *x, t_floatarg f){
+    x->x_dyn.d_attack = f;
+    dyn_update(&x->x_dyn);
+}
+
+static void compress_release(t_compress *x, t_floatarg f){
+    x->x_dyn.d_release = f;
+    dyn_update(&x->x_dyn);
+}
+
+static void compress_gain(t_compress *x, t_floatarg f){
+    dyn_makeup(&x->x_dyn, f);
+}
+
+static void compress_size(t_compress *x, t_floatarg f){
+    x->x_dyn.d_window = f < 1 ? 1 : f > 512 ? 512 : f;
+    dyn_update(&x->x_dyn);
+}
+
+static void compress_peak(t_compress *x, t_floatarg f){
+    x->x_dyn.d_peak = f != 0;
+}
+
+static void compress_link(t_compress *x, t_floatarg f){
+    x->x_dyn.d_link = f != 0;
+}
+
+static void compress_lookahead(t_compress *x, t_floatarg f){
+    dyn_lookahead(&x->x_dyn, f);
+}
+
+static void compress_clear(t_compress *x){
+    dyn_clear(&x->x_dyn);
+}
+
+static t_int *compress_perform(t_int *w){
+    t_compress *x = (t_compress *)(w[1]);
+    int n = (int)(w[2]);
+    dyn_perform(&x->x_dyn, n, x->x_ins, NULL, x->x_outs);
+    if((x->x_count += n) >= REPORT_PERIOD){
+        x->x_count = 0;
+        clock_delay(x->x_clock, 0);
+    }
+    return(w + 3);
+}
+
+static void compress_dsp(t_compress *x, t_signal **sp){
+    int nch = x->x_dyn.d_nch, n = sp[0]->s_n;
+    if(sp[0]->s_sr != x->x_dyn.d_sr){
+        x->x_dyn.d_sr = sp[0]->s_sr;
+        dyn_update(&x->x_dyn);
+        dyn_lookahead(&x->x_dyn, x->x_dyn.d_lookahead);
+    }
+    dyn_block(&x->x_dyn, n);
+    for(int ch = 0; ch < nch; ch++){
+        x->x_ins[ch] = sp[ch]->s_vec;
+        x->x_outs[ch] = sp[nch + ch]->s_vec;
+    }
+    dsp_add(compress_perform, 2, x, n);
+}
+
+static void compress_free(t_compress *x){
+    int nch = x->x_dyn.d_nch;
+    clock_free(x->x_clock);
+    freebytes(x->x_ins, nch * sizeof(t_float *));
+    freebytes(x->x_outs, nch * sizeof(t_float *));
+    dyn_free(&x->x_dyn);
+}
+
+static void *compress_new(t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    t_compress *x = (t_compress *)pd_new(compress_class);
+    int nch = 1, peak = 0, link = 1;
+    t_float lookahead = 0, size = 512;
+    while(ac && av->a_type == A_SYMBOL){
+        t_symbol *flag = atom_getsymbol(av);
+        if(flag == gensym("-ch") && ac >= 2){
+            int n = (int)atom_getfloat(av + 1);
+            nch = n < 1 ? 1 : n > MAX_CHANS ? MAX_CHANS : n;
+            ac -= 2, av += 2;
+        }
+        else if(flag == gensym("-size") && ac >= 2){ // as in the old abstraction
+            size = atom_getfloat(av + 1);
+            ac -= 2, av += 2;
+        }
+        else if(flag == gensym("-lookahead") && ac >= 2){
+            lookahead = atom_getfloat(av + 1);
+            ac -= 2, av += 2;
+        }
+        else if(flag == gensym("-peak")){
+            peak = 1;
+            ac--, av++;
+        }
+        else if(flag == gensym("-unlink")){
+            link = 0;
+            ac--, av++;
+        }
+        else{
+            pd_error(x, "[compress~]: unknown flag '%s' ignored", flag->s_name);
+            ac--, av++;
+        }
+    }
+    t_dynamics *d = &x->x_dyn;
+    dyn_init(d, DYN_COMPRESS, nch, 0, sys_getsr());
+    d->d_peak = peak, d->d_link = link;
+    // thresh ratio attack release gain size
+    d->d_thresh = atom_getfloatarg(0, ac, av);
+    d->d_ratio = atom_getfloatarg(1, ac, av);
+    d->d_attack = atom_getfloatarg(2, ac, av);
+    d->d_release = atom_getfloatarg(3, ac, av);
+    if(ac < 1)
+        d->d_thresh = -10;
+    if(ac < 3)
+        d->d_attack = 10;
+    if(ac < 4)
+        d->d_release = 10;
+    dyn_makeup(d, atom_getfloatarg(4, ac, av));
+    compress_size(x, ac > 5 ? atom_getfloatarg(5, ac, av) : size);
+    dyn_lookahead(d, lookahead);
+    x->x_clock = clock_new(x, (t_method)compress_tick);
+    x->x_ins = (t_float **)getbytes(nch * sizeof(t_float *));
+    x->x_outs = (t_float **)getbytes(nch * sizeof(t_float *));
+    for(int ch = 1; ch < nch; ch++)
+        inlet_new(&x->x_obj, &x->x_obj.ob_pd, &s_signal, &s_signal);
+    for(int ch = 0; ch < nch; ch++)
+        outlet_new(&x->x_obj, &s_signal);
+    x->x_out_gr = outlet_new(&x->x_obj, &s_float);
+    return(x);
+}
+
+void compress_tilde_setup(void){
+    compress_class = class_new(gensym("compress~"), (t_newmethod)compress_new,
+        (t_method)compress_free, sizeof(t_compress), CLASS_DEFAULT, A_GIMME, 0);
+    class_addmethod(compress_class, nullfn, gensym("signal"), 0);
+    class_addmethod(compress_class, (t_method)compress_dsp, gensym("dsp"), A_CANT, 0);
+    class_addmethod(compress_class, (t_method)compress_thresh, gensym("thresh"), A_FLOAT, 0);
+    class_addmethod(compress_class, (t_method)compress_ratio, gensym("ratio"), A_FLOAT, 0);
+    class_addmethod(compress_class, (t_method)compress_attack, gensym("attack"), A_FLOAT, 0);
+    class_addmethod(compress_class, (t_method)compress_release, gensym("release"), A_FLOAT, 0);
+    class_addmethod(compress_class, (t_method)compress_gain, gensym("gain"), A_FLOAT, 0);
+    class_addmethod(compress_class, (t_method)compress_size, gensym("size"), A_FLOAT, 0);
+    class_addmethod(compress_class, (t_method)compress_peak, gensym("peak"), A_FLOAT, 0);
+    class_addmethod(compress_class, (t_method)compress_link, gensym("link"), A_FLOAT, 0);
+    class_addmethod(compress_class, (t_method)compress_lookahead, gensym("lookahead"), A_FLOAT, 0);
+    class_addmethod(compress_class, (t_method)compress_clear, gensym("clear"), 0);
+}
@@ -0,0 +1,161 @@
+// N band Linkwitz-Riley crossover network, the 4th order relative of [crossover~]
+
+#include "m_pd.h"
+#include "svf.h"
+
+#define SQRT2 1.41421356237309504880 // butterworth damping
+#define MAX_BANDS 64
+
+typedef struct _crossover_lr_op{ // one filter of the network
+    int         o_filter;   // index in the svf arrays
+    int         o_freq;     // the crossover frequency it follows
+    t_svf_out   o_type;
+    int         o_in;       // band buffers
+    int         o_out2;     // highpass buffer of a split
+}t_crossover_lr_op;
+
+typedef struct _crossover_lr{
+    t_object            x_obj;
+    int                 x_nbands;
+    t_float            *x_freq;     // nbands-1 crossover frequencies, ascending
+    t_svf               x_svf;
+    t_crossover_lr_op  *x_ops;
+    int                 x_nops;
+    double             *x_buf;      // one block for each band
+    int                 x_nblock;
+    t_float           **x_outs;
+}t_crossover_lr;
+
+static t_class *crossover_lr_class;
+
+// Split bands 'lo' to 'hi' (their signal is in buffer 'lo') in the middle
+// with a 4th order Linkwitz-Riley pair: a butterworth section that gives both
+// lowpass and highpass, followed by another lowpass and highpass section.
+// Each half then goes through the allpasses of the other half's crossovers
+// before it's split further, so every band gets the same phase response.
+// Compensating whole halves shares those allpasses between their bands
+// (a chain of splits would need one set per band).
+static void crossover_lr_build(t_crossover_lr *x, int lo, int hi){
+    if(lo == hi)
+        return;
+    int mid = (lo + hi) / 2; // f[mid] divides bands 'mid' and 'mid+1'
+    t_crossover_lr_op *op = x->x_ops + x->x_nops;
+    op[0] = (t_crossover_lr_op){x->x_nops, mid, SVF_SPLIT, lo, mid+1};
+    op[1] = (t_crossover_lr_op){x->x_nops+1, mid, SVF_LOWPASS, lo, 0};
+    op[2] = (t_crossover_lr_op){x->x_nops+2, mid, SVF_HIGHPASS, mid+1, 0};
+    x->x_nops += 3;
+    for(int k = mid+1; k < hi; k++, x->x_nops++) // lower half: upper crossovers
+        x->x_ops[x->x_nops] = (t_crossover_lr_op){x->x_nops, k, SVF_ALLPASS, lo, 0};
+    for(int k = lo; k < mid; k++, x->x_nops++) // upper half: lower crossovers
+        x->x_ops[x->x_nops] = (t_crossover_lr_op){x->x_nops, k, SVF_ALLPASS, mid+1, 0};
+    crossover_lr_build(x, lo, mid);
+    crossover_lr_build(x, mid+1, hi);
+}
+
+static int crossover_lr_count(int lo, int hi){
+    if(lo == hi)
+        return(0);
+    int mid = (lo + hi) / 2;
+    return(3 + (hi-lo-1) + crossover_lr_count(lo, mid) + crossover_lr_count(mid+1, hi));
+}
+
+static void crossover_lr_update(t_crossover_lr *x, int jump){
+    for(int i = 0; i < x->x_nops; i++){
+        t_crossover_lr_op *op = &x->x_ops[i];
+        svf_set(&x->x_svf, op->o_filter, x->x_freq[op->o_freq], SQRT2, jump);
+    }
+}
+
+// new frequencies glide over the next block
+static void crossover_lr_freq(t_crossover_lr *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    int n = x->x_nbands - 1;
+    for(int i = 0; i < ac && i < n; i++)
+        x->x_freq[i] = atom_getfloat(av + i);
+    for(int i = 1; i < n; i++){ // keep them sorted
+        t_float f = x->x_freq[i];
+        int j = i;
+        for(; j > 0 && x->x_freq[j-1] > f; j--)
+            x->x_freq[j] = x->x_freq[j-1];
+        x->x_freq[j] = f;
+    }
+    crossover_lr_update(x, 0);
+}
+
+static void crossover_lr_clear(t_crossover_lr *x){
+    svf_clear(&x->x_svf);
+}
+
+static t_int *crossover_lr_perform(t_int *w){
+    t_crossover_lr *x = (t_crossover_lr *)(w[1]);
+    int n = (int)(w[2]);
+    t_float *in = (t_float *)(w[3]);
+    double *buf = x->x_buf;
+    for(int i = 0; i < n; i++) // the whole network starts in the first band
+        buf[i] = in[i];
+    for(int i = 0; i < x->x_nops; i++){
+        t_crossover_lr_op *op = &x->x_ops[i];
+        double *b = buf + op->o_in * n;
+        svf_run(&x->x_svf, op->o_filter, n, b, b, buf + op->o_out2 * n, op->o_type);
+    }
+    for(int j = 0; j < x->x_nbands; j++){
+        t_float *out = x->x_outs[j];
+        double *b = buf + j * n;
+        for(int i = 0; i < n; i++)
+            out[i] = b[i];
+    }
+    return(w + 4);
+}
+
+static void crossover_lr_dsp(t_crossover_lr *x, t_signal **sp){
+    int n = sp[0]->s_n, nb = x->x_nbands;
+    if(n != x->x_nblock){
+        x->x_buf = (double *)resizebytes(x->x_buf,
+            x->x_nblock * nb * sizeof(double), n * nb * sizeof(double));
+        x->x_nblock = n;
+    }
+    if(sp[0]->s_sr != x->x_svf.s_sr){
+        x->x_svf.s_sr = sp[0]->s_sr;
+        crossover_lr_update(x, 1);
+    }
+    for(int j = 0; j < nb; j++)
+        x->x_outs[j] = sp[1 + j]->s_vec;
+    dsp_add(crossover_lr_perform, 3, x, n, sp[0]->s_vec);
+}
+
+static void crossover_lr_free(t_crossover_lr *x){
+    int nb = x->x_nbands;
+    freebytes(x->x_freq, (nb - 1) * sizeof(t_float));
+    freebytes(x->x_ops, x->x_nops * sizeof(t_crossover_lr_op));
+    freebytes(x->x_buf, x->x_nblock * nb * sizeof(double));
+    freebytes(x->x_outs, nb * sizeof(t_float *));
+    svf_free(&x->x_svf);
+}
+
+static void *crossover_lr_new(t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    t_crossover_lr *x = (t_crossover_lr *)pd_new(crossover_lr_class);
+    int nf = ac < 1 ? 1 : ac > MAX_BANDS - 1 ? MAX_BANDS - 1 : ac;
+    int nb = x->x_nbands = nf + 1;
+    x->x_freq = (t_float *)getbytes(nf * sizeof(t_float));
+    x->x_freq[0] = 1000;
+    x->x_ops = (t_crossover_lr_op *)getbytes(crossover_lr_count(0, nb-1) * sizeof(t_crossover_lr_op));
+    x->x_nops = 0;
+    crossover_lr_build(x, 0, nb-1);
+    svf_init(&x->x_svf, x->x_nops, sys_getsr());
+    crossover_lr_freq(x, NULL, ac, av);
+    crossover_lr_update(x, 1);
+    x->x_outs = (t_float **)getbytes(nb * sizeof(t_float *));
+    for(int j = 0; j < nb; j++)
+        outlet_new(&x->x_obj, &s_signal);
+    return(x);
+}
+
+void setup_crossover0x2elr_tilde(void){
+    crossover_lr_class = class_new(gensym("crossover.lr~"), (t_newmethod)crossover_lr_new,
+        (t_method)crossover_lr_free, sizeof(t_crossover_lr), CLASS_DEFAULT, A_GIMME, 0);
+    class_addmethod(crossover_lr_class, nullfn, gensym("signal"), 0);
+    class_addmethod(crossover_lr_class, (t_method)crossover_lr_dsp, gensym("dsp"), A_CANT, 0);
+    class_addmethod(crossover_lr_class, (t_method)crossover_lr_freq, gensym("freq"), A_GIMME, 0);
+    class_addmethod(crossover_lr_class, (t_method)crossover_lr_clear, gensym("clear"), 0);
+}
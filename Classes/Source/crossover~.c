@@ -15,6 +15,8 @@ typedef struct _crossover{
     t_outlet   *x_out2;
     t_float     x_nyq;
     t_float     x_last_f;
+    t_float     x_coef_f;   // frequency of the coefficients below
+    t_float     x_c1, x_c2, x_c3, x_lg1, x_lg2, x_hg1, x_hg2;
     t_float     x_lo1_x1;
     t_float     x_lo1_y1;
     t_float     x_lo2_x1;
@@ -31,6 +33,23 @@ typedef struct _crossover{
 
 static t_class *crossover_class;
 
+// only when the frequency changes, not at every sample
+static void crossover_coeffs(t_crossover *x, t_float f){
+    float r = tanf((f/x->x_nyq) * (PI/2));
+    // poles:
+    float c1 = (1 - r*r) / (1 + r*r + 2*r);
+    float re = (1 - r*r) / (1 + r*r + r*TWO_COS_PHI);
+    float im = r*TWO_SIN_PHI / (1 + r*r + r*TWO_COS_PHI);
+    x->x_c1 = c1;
+    x->x_c2 = 2*re;
+    x->x_c3 = -pow(hypotf(re, im), 2);
+    x->x_lg1 = fabsf(1 - c1) * 0.5; // gains
+    x->x_lg2 = (pow(re-1, 2) + pow(im, 2)) * 0.25;
+    x->x_hg1 = (c1 + 1) * 0.5;
+    x->x_hg2 = (pow(re+1, 2) + pow(im, 2)) * 0.25;
+    x->x_coef_f = f;
+}
+
 void crossover_clear(t_crossover *x){
     x->x_lo1_x1 = x->x_lo2_x1 = x->x_lo2_x2 =
     x->x_lo1_y1 = x->x_lo2_y1 = x->x_lo2_y2 = 0.;
@@ -62,21 +81,17 @@ static t_int *crossover_perform(t_int *w){
         lo1_xn = hi1_xn = *in1++;
         if (f < 1) f = last_f;
         if (f > nyq) f = nyq;
-        float r = tanf((f/nyq) * (PI/2));
         last_f = f;
-        // poles:
-        float c1 = (1 - r*r) / (1 + r*r + 2*r);
-        float re = (1 - r*r) / (1 + r*r + r*TWO_COS_PHI);
-        float im = r*TWO_SIN_PHI / (1 + r*r + r*TWO_COS_PHI);
-        float c2 = 2*re;
-        float c3 = -pow(hypotf(re, im), 2);
+        if(f != x->x_coef_f)
+            crossover_coeffs(x, f);
+        float c1 = x->x_c1, c2 = x->x_c2, c3 = x->x_c3;
         
         // start of lowpass:
-        float lg1 = fabsf(1 - c1) * 0.5; // gain
+        float lg1 = x->x_lg1;
         lo2_xn = lo1_yn = lg1*lo1_xn + lg1*lo1_x1 + c1*lo1_y1; // 1sr order section
         lo1_x1 = lo1_xn;
         lo1_y1 = lo1_yn;
-        float lg2 = (pow(re-1, 2) + pow(im, 2)) * 0.25; // gain
+        float lg2 = x->x_lg2;
         lo2_yn = lg2*lo2_xn + 2*lg2*lo2_x1 + lg2*lo2_x2 + c2*lo2_y1 + c3*lo2_y2; // 2nd order section
         lo2_x2 = lo2_x1;
         lo2_x1 = lo2_xn;
@@ -85,11 +100,11 @@ static t_int *crossover_perform(t_int *w){
         *out1++ = lo2_yn; // LOWPASS OUTPUT
         
         // start of highpass:
-        float hg1 = (c1 + 1) * 0.5; // gain
+        float hg1 = x->x_hg1;
         hi2_xn = hi1_yn = hg1*lo1_xn + hg1*lo1_x1 + c1*lo1_y1; // 1sr order section
         hi1_x1 = hi1_xn;
         hi1_y1 = hi1_yn;
-        float hg2 = (pow(re+1, 2) + pow(im, 2)) * 0.25; // gain
+        float hg2 = x->x_hg2;
         hi2_yn = hg2*hi2_xn - 2*hg2*hi2_x1 + hg2*hi2_x2 + c2*hi2_y1 + c3*hi2_y2; // 2nd order section
         hi2_x2 = hi2_x1;
         hi2_x1 = hi2_xn;
@@ -116,6 +131,7 @@ static t_int *crossover_perform(t_int *w){
 
 static void crossover_dsp(t_crossover *x, t_signal **sp){
     x->x_nyq = sp[0]->s_sr / 2;
+    x->x_coef_f = 0; // recompute for this sample rate
     dsp_add(crossover_perform, 6, x, sp[0]->s_n, sp[0]->s_vec,
             sp[1]->s_vec, sp[2]->s_vec, sp[3]->s_vec);
 }
@@ -3,11 +3,13 @@
 #include <math.h>
 #include "m_pd.h"
 #include <string.h>
+#include "oversample.h"
 
 typedef struct _drive{
     t_object  x_obj;
     t_inlet  *x_inlet;
     t_int     x_mode;
+    t_oversample x_os;
 }t_drive;
 
 static t_class *drive_class;
@@ -16,52 +18,76 @@ static void drive_mode(t_drive *x, t_floatarg f){
     x->x_mode = f < 0 ? 0 : f > 2 ? 2 : (int)f;
 }
 
+static void drive_oversample(t_drive *x, t_floatarg f){
+    if(!oversample_factor(&x->x_os, (int)f))
+        pd_error(x, "[drive~]: oversampling is 1, 2, 4 or 8");
+}
+
+static inline float drive_kernel(t_float mode, float in, float f2){
+    if(f2 < 0)
+        f2 = 0;
+    if(mode == 0)
+        return(tanhf(in * f2));
+    else if(mode == 1){
+        if(in >= 1.)
+            return(1.);
+        else if(in <= -1)
+            return(-1.);
+        else if(f2 < 1)
+            return(f2 * in);
+        else if(in > 0)
+            return(1. - powf(1. - in, f2));
+        else
+            return(powf(1. + in, f2) - 1.);
+    }
+    else{
+        if(f2 > 1)
+            f2 = 1;
+        t_float abs_in = fabs(in);
+        return(abs_in > f2 ? copysignf((1-(f2*(f2-2)+1) / (abs_in-2*f2+1)), in) : in);
+    }
+}
+
+// 'n' samples at 2^shift times the rate of the drive input
+static void drive_run(t_drive *x, int n, t_float *in1, t_float *in2, t_float *out, int shift){
+    t_float mode = x->x_mode;
+    for(int i = 0; i < n; i++)
+        out[i] = drive_kernel(mode, in1[i], in2[i >> shift]);
+}
+
 static t_int *drive_perform(t_int *w){
     t_drive *x = (t_drive *)(w[1]);
     int n = (t_int)(w[2]);
     t_float *in1 = (t_float *)(w[3]);
     t_float *in2 = (t_float *)(w[4]);
     t_float *out = (t_float *)(w[5]);
-    t_float mode = x->x_mode;
-    while(n--){
-        float in = *in1++;
-        float f2 = *in2++;
-        if(f2 < 0)
-            f2 = 0;
-        if(mode == 0)
-            *out++ = tanhf(in * f2);
-        else if(mode == 1){
-            if(in >= 1.)
-                *out++ = 1.;
-            else if(in <= -1)
-                *out++ = -1.;
-            else if(f2 < 1)
-                *out++ = f2 * in;
-            else if(in > 0)
-                *out++ = 1. - powf(1. - in, f2);
-            else
-                *out++ = powf(1. + in, f2) - 1.;
-        }
-        else{
-            if(f2 > 1)
-                f2 = 1;
-            t_float abs_in = fabs(in);
-            *out++ = abs_in > f2 ? copysignf((1-(f2*(f2-2)+1) / (abs_in-2*f2+1)), in) : in;
-        }
+    t_oversample *os = &x->x_os;
+    if(os->o_factor == 1)
+        drive_run(x, n, in1, in2, out, 0);
+    else{
+        t_float *buf = oversample_up(os, in1);
+        drive_run(x, n << os->o_shift, buf, in2, buf, os->o_shift);
+        oversample_down(os, out);
     }
     return(w+6);
 }
 
 static void drive_dsp(t_drive *x, t_signal **sp){
+    oversample_dsp(&x->x_os, sp[0]->s_n);
     dsp_add(drive_perform, 5, x, sp[0]->s_n,
             sp[0]->s_vec, sp[1]->s_vec, sp[2]->s_vec);
 }
 
+static void drive_free(t_drive *x){
+    oversample_free(&x->x_os);
+}
+
 void *drive_new(t_symbol *s, int ac, t_atom *av){
     s = NULL;
     t_drive *x = (t_drive *)pd_new(drive_class);
     t_float drive = 1;
     x->x_mode = 0;
+    oversample_init(&x->x_os, 1);
     int arg = 0;
     while(ac > 0){
         if(av->a_type == A_FLOAT){
@@ -80,6 +106,15 @@ void *drive_new(t_symbol *s, int ac, t_atom *av){
                 else
                     goto errstate;
             }
+            else if(atom_getsymbolarg(0, ac, av) == gensym("-oversample")){
+                ac--, av++;
+                if(av->a_type == A_FLOAT){
+                    drive_oversample(x, atom_getfloatarg(0, ac, av));
+                    ac--, av++;
+                }
+                else
+                    goto errstate;
+            }
             else
                 goto errstate;
         }
@@ -96,9 +131,10 @@ errstate:
 }
 
 void drive_tilde_setup(void){
-    drive_class = class_new(gensym("drive~"), (t_newmethod)drive_new, 0,
-            sizeof(t_drive), CLASS_DEFAULT, A_GIMME, 0);
+    drive_class = class_new(gensym("drive~"), (t_newmethod)drive_new,
+            (t_method)drive_free, sizeof(t_drive), CLASS_DEFAULT, A_GIMME, 0);
     class_addmethod(drive_class, nullfn, gensym("signal"), 0);
     class_addmethod(drive_class, (t_method) drive_dsp, gensym("dsp"), A_CANT, 0);
     class_addmethod(drive_class, (t_method)drive_mode, gensym("mode"), A_DEFFLOAT, 0);
+    class_addmethod(drive_class, (t_method)drive_oversample, gensym("oversample"), A_FLOAT, 0);
 }
@@ -0,0 +1,172 @@
+// ducker, runs on the dynamics core (shared/dynamics.c) with the control
+// signal as sidechain
+
+#include "m_pd.h"
+#include "dynamics.h"
+
+#define MAX_CHANS 64
+#define REPORT_PERIOD 1024 // samples between gain reduction reports
+
+typedef struct _duck{
+    t_object    x_obj;
+    t_dynamics  x_dyn;
+    int         x_mix;      // adds the control signal to the output
+    int         x_count;
+    t_clock    *x_clock;
+    t_outlet   *x_out_gr;
+    t_float   **x_ins;
+    t_float   **x_outs;
+    t_float    *x_control;
+    t_float    *x_side;     // copy of the control block for mixing
+    int         x_nblock;
+}t_duck;
+
+static t_class *duck_class;
+
+static void duck_tick(t_duck *x){
+    outlet_float(x->x_out_gr, dyn_reduction(&x->x_dyn));
+}
+
+static void duck_thresh(t_duck *x, t_floatarg f){
+    x->x_dyn.d_thresh = f;
+}
+
+static void duck_ratio(t_duck *x, t_floatarg f){
+    x->x_dyn.d_ratio = f;
+    dyn_update(&x->x_dyn);
+}
+
+static void duck_attack(t_duck *x, t_floatarg f){
+    x->x_dyn.d_attack = f;
+    dyn_update(&x->x_dyn);
+}
+
+static void duck_release(t_duck *x, t_floatarg f){
+    x->x_dyn.d_release = f;
+    dyn_update(&x->x_dyn);
+}
+
+static void duck_mix(t_duck *x, t_floatarg f){
+    x->x_mix = f != 0;
+}
+
+static void duck_size(t_duck *x, t_floatarg f){
+    x->x_dyn.d_window = f < 1 ? 1 : f > 512 ? 512 : f;
+    dyn_update(&x->x_dyn);
+}
+
+static void duck_peak(t_duck *x, t_floatarg f){
+    x->x_dyn.d_peak = f != 0;
+}
+
+static void duck_clear(t_duck *x){
+    dyn_clear(&x->x_dyn);
+}
+
+static t_int *duck_perform(t_int *w){
+    t_duck *x = (t_duck *)(w[1]);
+    int n = (int)(w[2]), nch = x->x_dyn.d_nch;
+    t_float *side = x->x_side;
+    for(int i = 0; i < n; i++) // an output may share its buffer with the control
+        side[i] = x->x_control[i];
+    dyn_perform(&x->x_dyn, n, x->x_ins, side, x->x_outs);
+    if(x->x_mix) for(int ch = 0; ch < nch; ch++){
+        t_float *out = x->x_outs[ch];
+        for(int i = 0; i < n; i++)
+            out[i] += side[i];
+    }
+    if((x->x_count += n) >= REPORT_PERIOD){
+        x->x_count = 0;
+        clock_delay(x->x_clock, 0);
+    }
+    return(w + 3);
+}
+
+static void duck_dsp(t_duck *x, t_signal **sp){
+    int nch = x->x_dyn.d_nch, n = sp[0]->s_n;
+    if(sp[0]->s_sr != x->x_dyn.d_sr){
+        x->x_dyn.d_sr = sp[0]->s_sr;
+        dyn_update(&x->x_dyn);
+    }
+    dyn_block(&x->x_dyn, n);
+    if(n != x->x_nblock){
+        x->x_side = (t_float *)resizebytes(x->x_side,
+            x->x_nblock * sizeof(t_float), n * sizeof(t_float));
+        x->x_nblock = n;
+    }
+    for(int ch = 0; ch < nch; ch++){
+        x->x_ins[ch] = sp[ch]->s_vec;
+        x->x_outs[ch] = sp[nch + 1 + ch]->s_vec;
+    }
+    x->x_control = sp[nch]->s_vec;
+    dsp_add(duck_perform, 2, x, n);
+}
+
+static void duck_free(t_duck *x){
+    int nch = x->x_dyn.d_nch;
+    clock_free(x->x_clock);
+    freebytes(x->x_ins, nch * sizeof(t_float *));
+    freebytes(x->x_outs, nch * sizeof(t_float *));
+    freebytes(x->x_side, x->x_nblock * sizeof(t_float));
+    dyn_free(&x->x_dyn);
+}
+
+static void *duck_new(t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    t_duck *x = (t_duck *)pd_new(duck_class);
+    int nch = 1, peak = 1;
+    while(ac && av->a_type == A_SYMBOL){
+        t_symbol *flag = atom_getsymbol(av);
+        if(flag == gensym("-ch") && ac >= 2){
+            int n = (int)atom_getfloat(av + 1);
+            nch = n < 1 ? 1 : n > MAX_CHANS ? MAX_CHANS : n;
+            ac -= 2, av += 2;
+        }
+        else if(flag == gensym("-mix")){
+            x->x_mix = 1;
+            ac--, av++;
+        }
+        else if(flag == gensym("-rms")){
+            peak = 0;
+            ac--, av++;
+        }
+        else{
+            pd_error(x, "[duck~]: unknown flag '%s' ignored", flag->s_name);
+            ac--, av++;
+        }
+    }
+    t_dynamics *d = &x->x_dyn;
+    dyn_init(d, DYN_DUCK, nch, 1, sys_getsr());
+    d->d_peak = peak;
+    d->d_window = 1; // follows the control at once, the release smooths it
+    // thresh ratio attack release
+    d->d_thresh = ac < 1 ? -60 : atom_getfloatarg(0, ac, av);
+    d->d_ratio = atom_getfloatarg(1, ac, av);
+    d->d_attack = ac < 3 ? 10 : atom_getfloatarg(2, ac, av);
+    d->d_release = ac < 4 ? 10 : atom_getfloatarg(3, ac, av);
+    dyn_update(d);
+    x->x_clock = clock_new(x, (t_method)duck_tick);
+    x->x_ins = (t_float **)getbytes(nch * sizeof(t_float *));
+    x->x_outs = (t_float **)getbytes(nch * sizeof(t_float *));
+    for(int ch = 0; ch < nch; ch++) // more channels and the control
+        inlet_new(&x->x_obj, &x->x_obj.ob_pd, &s_signal, &s_signal);
+    for(int ch = 0; ch < nch; ch++)
+        outlet_new(&x->x_obj, &s_signal);
+    x->x_out_gr = outlet_new(&x->x_obj, &s_float);
+    return(x);
+}
+
+void duck_tilde_setup(void){
+    duck_class = class_new(gensym("duck~"), (t_newmethod)duck_new,
+        (t_method)duck_free, sizeof(t_duck), CLASS_DEFAULT, A_GIMME, 0);
+    class_addmethod(duck_class, nullfn, gensym("signal"), 0);
+    class_addmethod(duck_class, (t_method)duck_dsp, gensym("dsp"), A_CANT, 0);
+    class_addmethod(duck_class, (t_method)duck_thresh, gensym("thresh"), A_FLOAT, 0);
+    class_addmethod(duck_class, (t_method)duck_ratio, gensym("ratio"), A_FLOAT, 0);
+    class_addmethod(duck_class, (t_method)duck_attack, gensym("attack"), A_FLOAT, 0);
+    class_addmethod(duck_class, (t_method)duck_release, gensym("release"), A_FLOAT, 0);
+    class_addmethod(duck_class, (t_method)duck_mix, gensym("mix"), A_FLOAT, 0);
+    class_addmethod(duck_class, (t_method)duck_size, gensym("size"), A_FLOAT, 0);
+    class_addmethod(duck_class, (t_method)duck_peak, gensym("peak"), A_FLOAT, 0);
+    class_addmethod(duck_class, (t_method)duck_clear, gensym("clear"), 0);
+}
@@ -3,8 +3,7 @@
 #include "m_pd.h"
 #include <stdlib.h>
 #include <math.h>
-
-#define MAX_SEGS  64 // maximum line segments
+#include "segment.h"
 
 static t_class *envgen_proxy;
 
@@ -18,12 +17,22 @@ typedef struct _envgenseg{
     float  ms;      // line time in ms
 }t_envgen_line;
 
+// an envelope of the bank, all run the same lines
+typedef struct _envgen_voice{
+    t_segment   v_seg;
+    float       v_value;
+    float       v_gain;
+    int         v_line;     // next line
+    int         v_end;      // line where this stage stops
+    int         v_release;  // lines after the sustain point still to run
+    int         v_on;
+}t_envgen_voice;
+
 typedef struct _envgen{
     t_object        x_obj;
     t_proxy         x_proxy;
     int             x_ac;
     int             x_ac_rel;
-    int             x_nleft;
     int             x_n_lines;
     int             x_line_n;
     int             x_pause;
@@ -31,27 +40,33 @@ typedef struct _envgen{
     int             x_legato;
     int             x_release;
     int             x_suspoint;
-    int             x_n;
     int             x_exp;
-    float           x_power;
+    int             x_avsize;   // allocated sizes
+    int             x_relsize;
+    int             x_expsize;
+    int             x_linesize;
     float           x_value;
-    float           x_target;
-    float           x_last_target;
-    float           x_inc;
-    float           x_delta;
     float           x_lastin;
     float           x_maxsustain;
     float           x_retrigger;
     float           x_gain;
+    t_segment       x_seg;
     t_atom         *x_av;
     t_atom         *x_av_rel;
-    t_atom          x_at_exp[MAX_SEGS];
+    float          *x_exps;
     t_envgen_line  *x_curseg;
     t_envgen_line  *x_lines;
-    t_envgen_line   x_n_lineini[MAX_SEGS];
     t_clock        *x_clock;
     t_clock        *x_sus_clock;
     t_outlet       *x_out2;
+    int             x_bank;     // number of envelopes in bank mode, 0 for one
+    int             x_bank_nlines;
+    int             x_bank_hasstart; // an odd list starts at a value
+    float           x_bank_start;
+    t_envgen_voice *x_voices;
+    int            *x_ended;    // envelopes that ended in the last blocks
+    int             x_nended;
+    t_float       **x_outs;
 }t_envgen;
 
 static t_class *envgen_class;
@@ -66,23 +81,49 @@ static void envgen_proxy_init(t_proxy * p, t_envgen *x){
     p->p_owner = x;
 }
 
-static float envgen_get_step(t_envgen *x){
-    float step = (float)(x->x_n-x->x_nleft)/(float)x->x_n;
-    if(fabs(x->x_power) != 1){ // EXPONENTIAL
-        if(x->x_power >= 0){ // positive exponential
-            if((x->x_delta > 0) == (x->x_gain > 0))
-                step = pow(step, x->x_power);
-            else
-                step = 1-pow(1-step, x->x_power);
-        }
-        else{ // negative exponential
-            if((x->x_delta > 0) == (x->x_gain > 0))
-                step = 1-pow(1-step, -x->x_power);
-            else
-                step = pow(step, -x->x_power);
-        }
+// grows an array of 'n' elements of 'elsize' bytes
+static void *envgen_resize(void *p, int *size, int n, size_t elsize){
+    if(n > *size){
+        p = resizebytes(p, *size * elsize, n * elsize);
+        *size = n;
     }
-    return(step);
+    return(p);
+}
+
+// in bank mode 'x_lines' holds the lines of the list for all envelopes,
+// without their gain
+static void envgen_bank_parse(t_envgen *x){
+    t_atom *av = x->x_av;
+    int ac = x->x_ac;
+    if((x->x_bank_hasstart = ac % 2))
+        x->x_bank_start = (av++)->a_w.w_float, ac--;
+    x->x_bank_nlines = ac/2;
+    x->x_lines = envgen_resize(x->x_lines, &x->x_linesize, ac/2 + 1, sizeof(t_envgen_line));
+    for(int i = 0; i < ac/2; i++){
+        x->x_lines[i].ms = av[2*i].a_w.w_float < 0 ? 0 : av[2*i].a_w.w_float;
+        x->x_lines[i].target = av[2*i+1].a_w.w_float;
+    }
+}
+
+static void envgen_setlist(t_envgen *x, int ac, t_atom *av){
+    x->x_av = envgen_resize(x->x_av, &x->x_avsize, ac, sizeof(t_atom));
+    copy_atoms(av, x->x_av, x->x_ac = ac);
+    if(x->x_bank)
+        envgen_bank_parse(x);
+}
+
+// exponents of new lines are linear
+static void envgen_expsize(t_envgen *x, int n){
+    if(n > x->x_expsize){
+        int old = x->x_expsize;
+        x->x_exps = envgen_resize(x->x_exps, &x->x_expsize, n, sizeof(float));
+        for(int i = old; i < n; i++)
+            x->x_exps[i] = 1;
+    }
+}
+
+static float envgen_power(t_envgen *x, int i){
+    return(i < x->x_expsize ? x->x_exps[i] : 1);
 }
 
 static void envgen_proxy_list(t_proxy *p, t_symbol *s, int ac, t_atom *av){
@@ -95,38 +136,91 @@ static void envgen_proxy_list(t_proxy *p, t_symbol *s, int ac, t_atom *av){
             pd_error(x, "[envgen~]: needs to only contain floats");
             return;
         }
-    x->x_ac = ac;
-//    x->x_av = getbytes(x->x_ac*sizeof(*(x->x_av)));
-    copy_atoms(av, x->x_av, x->x_ac);
+    envgen_setlist(x, ac, av);
 }
 
-static void envgen_retarget(t_envgen *x, int skip){
-    x->x_target = x->x_curseg->target;
-    if(skip)
-        x->x_power = 1;
+static int envgen_nsamps(float ms){
+    return((int)(ms * sys_getsr()*0.001 + 0.5));
+}
+
+// a line from '*value' in 'n' samples, 0 is a jump in one sample
+static void envgen_line(t_segment *seg, float *value, float gain, int n,
+float target, float power){
+    if(n == 0)
+        segment_start(seg, *value = target, target, 1, 1, 0);
     else{
-        x->x_power = x->x_at_exp[x->x_line_n].a_w.w_float;
-        x->x_line_n++;
+        int up = (target > *value) == (gain > 0);
+        segment_start(seg, *value, target, n, power, power >= 0 ? !up : up);
     }
-    x->x_nleft = (int)(x->x_curseg->ms * sys_getsr()*0.001 + 0.5);
+}
+
+static void envgen_retarget(t_envgen *x, int skip){
+    float target = x->x_curseg->target;
+    float power = skip ? 1 : envgen_power(x, x->x_line_n++);
+    int n = envgen_nsamps(x->x_curseg->ms);
     x->x_n_lines--, x->x_curseg++;
-    if(x->x_nleft == 0){ // stupid line's gonna be ignored
-        x->x_value = x->x_last_target = x->x_target;
-        x->x_delta = x->x_inc = 0;
-        x->x_power = x->x_at_exp[x->x_line_n].a_w.w_float;
+    if(n == 0){ // stupid line's gonna be a jump in one sample
         while(x->x_n_lines && // others to be ignored
-              !(int)(x->x_curseg->ms * sys_getsr()*0.001 + 0.5)){
-            x->x_value = x->x_target = x->x_curseg->target;
+              !envgen_nsamps(x->x_curseg->ms)){
+            target = x->x_curseg->target;
             x->x_n_lines--, x->x_curseg++, x->x_line_n++;
-            x->x_power = x->x_at_exp[x->x_line_n].a_w.w_float;
         }
     }
-    else{
-        x->x_delta = (x->x_target - (x->x_last_target = x->x_value));
-        x->x_n = x->x_nleft;
-        x->x_nleft--; // update it already
-        x->x_inc = x->x_delta != 0 ? envgen_get_step(x) * x->x_delta : 0;
+    envgen_line(&x->x_seg, &x->x_value, x->x_gain, n, target, power);
+}
+
+// starts the next line of an envelope of the bank, returns 0 at the end of
+// the stage
+static int envgen_voice_next(t_envgen *x, t_envgen_voice *v){
+    int end = v->v_end < x->x_bank_nlines ? v->v_end : x->x_bank_nlines;
+    if(v->v_line >= end)
+        return(0);
+    t_envgen_line *l = x->x_lines + v->v_line;
+    float target = l->target * v->v_gain;
+    float power = envgen_power(x, v->v_line++);
+    int n = envgen_nsamps(l->ms);
+    if(n == 0) // others to be ignored
+        while(v->v_line < end && !envgen_nsamps(x->x_lines[v->v_line].ms))
+            target = x->x_lines[v->v_line++].target * v->v_gain;
+    envgen_line(&v->v_seg, &v->v_value, v->v_gain, n, target, power);
+    return(1);
+}
+
+static void envgen_voice_end(t_envgen *x, t_envgen_voice *v){
+    v->v_on = 0;
+    if(x->x_nended < x->x_bank)
+        x->x_ended[x->x_nended++] = (int)(v - x->x_voices);
+}
+
+// gate an envelope of the bank, 0 releases it, returns 1 if it was idle
+static int envgen_voice_gate(t_envgen *x, int i, float gain){
+    if(i < 0 || i >= x->x_bank)
+        return(0);
+    t_envgen_voice *v = x->x_voices + i;
+    if(gain == 0){
+        if(v->v_on && v->v_release){
+            v->v_release = 0;
+            v->v_line = x->x_suspoint;
+            v->v_end = x->x_bank_nlines;
+            if(!envgen_voice_next(x, v))
+                envgen_voice_end(x, v);
+        }
+        return(0);
+    }
+    int wason = v->v_on;
+    v->v_on = 1;
+    v->v_gain = gain;
+    v->v_line = 0;
+    v->v_release = x->x_suspoint && x->x_bank_nlines >= x->x_suspoint;
+    v->v_end = v->v_release ? x->x_suspoint : x->x_bank_nlines;
+    if(x->x_bank_hasstart && !x->x_legato){ // restart from the first value
+        float target = x->x_bank_start * gain;
+        envgen_line(&v->v_seg, &v->v_value, gain,
+            wason ? envgen_nsamps(x->x_retrigger) : 0, target, 1);
     }
+    else if(!envgen_voice_next(x, v))
+        envgen_voice_end(x, v);
+    return(!wason);
 }
 
 static void envgen_attack(t_envgen *x, int ac, t_atom *av){
@@ -142,15 +236,14 @@ static void envgen_attack(t_envgen *x, int ac, t_atom *av){
             skip1st = 1; // for release
         }
     }
-    if(n_lines > MAX_SEGS)
-        n_lines = MAX_SEGS, odd = 0;
     if(x->x_suspoint){ // find sustain point
         if((n_lines - skip1st) >= x->x_suspoint){ // we have a release!
             x->x_release = 1;
             n_lines = x->x_suspoint; // limit n_lines to suspoint
             int n = 2*n_lines + skip1st;
             x->x_ac_rel = (ac -= n); // release n
-            x->x_av_rel = getbytes(x->x_ac_rel*sizeof(*(x->x_av_rel)));
+            x->x_av_rel = envgen_resize(x->x_av_rel, &x->x_relsize,
+                x->x_ac_rel, sizeof(t_atom));
             copy_atoms(av+n, x->x_av_rel, x->x_ac_rel); // copy release ramp
             if(x->x_maxsustain > 0)
                 clock_delay(x->x_sus_clock, x->x_maxsustain);
@@ -162,6 +255,7 @@ static void envgen_attack(t_envgen *x, int ac, t_atom *av){
         x->x_release = 0;
 // attack
     x->x_n_lines = n_lines; // define number of line segments
+    x->x_lines = envgen_resize(x->x_lines, &x->x_linesize, n_lines + 1, sizeof(t_envgen_line));
     t_envgen_line *line_point = x->x_lines;
     if(odd && !x->x_legato){ // initialize 1st segment
         line_point->ms = x->x_status ? x->x_retrigger : 0;
@@ -189,6 +283,7 @@ static void envgen_release(t_envgen *x, int ac, t_atom *av){
         return;
     int n_lines = ac/2;
     x->x_n_lines = n_lines; // define number of line segments
+    x->x_lines = envgen_resize(x->x_lines, &x->x_linesize, n_lines + 1, sizeof(t_envgen_line));
     t_envgen_line *line_point = x->x_lines;
     while(n_lines--){
         line_point->ms = av++->a_w.w_float;
@@ -197,7 +292,6 @@ static void envgen_release(t_envgen *x, int ac, t_atom *av){
         line_point->target = av++->a_w.w_float * x->x_gain;
         line_point++;
     }
-    x->x_target = x->x_lines->target;
     x->x_curseg = x->x_lines;
     x->x_release = 0;
     envgen_retarget(x, 0);
@@ -224,8 +318,7 @@ static void envgen_set(t_envgen *x, t_symbol *s, int ac, t_atom *av){
             pd_error(x, "[envgen~]: set needs to only contain floats");
             return;
         }
-//    x->x_av = getbytes(x->x_ac * sizeof(*(x->x_av)));
-    copy_atoms(av, x->x_av, x->x_ac = ac);
+    envgen_setlist(x, ac, av);
 }
 
 static void envgen_init(t_envgen *x, int ac, t_atom *av){
@@ -236,8 +329,7 @@ static void envgen_init(t_envgen *x, int ac, t_atom *av){
             return;
         }
     if(!x->x_exp){
-//        x->x_av = getbytes(x->x_ac * sizeof(*(x->x_av)));
-        copy_atoms(av, x->x_av, x->x_ac = ac);
+        envgen_setlist(x, ac, av);
         envgen_attack(x, x->x_ac, x->x_av);
     }
     else{
@@ -249,9 +341,10 @@ static void envgen_init(t_envgen *x, int ac, t_atom *av){
         int nlines = (int)(ac/3);
         t_atom* temp_at = calloc(ac-nlines, sizeof(t_atom));
         int j = 0, k = 0;
+        envgen_expsize(x, nlines + 1);
         for(i = 0; i < ac; i++){
             if(i % 3 == exp){
-                SETFLOAT(x->x_at_exp+j, (av+i)->a_w.w_float);
+                x->x_exps[j] = (av+i)->a_w.w_float;
                 j++;
             }
             else{
@@ -259,25 +352,26 @@ static void envgen_init(t_envgen *x, int ac, t_atom *av){
                 k++;
             }
         }
-        x->x_ac = k;
-//        x->x_av = getbytes(x->x_ac * sizeof(*(x->x_av)));
-        copy_atoms(temp_at, x->x_av, x->x_ac);
-        envgen_attack(x, x->x_ac, x->x_av);
+        envgen_setlist(x, k, temp_at);
+        if(!x->x_bank)
+            envgen_attack(x, x->x_ac, x->x_av);
         free(temp_at);
     }
 }
 
 static void envgen_expi(t_envgen *x, t_floatarg f1, t_floatarg f2){
     int i = f1 < 0 ? 0 : (int)f1;
-    SETFLOAT(x->x_at_exp+i, f2);
+    envgen_expsize(x, i + 1);
+    x->x_exps[i] = f2;
 }
 
 static void envgen_expl(t_envgen *x, t_symbol *s, int ac, t_atom *av){
     if(!ac)
         return;
     s = NULL;
+    envgen_expsize(x, ac);
     for(int i = 0; i < ac; i++)
-        SETFLOAT(x->x_at_exp+i, (av+i)->a_w.w_float);
+        x->x_exps[i] = atom_getfloat(av+i);
 }
 
 static void envgen_exp(t_envgen *x, t_symbol *s, int ac, t_atom *av){
@@ -289,10 +383,18 @@ static void envgen_exp(t_envgen *x, t_symbol *s, int ac, t_atom *av){
 }
 
 static void envgen_bang(t_envgen *x){
+    if(x->x_bank){
+        pd_error(x, "[envgen~]: bank mode needs a 'voice gate' list");
+        return;
+    }
     envgen_attack(x, x->x_ac, x->x_av);
 }
 
 static void envgen_float(t_envgen *x, t_floatarg f){
+    if(x->x_bank){
+        pd_error(x, "[envgen~]: bank mode needs a 'voice gate' list");
+        return;
+    }
     if(f != 0){
         x->x_gain = f;
         envgen_attack(x, x->x_ac, x->x_av);
@@ -314,11 +416,26 @@ static void envgen_list(t_envgen *x,t_symbol* s, int ac, t_atom* av){
             envgen_float(x, atom_getfloat(av));
         return;
     }
+    if(x->x_bank){ // 'voice gate' or 'voice pitch velocity' from [voices]
+        int voice = (int)atom_getfloat(av);
+        if(envgen_voice_gate(x, voice, atom_getfloat(av + ac - 1))){
+            t_atom at[2];
+            SETFLOAT(at, voice);
+            SETFLOAT(at + 1, 1);
+            outlet_list(x->x_out2, &s_list, 2, at);
+        }
+        return;
+    }
     x->x_exp = 0;
     envgen_init(x, ac, av);
 }
 
 static void envgen_rel(t_envgen *x){
+    if(x->x_bank){
+        for(int i = 0; i < x->x_bank; i++)
+            envgen_voice_gate(x, i, 0);
+        return;
+    }
     if(x->x_release)
         envgen_release(x, x->x_ac_rel, x->x_av_rel);
 }
@@ -344,54 +461,122 @@ static void envgen_suspoint(t_envgen *x, t_floatarg f){
     x->x_suspoint = f < 0 ? 0 : (int)f;
 }
 
+// renders 'n' samples with no change in the gate, in runs up to the end of
+// each segment
+static void envgen_run(t_envgen *x, t_float *out, int n){
+    while(n > 0){
+        if(x->x_pause || !x->x_status || segment_done(&x->x_seg)){ // hold
+            if(PD_BIGORSMALL(x->x_value)) // ??????????????
+                x->x_value = 0;
+            for(int i = 0; i < n; i++)
+                out[i] = x->x_value;
+            return;
+        }
+        int m = segment_render(&x->x_seg, out, n);
+        out += m, n -= m;
+        x->x_value = x->x_seg.s_value;
+        if(segment_done(&x->x_seg)){ // reached target, update!
+            if(x->x_n_lines > 0) // there's more, retarget to the next
+                envgen_retarget(x, 0);
+            else if(!x->x_release) // there's no release, we're done.
+                clock_delay(x->x_clock, 0);
+        }
+    }
+}
+
 static t_int *envgen_perform(t_int *w){
     t_envgen *x = (t_envgen *)(w[1]);
     int n = (int)(w[2]);
     t_float *in = (t_float *)(w[3]);
     t_float *out = (t_float *)(w[4]);
     float lastin = x->x_lastin;
-    while(n--){
-        t_float f = *in++;
+    int i = 0;
+    while(i < n){
+        t_float f = in[i];
         if(f != 0 && lastin == 0){ // set attack ramp
             x->x_gain = f;
             envgen_attack(x, x->x_ac, x->x_av);
         }
         else if(x->x_release && f == 0 && lastin != 0) // set release ramp
             envgen_release(x, x->x_ac_rel, x->x_av_rel);
-        if(PD_BIGORSMALL(x->x_value)) // ??????????????
-            x->x_value = 0;
-        *out++ = x->x_value = x->x_last_target + x->x_inc;
-        if(!x->x_pause && x->x_status){ // not paused and 'on' => let's update
-            if(x->x_nleft > 0){ // increase
-                x->x_nleft--;
-                x->x_inc = x->x_delta != 0 ? envgen_get_step(x) * x->x_delta : 0;
-            }
-            else if(x->x_nleft == 0){ // reached target, update!
-                x->x_last_target = x->x_target;
-                x->x_inc = 0;
-                if(x->x_n_lines > 0) // there's more, retarget to the next
-                    envgen_retarget(x, 0);
-                else if(!x->x_release) // there's no release, we're done.
-                    clock_delay(x->x_clock, 0);
-            }
-        }
+        int j = i + 1; // next change of the gate, before 'out' overwrites 'in'
+        while(j < n && (in[j] != 0) == (f != 0))
+            j++;
+        envgen_run(x, out + i, j - i);
         lastin = f;
+        i = j;
     }
     x->x_lastin = lastin;
     return(w+5);
 }
 
+// report the envelopes of the bank that ended and weren't triggered again
+static void envgen_bank_tick(t_envgen *x){
+    for(int k = 0; k < x->x_nended; k++){
+        int voice = x->x_ended[k];
+        if(!x->x_voices[voice].v_on){
+            t_atom at[2];
+            SETFLOAT(at, voice);
+            SETFLOAT(at + 1, 0);
+            outlet_list(x->x_out2, &s_list, 2, at);
+        }
+    }
+    x->x_nended = 0;
+}
+
+// each envelope renders its block in runs up to the end of its lines,
+// idle ones just hold their value
+static t_int *envgen_bank_perform(t_int *w){
+    t_envgen *x = (t_envgen *)(w[1]);
+    int nblock = (int)(w[2]);
+    for(int j = 0; j < x->x_bank; j++){
+        t_envgen_voice *v = x->x_voices + j;
+        t_float *out = x->x_outs[j];
+        int n = nblock;
+        while(n > 0){
+            if(x->x_pause || !v->v_on || segment_done(&v->v_seg)){ // hold
+                if(PD_BIGORSMALL(v->v_value))
+                    v->v_value = 0;
+                for(int i = 0; i < n; i++)
+                    out[i] = v->v_value;
+                break;
+            }
+            int m = segment_render(&v->v_seg, out, n);
+            out += m, n -= m;
+            v->v_value = v->v_seg.s_value;
+            if(segment_done(&v->v_seg) && !envgen_voice_next(x, v) && !v->v_release)
+                envgen_voice_end(x, v);
+        }
+    }
+    if(x->x_nended)
+        clock_delay(x->x_clock, 0);
+    return(w+3);
+}
+
 static void envgen_dsp(t_envgen *x, t_signal **sp){
+    if(x->x_bank){
+        for(int j = 0; j < x->x_bank; j++)
+            x->x_outs[j] = sp[1 + j]->s_vec;
+        dsp_add(envgen_bank_perform, 2, x, sp[0]->s_n);
+        return;
+    }
     dsp_add(envgen_perform, 4, x, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec);
 }
 
 static void envgen_free(t_envgen *x){
-    if(x->x_lines != x->x_n_lineini)
-        freebytes(x->x_lines, MAX_SEGS*sizeof(*x->x_lines));
+    freebytes(x->x_av, x->x_avsize * sizeof(t_atom));
+    freebytes(x->x_av_rel, x->x_relsize * sizeof(t_atom));
+    freebytes(x->x_exps, x->x_expsize * sizeof(float));
+    freebytes(x->x_lines, x->x_linesize * sizeof(t_envgen_line));
     if(x->x_clock)
         clock_free(x->x_clock);
     if(x->x_sus_clock)
         clock_free(x->x_sus_clock);
+    if(x->x_bank){
+        freebytes(x->x_voices, x->x_bank * sizeof(t_envgen_voice));
+        freebytes(x->x_ended, x->x_bank * sizeof(int));
+        freebytes(x->x_outs, x->x_bank * sizeof(t_float *));
+    }
 }
 
 static void envgen_pause(t_envgen *x){
@@ -405,22 +590,21 @@ static void envgen_resume(t_envgen *x){
 static void *envgen_new(t_symbol *s, int ac, t_atom *av){
     t_symbol *cursym = s; // avoid warning
     t_envgen *x = (t_envgen *)pd_new(envgen_class);
-    x->x_gain = x->x_power = 1;
-    x->x_lastin = x->x_maxsustain = x->x_retrigger = x->x_value = x->x_last_target = 0;
-    x->x_nleft = x->x_n_lines = x->x_line_n = x->x_pause = x->x_release = 0;
+    x->x_gain = 1;
+    x->x_lastin = x->x_maxsustain = x->x_retrigger = x->x_value = 0;
+    x->x_n_lines = x->x_line_n = x->x_pause = x->x_release = 0;
     x->x_suspoint = x->x_legato = 0;
-    x->x_lines = x->x_n_lineini;
-    x->x_curseg = 0;
+    x->x_bank = x->x_nended = 0;
+    x->x_avsize = x->x_relsize = x->x_expsize = x->x_linesize = 0;
+    x->x_av = x->x_av_rel = NULL;
+    x->x_exps = NULL;
+    x->x_lines = x->x_curseg = NULL;
     int i = 0;
     x->x_exp = 0;
-    for(i = 0; i < MAX_SEGS; i++) // set exponential list to linear
-        SETFLOAT(x->x_at_exp+i, 1);
     t_atom at[2];
     SETFLOAT(at, 0);
     SETFLOAT(at+1, 0);
-//    x->x_av = getbytes(2*sizeof(*(x->x_av)));
-    x->x_av = getbytes(MAX_SEGS*sizeof(*(x->x_av)));
-    copy_atoms(at, x->x_av, x->x_ac = 2);
+    envgen_setlist(x, 2, at);
     while(ac > 0){
         if(av->a_type == A_FLOAT)
             break;
@@ -454,9 +638,10 @@ static void *envgen_new(t_symbol *s, int ac, t_atom *av){
                     int nlines = (int)(z/3);
                     t_atom* temp_at = calloc(z-nlines, sizeof(t_atom));
                     int j = 0, k = 0;
-                    for(i = 0; i < ac; i++){
+                    envgen_expsize(x, nlines + 1);
+                    for(i = 0; i < z; i++){
                         if(i % 3 == exp){
-                            SETFLOAT(x->x_at_exp+j, (av+i)->a_w.w_float);
+                            x->x_exps[j] = (av+i)->a_w.w_float;
                             j++;
                         }
                         else{
@@ -465,8 +650,7 @@ static void *envgen_new(t_symbol *s, int ac, t_atom *av){
                         }
                     }
                     x->x_exp = 1;
-//                    x->x_av = getbytes(k*sizeof(*(x->x_av)));
-                    copy_atoms(temp_at, x->x_av, x->x_ac = k);
+                    envgen_setlist(x, k, temp_at);
                     free(temp_at);
                     ac-=z, av+=z;
                 }
@@ -490,6 +674,15 @@ static void *envgen_new(t_symbol *s, int ac, t_atom *av){
                 else
                     goto errstate;
             }
+            else if(cursym == gensym("-bank")){
+                if(ac >= 2 && (av+1)->a_type == A_FLOAT){
+                    int n = (int)atom_getfloatarg(1, ac, av);
+                    x->x_bank = n < 1 ? 1 : n;
+                    ac-=2, av+=2;
+                }
+                else
+                    goto errstate;
+            }
             else if(cursym == gensym("-legato"))
                 x->x_legato = 1, ac--, av++;
             else
@@ -500,20 +693,29 @@ static void *envgen_new(t_symbol *s, int ac, t_atom *av){
         if(ac == 1)
             x->x_value = atom_getfloatarg(0, 1, av);
         else{
-            if(!x->x_exp){
-//                x->x_av = getbytes(ac*sizeof(*(x->x_av)));
-                copy_atoms(av, x->x_av, x->x_ac = ac);
-            }
+            if(!x->x_exp)
+                envgen_setlist(x, ac, av);
             else
                 goto errstate;
         }
     }
-    x->x_last_target = x->x_value;
+    segment_set(&x->x_seg, x->x_value);
     envgen_proxy_init(&x->x_proxy, x);
     inlet_new(&x->x_obj, &x->x_proxy.p_pd, 0, 0);
-    outlet_new((t_object *)x, &s_signal);
+    if(x->x_bank){ // one outlet per envelope
+        x->x_voices = (t_envgen_voice *)getbytes(x->x_bank * sizeof(t_envgen_voice));
+        x->x_ended = (int *)getbytes(x->x_bank * sizeof(int));
+        x->x_outs = (t_float **)getbytes(x->x_bank * sizeof(t_float *));
+        for(int j = 0; j < x->x_bank; j++){
+            segment_set(&x->x_voices[j].v_seg, x->x_voices[j].v_value = x->x_value);
+            outlet_new((t_object *)x, &s_signal);
+        }
+        envgen_bank_parse(x);
+    }
+    else
+        outlet_new((t_object *)x, &s_signal);
     x->x_out2 = outlet_new((t_object *)x, &s_float);
-    x->x_clock = clock_new(x, (t_method)envgen_tick);
+    x->x_clock = clock_new(x, x->x_bank ? (t_method)envgen_bank_tick : (t_method)envgen_tick);
     x->x_sus_clock = clock_new(x, (t_method)envgen_sus_tick);
     return(x);
 errstate:
@@ -0,0 +1,175 @@
+// expander, runs on the dynamics core (shared/dynamics.c)
+
+#include "m_pd.h"
+#include "dynamics.h"
+
+#define MAX_CHANS 64
+#define REPORT_PERIOD 1024 // samples between gain reduction reports
+
+typedef struct _expand{
+    t_object    x_obj;
+    t_dynamics  x_dyn;
+    int         x_count;
+    t_clock    *x_clock;
+    t_outlet   *x_out_gr;
+    t_float   **x_ins;
+    t_float   **x_outs;
+}t_expand;
+
+static t_class *expand_class;
+
+static void expand_tick(t_expand *x){
+    outlet_float(x->x_out_gr, dyn_reduction(&x->x_dyn));
+}
+
+static void expand_thresh(t_expand *x, t_floatarg f){
+    x->x_dyn.d_thresh = f;
+}
+
+static void expand_ratio(t_expand *x, t_floatarg f){
+    x->x_dyn.d_ratio = f;
+    dyn_update(&x->x_dyn);
+}
+
+static void expand_attack(t_expand *x, t_floatarg f){
+    x->x_dyn.d_attack = f;
+    dyn_update(&x->x_dyn);
+}
+
+static void expand_release(t_expand *x, t_floatarg f){
+    x->x_dyn.d_release = f;
+    dyn_update(&x->x_dyn);
+}
+
+static void expand_gain(t_expand *x, t_floatarg f){
+    dyn_makeup(&x->x_dyn, f);
+}
+
+static void expand_size(t_expand *x, t_floatarg f){
+    x->x_dyn.d_window = f < 1 ? 1 : f > 512 ? 512 : f;
+    dyn_update(&x->x_dyn);
+}
+
+static void expand_peak(t_expand *x, t_floatarg f){
+    x->x_dyn.d_peak = f != 0;
+}
+
+static void expand_link(t_expand *x, t_floatarg f){
+    x->x_dyn.d_link = f != 0;
+}
+
+static void expand_lookahead(t_expand *x, t_floatarg f){
+    dyn_lookahead(&x->x_dyn, f);
+}
+
+static void expand_clear(t_expand *x){
+    dyn_clear(&x->x_dyn);
+}
+
+static t_int *expand_perform(t_int *w){
+    t_expand *x = (t_expand *)(w[1]);
+    int n = (int)(w[2]);
+    dyn_perform(&x->x_dyn, n, x->x_ins, NULL, x->x_outs);
+    if((x->x_count += n) >= REPORT_PERIOD){
+        x->x_count = 0;
+        clock_delay(x->x_clock, 0);
+    }
+    return(w + 3);
+}
+
+static void expand_dsp(t_expand *x, t_signal **sp){
+    int nch = x->x_dyn.d_nch, n = sp[0]->s_n;
+    if(sp[0]->s_sr != x->x_dyn.d_sr){
+        x->x_dyn.d_sr = sp[0]->s_sr;
+        dyn_update(&x->x_dyn);
+        dyn_lookahead(&x->x_dyn, x->x_dyn.d_lookahead);
+    }
+    dyn_block(&x->x_dyn, n);
+    for(int ch = 0; ch < nch; ch++){
+        x->x_ins[ch] = sp[ch]->s_vec;
+        x->x_outs[ch] = sp[nch + ch]->s_vec;
+    }
+    dsp_add(expand_perform, 2, x, n);
+}
+
+static void expand_free(t_expand *x){
+    int nch = x->x_dyn.d_nch;
+    clock_free(x->x_clock);
+    freebytes(x->x_ins, nch * sizeof(t_float *));
+    freebytes(x->x_outs, nch * sizeof(t_float *));
+    dyn_free(&x->x_dyn);
+}
+
+static void *expand_new(t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    t_expand *x = (t_expand *)pd_new(expand_class);
+    int nch = 1, peak = 0, link = 1;
+    t_float lookahead = 0;
+    while(ac && av->a_type == A_SYMBOL){
+        t_symbol *flag = atom_getsymbol(av);
+        if(flag == gensym("-ch") && ac >= 2){
+            int n = (int)atom_getfloat(av + 1);
+            nch = n < 1 ? 1 : n > MAX_CHANS ? MAX_CHANS : n;
+            ac -= 2, av += 2;
+        }
+        else if(flag == gensym("-lookahead") && ac >= 2){
+            lookahead = atom_getfloat(av + 1);
+            ac -= 2, av += 2;
+        }
+        else if(flag == gensym("-peak")){
+            peak = 1;
+            ac--, av++;
+        }
+        else if(flag == gensym("-unlink")){
+            link = 0;
+            ac--, av++;
+        }
+        else{
+            pd_error(x, "[expand~]: unknown flag '%s' ignored", flag->s_name);
+            ac--, av++;
+        }
+    }
+    t_dynamics *d = &x->x_dyn;
+    dyn_init(d, DYN_EXPAND, nch, 0, sys_getsr());
+    d->d_peak = peak, d->d_link = link;
+    // thresh ratio attack release gain
+    d->d_thresh = atom_getfloatarg(0, ac, av);
+    d->d_ratio = atom_getfloatarg(1, ac, av);
+    d->d_attack = atom_getfloatarg(2, ac, av);
+    d->d_release = atom_getfloatarg(3, ac, av);
+    if(ac < 1)
+        d->d_thresh = -10;
+    if(ac < 3)
+        d->d_attack = 10;
+    if(ac < 4)
+        d->d_release = 10;
+    dyn_makeup(d, atom_getfloatarg(4, ac, av));
+    dyn_update(d);
+    dyn_lookahead(d, lookahead);
+    x->x_clock = clock_new(x, (t_method)expand_tick);
+    x->x_ins = (t_float **)getbytes(nch * sizeof(t_float *));
+    x->x_outs = (t_float **)getbytes(nch * sizeof(t_float *));
+    for(int ch = 1; ch < nch; ch++)
+        inlet_new(&x->x_obj, &x->x_obj.ob_pd, &s_signal, &s_signal);
+    for(int ch = 0; ch < nch; ch++)
+        outlet_new(&x->x_obj, &s_signal);
+    x->x_out_gr = outlet_new(&x->x_obj, &s_float);
+    return(x);
+}
+
+void expand_tilde_setup(void){
+    expand_class = class_new(gensym("expand~"), (t_newmethod)expand_new,
+        (t_method)expand_free, sizeof(t_expand), CLASS_DEFAULT, A_GIMME, 0);
+    class_addmethod(expand_class, nullfn, gensym("signal"), 0);
+    class_addmethod(expand_class, (t_method)expand_dsp, gensym("dsp"), A_CANT, 0);
+    class_addmethod(expand_class, (t_method)expand_thresh, gensym("thresh"), A_FLOAT, 0);
+    class_addmethod(expand_class, (t_method)expand_ratio, gensym("ratio"), A_FLOAT, 0);
+    class_addmethod(expand_class, (t_method)expand_attack, gensym("attack"), A_FLOAT, 0);
+    class_addmethod(expand_class, (t_method)expand_release, gensym("release"), A_FLOAT, 0);
+    class_addmethod(expand_class, (t_method)expand_gain, gensym("gain"), A_FLOAT, 0);
+    class_addmethod(expand_class, (t_method)expand_size, gensym("size"), A_FLOAT, 0);
+    class_addmethod(expand_class, (t_method)expand_peak, gensym("peak"), A_FLOAT, 0);
+    class_addmethod(expand_class, (t_method)expand_link, gensym("link"), A_FLOAT, 0);
+    class_addmethod(expand_class, (t_method)expand_lookahead, gensym("lookahead"), A_FLOAT, 0);
+    class_addmethod(expand_class, (t_method)expand_clear, gensym("clear"), 0);
+}
@@ -1,5 +1,6 @@
 
 #include "m_pd.h"
+#include "oversample.h"
 
 static t_class *fold_tilde_class;
 
@@ -11,19 +12,17 @@ typedef struct _fold_tilde {
 	t_inlet     *x_minlet;
 	t_inlet     *x_maxlet;
 	t_outlet    *x_outlet;
+	t_oversample x_os;
 } t_fold_tilde;
 
-static t_int *fold_tilde_perform(t_int *w)
+static void fold_tilde_oversample(t_fold_tilde *x, t_floatarg f)
+{
+    if(!oversample_factor(&x->x_os, (int)f))
+        pd_error(x, "fold~: oversampling is 1, 2, 4 or 8");
+}
+
+static inline float fold_tilde_kernel(float in, float min, float max)
 {
-	t_float *in1 = (t_float *)(w[2]);
-	t_float *in2 = (t_float *)(w[3]);
-	t_float *in3 = (t_float *)(w[4]);
-	t_float *out = (t_float *)(w[5]);
-	int n = (int)(w[6]);
-	while (n--){
-		float in = *in1++;
-		float min = *in2++;
-		float max = *in3++;
         float output;
 		if(min > max)
             { // swap values
@@ -70,23 +69,65 @@ static t_int *fold_tilde_perform(t_int *w)
                     };
                 };
             }
-		*out++ = output;
-		};
+	return (output);
+}
+
+// 'n' samples at 2^shift times the rate of the min and max inputs
+static void fold_tilde_run(int n, t_float *in1, t_float *in2, t_float *in3,
+    t_float *out, int shift)
+{
+	for(int i = 0; i < n; i++)
+		out[i] = fold_tilde_kernel(in1[i], in2[i >> shift], in3[i >> shift]);
+}
+
+static t_int *fold_tilde_perform(t_int *w)
+{
+	t_fold_tilde *x = (t_fold_tilde *)(w[1]);
+	t_float *in1 = (t_float *)(w[2]);
+	t_float *in2 = (t_float *)(w[3]);
+	t_float *in3 = (t_float *)(w[4]);
+	t_float *out = (t_float *)(w[5]);
+	int n = (int)(w[6]);
+	t_oversample *os = &x->x_os;
+	if(os->o_factor == 1)
+		fold_tilde_run(n, in1, in2, in3, out, 0);
+	else
+		{
+		t_float *buf = oversample_up(os, in1);
+		fold_tilde_run(n << os->o_shift, buf, in2, in3, buf, os->o_shift);
+		oversample_down(os, out);
+		}
 	return (w+7);
 }
 
 static void fold_tilde_dsp(t_fold_tilde *x, t_signal **sp)
 {
+		oversample_dsp(&x->x_os, sp[0]->s_n);
 		dsp_add(fold_tilde_perform, 6, x, sp[0]->s_vec, sp[1]->s_vec,
                 sp[2]->s_vec, sp[3]->s_vec, sp[0]->s_n);
 }
 
+static void fold_tilde_free(t_fold_tilde *x)
+{
+    oversample_free(&x->x_os);
+}
+
 static void *fold_tilde_new(t_symbol *s, int argc, t_atom *argv){
     s = NULL;
     t_fold_tilde *x = (t_fold_tilde *)pd_new(fold_tilde_class);
 ///////////////////////////
     x->x_min = -1.;
     x-> x_max = 1.;
+    oversample_init(&x->x_os, 1);
+    if(argc >= 2 && argv -> a_type == A_SYMBOL)
+    {
+        if(atom_getsymbol(argv) == gensym("-oversample"))
+        {
+            fold_tilde_oversample(x, atom_getfloat(argv + 1));
+            argc -= 2, argv += 2;
+        }
+        else goto errstate;
+    }
     if(argc == 1)
     {
         if(argv -> a_type == A_FLOAT)
@@ -140,8 +181,10 @@ errstate:
 }
 
 void fold_tilde_setup(void){
-	fold_tilde_class = class_new(gensym("fold~"), (t_newmethod)fold_tilde_new, 0,
+	fold_tilde_class = class_new(gensym("fold~"), (t_newmethod)fold_tilde_new,
+			(t_method)fold_tilde_free,
 			sizeof(t_fold_tilde), CLASS_DEFAULT, A_GIMME, 0);
     class_addmethod(fold_tilde_class, (t_method)fold_tilde_dsp, gensym("dsp"), A_CANT, 0);
+    class_addmethod(fold_tilde_class, (t_method)fold_tilde_oversample, gensym("oversample"), A_FLOAT, 0);
     CLASS_MAINSIGNALIN(fold_tilde_class, t_fold_tilde, x_in);
 }
@@ -2,17 +2,18 @@
 
 #include <m_pd.h>
 #include "math.h"
-
-#define MAX_SIZE  4096
+#include "segment.h"
 
 typedef struct _function{
     t_object    x_obj;
     float       x_f;
     float      *x_points;
     float      *x_durations;
-    float       x_power;
-    t_atom      x_at_exp[MAX_SIZE];
-    t_atom      x_at_av[MAX_SIZE];
+    float      *x_exps;         // curve of each line
+    float      *x_scale;        // 1 / duration of each line
+    int        *x_flip;         // mirrored curve of each line
+    int         x_size;         // allocated points
+    int         x_expsize;
     int         x_point;
     int         x_last_point;
     int         x_exp;
@@ -20,52 +21,64 @@ typedef struct _function{
 
 static t_class *function_class;
 
-static t_sample function_interpolate(t_function* x, t_sample f){
-    float point_m1 = x->x_points[x->x_point-1];
-    float point = x->x_points[x->x_point];
-    float dif = point - point_m1;
-    float dur = x->x_durations[x->x_point];
-    float dur_m1 = x->x_durations[x->x_point-1];
-    float frac = (f-dur_m1)/(dur-dur_m1);
-    float power = x->x_at_exp[x->x_point-1].a_w.w_float;
-    if(fabs(power) == 1) // linear
-        return(point_m1 + frac * dif);
-    else{
-        if(power >= 0){ // positive exponential
-            if(point_m1 < point) // ascending
-                return(point_m1 + pow(frac, power) * dif);
-            else // descending` (invert)
-                return(point_m1 + (1-pow(1-frac, power)) * dif);
-        }
-        else{
-            if(point_m1 < point) // ascending
-                return(point_m1 + (1-pow(1-frac, -power)) * dif);
-            else // descending` (invert)
-                return(point_m1 + pow(frac, -power) * dif);
-        }
+// room for 'n' points
+static void function_size(t_function *x, int n){
+    if(n > x->x_size){
+        x->x_points = resizebytes(x->x_points, x->x_size*sizeof(float), n*sizeof(float));
+        x->x_durations = resizebytes(x->x_durations, x->x_size*sizeof(float), n*sizeof(float));
+        x->x_scale = resizebytes(x->x_scale, x->x_size*sizeof(float), n*sizeof(float));
+        x->x_flip = resizebytes(x->x_flip, x->x_size*sizeof(int), n*sizeof(int));
+        x->x_size = n;
+    }
+}
+
+// exponents of new lines are linear
+static void function_expsize(t_function *x, int n){
+    if(n > x->x_expsize){
+        x->x_exps = resizebytes(x->x_exps, x->x_expsize*sizeof(float), n*sizeof(float));
+        for(int i = x->x_expsize; i < n; i++)
+            x->x_exps[i] = 1;
+        x->x_expsize = n;
+    }
+}
+
+// per line constants, so the perform routine has no divisions or branches
+// on the direction of the curve
+static void function_update(t_function *x){
+    function_expsize(x, x->x_last_point);
+    for(int i = 0; i < x->x_last_point; i++){
+        float dur = x->x_durations[i+1] - x->x_durations[i];
+        int up = x->x_points[i] < x->x_points[i+1]; // ascending
+        x->x_scale[i] = dur > 0 ? 1. / dur : 0;
+        x->x_flip[i] = x->x_exps[i] >= 0 ? !up : up; // descending inverts
     }
 }
-    
+
 static t_int *functionsig_perform(t_int *w){
 	t_function *x = (t_function *)(w[1]);
     t_sample *in = (t_float *)(w[2]);
     t_sample *out = (t_float *)(w[3]);
     int n = (int)(w[4]);
-    if(x->x_point > x->x_last_point)
-        x->x_point = x->x_last_point;
-    while(n--){
-        t_sample f = *in++;
-        t_sample val;
-        while((x->x_point > 0) && (f < x->x_durations[x->x_point-1]))
-            x->x_point--;
-        while((x->x_point <  x->x_last_point) && (x->x_durations[x->x_point] < f))
-            x->x_point++;
-        if(x->x_point == 0 || f >= x->x_durations[x->x_last_point])
-            val = x->x_points[x->x_point];
-        else
-            val = function_interpolate(x, f);
-        *out++ = val;
+    float *points = x->x_points, *dur = x->x_durations;
+    int last = x->x_last_point, point = x->x_point;
+    if(point > last)
+        point = last;
+    for(int i = 0; i < n; i++){
+        t_sample f = in[i];
+        while((point > 0) && (f < dur[point-1]))
+            point--;
+        while((point < last) && (dur[point] < f))
+            point++;
+        if(point == 0 || f >= dur[last])
+            out[i] = points[point];
+        else{
+            int k = point - 1;
+            float frac = (f - dur[k]) * x->x_scale[k];
+            out[i] = points[k] + (points[point] - points[k])
+                * segment_shape(frac, x->x_exps[k], x->x_flip[k]);
+        }
     }
+    x->x_point = point;
     return(w+5);
 }
 
@@ -77,12 +90,11 @@ static void function_init(t_function *x, int ac, t_atom* av){ // ???
     if(ac < 3)
         return;
     float *dur, *val, tdur = 0;
+    x->x_last_point = x->x_exp ? (int)ac/3 : (int)ac/2;
+    function_size(x, x->x_last_point + 1);
+    if(x->x_exp)
+        function_expsize(x, x->x_last_point + 1);
     x->x_durations[0] = 0;
-    x->x_last_point = x->x_exp ? (int)ac/3 : (int)ac/2; 
-    if(x->x_last_point > MAX_SIZE){
-        post("[function~]: too many lines, maximum is %d", MAX_SIZE);
-        return;
-    }
     dur = x->x_durations;
     val = x->x_points;
     *val = atom_getfloat(av++);
@@ -91,10 +103,10 @@ static void function_init(t_function *x, int ac, t_atom* av){ // ???
     dur++;
     if(x->x_exp){
         int i = 0;
-        while(ac > 0){
+        while(ac > 0 && i < x->x_last_point){ // a trailing duration and exponent are ignored
             *dur++ = (tdur += atom_getfloat(av++));
             ac--;
-            SETFLOAT(x->x_at_exp+i, (av++)->a_w.w_float);
+            x->x_exps[i] = ac > 0 ? atom_getfloat(av++) : 1;
             i++;
             ac--;
             *++val = ac > 0 ? atom_getfloat(av++): 0;
@@ -113,20 +125,25 @@ static void function_init(t_function *x, int ac, t_atom* av){ // ???
 
 static void function_expi(t_function *x, t_floatarg f1, t_floatarg f2){
     int i = f1 < 0 ? 0 : (int)f1;
-    SETFLOAT(x->x_at_exp+i, f2);
+    function_expsize(x, i + 1);
+    x->x_exps[i] = f2;
+    function_update(x);
 }
 
 static void function_expl(t_function *x, t_symbol *s, int ac, t_atom *av){
     if(!ac)
         return;
     s = NULL;
+    function_expsize(x, ac);
     for(int i = 0; i < ac; i++)
-        SETFLOAT(x->x_at_exp+i, (av+i)->a_w.w_float);
+        x->x_exps[i] = atom_getfloat(av+i);
+    function_update(x);
 }
 
 static void function_norm_dur(t_function* x){ // normalize duration
     for(int i = 1; i <= x->x_last_point; i++)
         x->x_durations[i] /= x->x_durations[x->x_last_point];
+    function_update(x);
 }
 
 static void function_exp(t_function *x, t_symbol *s, int ac, t_atom *av){
@@ -145,15 +162,23 @@ static void function_list(t_function *x,t_symbol* s, int ac,t_atom* av){
     function_norm_dur(x);
 }
 
+static void function_free(t_function *x){
+    freebytes(x->x_points, x->x_size*sizeof(float));
+    freebytes(x->x_durations, x->x_size*sizeof(float));
+    freebytes(x->x_scale, x->x_size*sizeof(float));
+    freebytes(x->x_flip, x->x_size*sizeof(int));
+    freebytes(x->x_exps, x->x_expsize*sizeof(float));
+}
+
 static void *function_new(t_symbol *s,int ac,t_atom* av){
     s = NULL; // avoid warning
     t_function *x = (t_function *)pd_new(function_class);
-    for(int i = 0; i < MAX_SIZE; i++) // set exponential list to linear
-        SETFLOAT(x->x_at_exp+i, 1);
     x->x_f = 0;
     x->x_exp = 0;
-    x->x_points = getbytes(MAX_SIZE*sizeof(float));
-    x->x_durations = getbytes(MAX_SIZE*sizeof(float));
+    x->x_size = x->x_expsize = 0;
+    x->x_points = x->x_durations = x->x_scale = x->x_exps = NULL;
+    x->x_flip = NULL;
+    function_size(x, 1);
     if(ac){
         if(av->a_type == A_SYMBOL){
             if(atom_getsymbolarg(0, ac, av) == gensym("-exp")){
@@ -182,12 +207,13 @@ static void *function_new(t_symbol *s,int ac,t_atom* av){
     return(x);
 errstate:
     pd_error(x, "[function~]: improper args");
+    function_free(x);
     return(NULL);
 }
 
 void function_tilde_setup(void){
-    function_class = class_new(gensym("function~"), (t_newmethod)function_new, 0,
-    	sizeof(t_function), 0, A_GIMME, 0);
+    function_class = class_new(gensym("function~"), (t_newmethod)function_new,
+        (t_method)function_free, sizeof(t_function), 0, A_GIMME, 0);
     CLASS_MAINSIGNALIN(function_class, t_function, x_f);
     class_addmethod(function_class, (t_method)functionsig_dsp, gensym("dsp"), 0);
     class_addmethod(function_class, (t_method)function_exp, gensym("exp"), A_GIMME, 0);
@@ -1,60 +1,23 @@
 // Porres 2017
 
 #include "m_pd.h"
-#include <math.h>
-
-#define PI 3.14159265358979323846
-#define HALF_LOG2 log(2)/2
+#include "rbj.h"
 
 typedef struct _highpass{
     t_object    x_obj;
     t_inlet    *x_inlet_freq; // x_inlet_freq
     t_inlet    *x_inlet_q;
     t_outlet   *x_out;
-    t_float     x_nyq;
     int         x_bypass;
-    int         x_bw;
+    t_rbj       x_rbj;
     double      x_xnm1;
     double      x_xnm2;
     double      x_ynm1;
     double      x_ynm2;
-    double      x_f;
-    double      x_reson;
-    double      x_a0;
-    double      x_a1;
-    double      x_a2;
-    double      x_b1;
-    double      x_b2;
 }t_highpass;
 
 static t_class *highpass_class;
 
-static void update_coeffs(t_highpass *x, double f, double reson){
-    x->x_f = f;
-    x->x_reson = reson;
-    double q;
-    double omega = f * PI/x->x_nyq;
-    if(x->x_bw){ // reson is bw in octaves
-         if(reson < 0.000001)
-             reson = 0.000001;
-         q = 1 / (2 * sinh(HALF_LOG2 * reson * omega/sin(omega)));
-    }
-    else
-        q = reson;
-    if(q < 0.000001) // force bypass
-        x->x_a0 = 1, x->x_a2 = x->x_b1 = x->x_b2 = 0;
-    else{
-        double alphaQ = sin(omega) / (2*q);
-        double cos_w = cos(omega);
-        double b0 = alphaQ + 1;
-        x->x_a0 = (1 + cos_w) / (2 * b0);
-        x->x_a1 = -(1 + cos_w) / b0;
-        x->x_a2 = x->x_a0;
-        x->x_b1 = 2*cos_w / b0;
-        x->x_b2 = (alphaQ - 1) / b0;
-    }
-}
-
 static t_int *highpass_perform(t_int *w){
     t_highpass *x = (t_highpass *)(w[1]);
     int nblock = (int)(w[2]);
@@ -66,7 +29,9 @@ static t_int *highpass_perform(t_int *w){
     double xnm2 = x->x_xnm2;
     double ynm1 = x->x_ynm1;
     double ynm2 = x->x_ynm2;
-    t_float nyq = x->x_nyq;
+    t_rbj *r = &x->x_rbj;
+    t_rbj_coeffs *c = &r->r_c;
+    double nyq = r->r_nyq;
     while(nblock--){
         double xn = *in1++, f = *in2++, reson = *in3++, yn;
         if(f < 0.000001)
@@ -76,9 +41,8 @@ static t_int *highpass_perform(t_int *w){
         if(x->x_bypass)
             *out++ = xn;
         else{
-            if(f != x->x_f || reson != x->x_reson)
-                update_coeffs(x, (double)f, (double)reson);
-            yn = x->x_a0 * xn + x->x_a1 * xnm1 + x->x_a2 * xnm2 + x->x_b1 * ynm1 + x->x_b2 * ynm2;
+            rbj_tick(r, f, reson, 0);
+            yn = c->a0 * xn + c->a1 * xnm1 + c->a2 * xnm2 + c->b1 * ynm1 + c->b2 * ynm2;
             *out++ = yn;
             xnm2 = xnm1;
             xnm1 = xn;
@@ -94,11 +58,7 @@ static t_int *highpass_perform(t_int *w){
 }
 
 static void highpass_dsp(t_highpass *x, t_signal **sp){
-    t_float nyq = sp[0]->s_sr / 2;
-    if(nyq != x->x_nyq){
-        x->x_nyq = nyq;
-        update_coeffs(x, x->x_f, x->x_reson);
-    }
+    rbj_nyq(&x->x_rbj, sp[0]->s_sr / 2);
     dsp_add(highpass_perform, 6, x, sp[0]->s_n, sp[0]->s_vec,
             sp[1]->s_vec, sp[2]->s_vec, sp[3]->s_vec);
 }
@@ -112,13 +72,19 @@ static void highpass_bypass(t_highpass *x, t_floatarg f){
 }
 
 static void highpass_bw(t_highpass *x){
-    x->x_bw = 1;
-    update_coeffs(x, x->x_f, x->x_reson);
+    rbj_bw(&x->x_rbj, 1);
 }
 
 static void highpass_q(t_highpass *x){
-    x->x_bw = 0;
-    update_coeffs(x, x->x_f, x->x_reson);
+    rbj_bw(&x->x_rbj, 0);
+}
+
+static void highpass_rate(t_highpass *x, t_floatarg f){
+    rbj_period(&x->x_rbj, (int)f);
+}
+
+static void highpass_fast(t_highpass *x, t_floatarg f){
+    rbj_fast(&x->x_rbj, (int)(f != 0));
 }
 
 static void *highpass_new(t_symbol *s, int argc, t_atom *argv){
@@ -155,9 +121,8 @@ static void *highpass_new(t_symbol *s, int argc, t_atom *argv){
         else
             goto errstate;
     };
-    x->x_bw = bw;
-    x->x_nyq = sys_getsr()/2;
-    update_coeffs(x, (double)freq, (double)reson);
+    rbj_init(&x->x_rbj, RBJ_HIGHPASS, bw, sys_getsr()/2);
+    rbj_set(&x->x_rbj, freq, reson, 0);
     x->x_inlet_freq = inlet_new((t_object *)x, (t_pd *)x, &s_signal, &s_signal);
     pd_float((t_pd *)x->x_inlet_freq, freq);
     x->x_inlet_q = inlet_new((t_object *)x, (t_pd *)x, &s_signal, &s_signal);
@@ -176,6 +141,8 @@ void highpass_tilde_setup(void){
     class_addmethod(highpass_class, nullfn, gensym("signal"), 0);
     class_addmethod(highpass_class, (t_method)highpass_clear, gensym("clear"), 0);
     class_addmethod(highpass_class, (t_method)highpass_bypass, gensym("bypass"), A_DEFFLOAT, 0);
+    class_addmethod(highpass_class, (t_method)highpass_rate, gensym("rate"), A_FLOAT, 0);
+    class_addmethod(highpass_class, (t_method)highpass_fast, gensym("fast"), A_FLOAT, 0);
     class_addmethod(highpass_class, (t_method)highpass_bw, gensym("bw"), 0);
     class_addmethod(highpass_class, (t_method)highpass_q, gensym("q"), 0);
 }
@@ -1,9 +1,7 @@
 // Porres 2017
 
 #include "m_pd.h"
-#include <math.h>
-
-#define PI 3.14159265358979323846
+#include "rbj.h"
 
 typedef struct _highshelf{
     t_object    x_obj;
@@ -12,40 +10,16 @@ typedef struct _highshelf{
     t_inlet    *x_inlet_q;
     t_inlet    *x_inlet_amp;
     t_outlet   *x_out;
-    t_float     x_nyq;
     int         x_bypass;
+    t_rbj       x_rbj;
     double      x_xnm1;
     double      x_xnm2;
     double      x_ynm1;
     double      x_ynm2;
-    double      x_f;
-    double      x_slope;
-    double      x_db;
-    double      x_a0;
-    double      x_a1;
-    double      x_a2;
-    double      x_b1;
-    double      x_b2;
 }t_highshelf;
 
 static t_class *highshelf_class;
 
-static void update_coeffs(t_highshelf *x, double f, double slope, double db){
-    x->x_f = f;
-    x->x_slope = slope;
-    x->x_db = db;
-    double amp = pow(10, db / 40);
-    double omega = f * PI/x->x_nyq;
-    double alphaS = sin(omega) * sqrt((amp*amp + 1) * (1/slope - 1) + 2*amp);
-    double cos_w = cos(omega);
-    double b0 = (amp+1) - (amp-1)*cos_w + alphaS;
-    x->x_a0 = amp*(amp+1 + (amp-1)*cos_w + alphaS) / b0;
-    x->x_a1 = -2*amp*(amp-1 + (amp+1)*cos_w) / b0;
-    x->x_a2 = amp*(amp+1 + (amp-1)*cos_w - alphaS) / b0;
-    x->x_b1 = -2*(amp-1 - (amp+1)*cos_w) / b0;
-    x->x_b2 = -(amp+1 - (amp-1)*cos_w - alphaS) / b0;
-}
-
 static t_int *highshelf_perform(t_int *w){
     t_highshelf *x = (t_highshelf *)(w[1]);
     int nblock = (int)(w[2]);
@@ -58,7 +32,9 @@ static t_int *highshelf_perform(t_int *w){
     double xnm2 = x->x_xnm2;
     double ynm1 = x->x_ynm1;
     double ynm2 = x->x_ynm2;
-    t_float nyq = x->x_nyq;
+    t_rbj *r = &x->x_rbj;
+    t_rbj_coeffs *c = &r->r_c;
+    double nyq = r->r_nyq;
     while(nblock--){
         double xn = *in1++, f = *in2++, slope = *in3++, db = *in4++, yn;
         if(x->x_bypass)
@@ -72,9 +48,8 @@ static t_int *highshelf_perform(t_int *w){
                 slope = 0.000001;
             if(slope > 1)
                 slope = 1;
-            if(f != x->x_f || slope != x->x_slope || db != x->x_db)
-                update_coeffs(x, f, slope, db);
-            yn = x->x_a0 * xn + x->x_a1 * xnm1 + x->x_a2 * xnm2 + x->x_b1 * ynm1 + x->x_b2 * ynm2;
+            rbj_tick(r, f, slope, db);
+            yn = c->a0 * xn + c->a1 * xnm1 + c->a2 * xnm2 + c->b1 * ynm1 + c->b2 * ynm2;
             *out++ = yn;
             xnm2 = xnm1;
             xnm1 = xn;
@@ -90,11 +65,7 @@ static t_int *highshelf_perform(t_int *w){
 }
 
 static void highshelf_dsp(t_highshelf *x, t_signal **sp){
-    t_float nyq = sp[0]->s_sr / 2;
-    if(nyq != x->x_nyq){
-        x->x_nyq = nyq;
-        update_coeffs(x, x->x_f, x->x_slope, x->x_db);
-    }
+    rbj_nyq(&x->x_rbj, sp[0]->s_sr / 2);
     dsp_add(highshelf_perform, 7, x, sp[0]->s_n, sp[0]->s_vec,
         sp[1]->s_vec, sp[2]->s_vec, sp[3]->s_vec, sp[4]->s_vec);
 }
@@ -107,6 +78,14 @@ static void highshelf_bypass(t_highshelf *x, t_floatarg f){
     x->x_bypass = (int)(f != 0);
 }
 
+static void highshelf_rate(t_highshelf *x, t_floatarg f){
+    rbj_period(&x->x_rbj, (int)f);
+}
+
+static void highshelf_fast(t_highshelf *x, t_floatarg f){
+    rbj_fast(&x->x_rbj, (int)(f != 0));
+}
+
 static void *highshelf_new(t_symbol *s, int argc, t_atom *argv){
     s = NULL;
     t_highshelf *x = (t_highshelf *)pd_new(highshelf_class);
@@ -133,8 +112,8 @@ static void *highshelf_new(t_symbol *s, int argc, t_atom *argv){
         else if(argv -> a_type == A_SYMBOL)
             goto errstate;
     };
-    x->x_nyq = sys_getsr()/2;
-    update_coeffs(x, (double)freq, (double)slope, (double)db);
+    rbj_init(&x->x_rbj, RBJ_HIGHSHELF, 0, sys_getsr()/2);
+    rbj_set(&x->x_rbj, freq, slope, db);
     x->x_inlet_freq = inlet_new((t_object *)x, (t_pd *)x, &s_signal, &s_signal);
     pd_float((t_pd *)x->x_inlet_freq, freq);
     x->x_inlet_q = inlet_new((t_object *)x, (t_pd *)x, &s_signal, &s_signal);
@@ -155,4 +134,6 @@ void highshelf_tilde_setup(void){
     class_addmethod(highshelf_class, nullfn, gensym("signal"), 0);
     class_addmethod(highshelf_class, (t_method)highshelf_clear, gensym("clear"), 0);
     class_addmethod(highshelf_class, (t_method)highshelf_bypass, gensym("bypass"), A_DEFFLOAT, 0);
+    class_addmethod(highshelf_class, (t_method)highshelf_rate, gensym("rate"), A_FLOAT, 0);
+    class_addmethod(highshelf_class, (t_method)highshelf_fast, gensym("fast"), A_FLOAT, 0);
 }
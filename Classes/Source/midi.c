@@ -8,6 +8,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 #include "m_pd.h"
 #include "elsefile.h"
 #include "mifi.h"
@@ -15,6 +16,7 @@
 #define PANIC_VOID                  0xFF
 #define MIDI_INISEQSIZE             256    // LATER rethink
 #define MIDI_INITEMPOMAPSIZE        128    // LATER rethink
+#define MIDI_INIMETERMAPSIZE        16
 #define MIDI_META                   255    // META marker
 #define MIDI_TICKSPERSEC            48
 #define MIDI_MINTICKDELAY           1.     // LATER rethink
@@ -23,6 +25,12 @@
 #define MIDI_TEMPOEPSILON          .0001   // if inside: pause
 #define MIDI_ISRUNNING(x) ((x)->x_prevtime > (double).0001)
 #define MIDI_ISPAUSED(x) ((x)->x_prevtime <= (double).0001)
+#define MIDI_DEFTEMPO       ((double)120960)  // score ticks per second at 120 bpm
+#define MIDI_BEATTICKS      ((double)60480)   // score ticks per quarter note
+#define MIDI_BARTICKS       ((double)241920)  // score ticks per 4/4 bar
+#define MIDI_CHASESTEP              1024   // events between chase snapshots...
+#define MIDI_MAXCHASE               256    // ...doubled to keep at most these
+#define MIDI_UNSET                  0xFF   // chased value never sent
 
 enum{MIDI_IDLEMODE, MIDI_RECMODE, MIDI_PLAYMODE, MIDI_SLAVEMODE};
 
@@ -36,6 +44,20 @@ typedef struct _miditempo{
     double  t_sr;         /* score ticks per second */
 }t_miditempo;
 
+typedef struct _midimeter{
+    double  m_scoretime;  // score ticks from start
+    double  m_barspan;    // score ticks per bar
+}t_midimeter;
+
+// the state of all channels at some point of the sequence, for seeking
+typedef struct _midichase{
+    unsigned char  c_ctl[16][128];   // controller values
+    unsigned char  c_notes[16][128]; // velocities of held notes, 0 if off
+    unsigned char  c_program[16];
+    unsigned char  c_pressure[16];
+    unsigned char  c_bend[16][2];
+}t_midichase;
+
 typedef struct _midi{
     t_object       x_ob;
     t_canvas      *x_canvas;
@@ -65,9 +87,27 @@ typedef struct _midi{
     int            x_ntempi;        /* as used */
     t_miditempo    *x_tempomap;
     t_miditempo     x_tempomapini[MIDI_INITEMPOMAPSIZE];
+    int            x_meterreadhead;
+    int            x_metermapsize;  /* as allocated */
+    int            x_nmeters;       /* as used */
+    t_midimeter    *x_metermap;
+    t_midimeter     x_metermapini[MIDI_INIMETERMAPSIZE];
+    double         x_deftempo;      // score ticks per second before any tempo change
+// seeking
+    int            x_indexed;
+    double        *x_times;         // ms from the start to each event
+    int            x_ntimes;        // as allocated
+    t_midichase   *x_chase;         // the state before every 'x_chasestep' events
+    int            x_nchase;        // as allocated
+    int            x_chasestep;
     t_clock       *x_clock;
     t_clock       *x_slaveclock;
     t_outlet      *x_bangout;
+// block mode
+    int            x_block;
+    double         x_lead;          // ms from the clock to the next event
+    t_atom        *x_blockvec;      // offset and byte pairs of one block
+    int            x_blocksize;     // as allocated
 // panic
     unsigned char  x_note_status;
     unsigned char  x_channel;
@@ -173,7 +213,9 @@ int inisize, void *bufini, size_t typesize){
 }
 
 static void midi_clear(t_midi *x){
-    x->x_nevents = x->x_ntempi = 0;
+    x->x_nevents = x->x_ntempi = x->x_nmeters = 0;
+    x->x_deftempo = MIDI_DEFTEMPO;
+    x->x_indexed = 0;
 }
 
 static int midi_dogrowing(t_midi *x, int nevents, int ntempi){
@@ -216,6 +258,7 @@ static void midi_complete(t_midi *x){
         if(x->x_evelength < 4)
             ep->e_bytes[x->x_evelength] = MIDI_META;
         x->x_nevents++;
+        x->x_indexed = 0;
         if(x->x_nevents >= x->x_midisize){
             int nexisting = x->x_midisize;
         // store-ahead scheme, LATER consider using x_currevent
@@ -330,11 +373,14 @@ static void midi_startplayback(t_midi *x, int modechanged){
         else{  // CHECKED timescale change
             if(MIDI_ISRUNNING(x))
                 x->x_clockdelay -= clock_gettimesince(x->x_prevtime);
+            // in block mode the next event is 'x_lead' past the clock
+            x->x_clockdelay += x->x_lead;
             x->x_clockdelay *= x->x_newtimescale / x->x_timescale;
         }
         if(x->x_clockdelay < 0.)
             x->x_clockdelay = 0.;
         x->x_timescale = x->x_newtimescale;
+        x->x_lead = 0.;
         clock_delay(x->x_clock, x->x_clockdelay);
         x->x_prevtime = clock_getlogicaltime();
     }
@@ -533,8 +579,73 @@ static void midi_dump(t_midi *x){
     outlet_bang(x->x_bangout);
 }
 
+/* Block mode: the clock wakes up once per scheduler block that has events
+   in it, and all events due before the end of that block go out as one list
+   of sample offset and byte pairs, offsets from the start of the block. The
+   clock is set to the start of the block of the next event and 'x_lead' is
+   the rest of the way to it. */
+static void midi_blockadd(t_midi *x, int *n, t_float offset, t_float byte){
+    if(*n + 2 > x->x_blocksize){
+        int newsize = x->x_blocksize ? 2 * x->x_blocksize : 64;
+        x->x_blockvec = resizebytes(x->x_blockvec,
+            x->x_blocksize * sizeof(t_atom), newsize * sizeof(t_atom));
+        x->x_blocksize = newsize;
+    }
+    SETFLOAT(&x->x_blockvec[*n], offset);
+    SETFLOAT(&x->x_blockvec[*n + 1], byte);
+    *n += 2;
+    panic_input(x, byte);
+}
+
+static void midi_blocktick(t_midi *x){
+    int nblock = sys_getblksize();
+    double blockms = nblock * 1000. / sys_getsr();
+    double now = clock_gettimesince(0.);
+    // the clock is set at the start of blocks, so rounding down must not
+    // fall into the previous one
+    double start = floor(now / blockms + 1e-6) * blockms, end = start + blockms;
+    double due = now + x->x_lead, fire;
+    int n = 0;
+    while(due < end){
+        t_midievent *ep = &x->x_sequence[x->x_playhead++];
+        int offset = (int)((due - start) * sys_getsr() / 1000.);
+        if(offset >= nblock)
+            offset = nblock - 1;
+        midi_blockadd(x, &n, offset, ep->e_bytes[0]);
+        for(int i = 1; i < 4 && ep->e_bytes[i] != MIDI_META; i++)
+            midi_blockadd(x, &n, offset, ep->e_bytes[i]);
+        if(x->x_playhead >= x->x_nevents)
+            break;
+        x->x_nextscoretime += ep[1].e_delta;
+        due += ep[1].e_delta * x->x_timescale;
+    }
+    if(n)
+        outlet_list(((t_object *)x)->ob_outlet, &s_list, n, x->x_blockvec);
+    if(x->x_mode != MIDI_PLAYMODE)
+        return;  // protecting against outlet -> 'stop' etc.
+    if(x->x_playhead < x->x_nevents){
+        fire = floor(due / blockms + 1e-6) * blockms;
+        if(fire < end)
+            fire = end;
+        x->x_lead = due > fire ? due - fire : 0.;
+        x->x_clockdelay = fire - now;
+        clock_delay(x->x_clock, x->x_clockdelay);
+        x->x_prevtime = clock_getlogicaltime();
+    }
+    else{
+        midi_setmode(x, MIDI_IDLEMODE);
+        outlet_bang(x->x_bangout);
+        if(x->x_loop)
+            midi_float(x, 1);
+    }
+}
+
 static void midi_clocktick(t_midi *x){
     t_float output;
+    if(x->x_block && x->x_mode == MIDI_PLAYMODE){
+        midi_blocktick(x);
+        return;
+    }
     if(x->x_mode == MIDI_PLAYMODE || x->x_mode == MIDI_SLAVEMODE){
         t_midievent *ep = &x->x_sequence[x->x_playhead++];
         unsigned char *bp = ep->e_bytes;
@@ -584,37 +695,6 @@ static void midi_clocktick(t_midi *x){
     }
 }
 
-/*static void midi_goto(t_midi *x, t_floatarg f){ // takes time in seconds
-     if(x->x_nevents){
-         t_midievent *ev;
-         int ndx, nevents = x->x_nevents;
-         double ms = (double)f * 1000., sum;
-         if(ms <= MIDI_TICKEPSILON)
-             ms = 0.;
-         if(x->x_mode != MIDI_PLAYMODE){
-             midi_settimescale(x, x->x_timescale);
-             midi_setmode(x, MIDI_PLAYMODE);
-             // clock_delay() has been called in setmode, LATER avoid
-             clock_unset(x->x_clock);
-             x->x_prevtime = 0.;
-         }
-         for(ndx = 0, ev = x->x_sequence, sum = MIDI_TICKEPSILON; ndx < nevents; ndx++, ev++){
-             if((sum += ev->e_delta) >= ms){
-                 x->x_playhead = ndx;
-                 x->x_nextscoretime = sum;
-                 x->x_clockdelay = sum - MIDI_TICKEPSILON - ms;
-                 if(x->x_clockdelay < 0.)
-                     x->x_clockdelay = 0.;
-                 if(MIDI_ISRUNNING(x)){
-                     clock_delay(x->x_clock, x->x_clockdelay);
-                     x->x_prevtime = clock_getlogicaltime();
-                 }
-                 break;
-             }
-         }
-     }
- }*/
- 
  static void midi_speed(t_midi *x, t_floatarg f){
      if(f > MIDI_TEMPOEPSILON){
          midi_settimescale(x, 100./f);
@@ -622,6 +702,9 @@ static void midi_clocktick(t_midi *x){
              clock_unset(x->x_clock);
              x->x_nextscoretime = 0.;
              x->x_clockdelay -= clock_gettimesince(x->x_prevtime);
+             // in block mode the next event is 'x_lead' past the clock
+             x->x_clockdelay += x->x_lead;
+             x->x_lead = 0.;
              x->x_clockdelay *= x->x_newtimescale / x->x_timescale;
              if(x->x_clockdelay < 0.)
                  x->x_clockdelay = 0.;
@@ -633,19 +716,18 @@ static void midi_clocktick(t_midi *x){
      // FIXME else pause, LATER reverse playback if(f < -MIDI_TEMPOEPSILON)
  }
 
-static int midi_eventcomparehook(const void *e1, const void *e2){
-    return(((t_midievent *)e1)->e_delta > ((t_midievent *)e2)->e_delta ? 1 : -1);
-}
-
-static int midi_tempocomparehook(const void *t1, const void *t2){
-    return(((t_miditempo *)t1)->t_scoretime > ((t_miditempo *)t2)->t_scoretime ? 1 : -1);
-}
-
 static int midi_mrhook(t_mifiread *mr, void *hookdata, int evtype){
     t_midi *x = (t_midi *)hookdata;
     double scoretime = mifiread_getscoretime(mr);
     if((evtype >= 0x80 && evtype < 0xf0) || (evtype == MIFIMETA_EOT)){
-        if(x->x_eventreadhead < x->x_nevents){
+        if(x->x_eventreadhead == x->x_midisize){
+            int nrequested = x->x_midisize + 1, nexisting = x->x_eventreadhead;
+            x->x_sequence = grow_withdata(&nrequested, &nexisting, &x->x_midisize,
+                x->x_sequence, MIDI_INISEQSIZE, x->x_midiini, sizeof(*x->x_sequence));
+            if(nrequested <= x->x_eventreadhead)
+                return(0);
+        }
+        {
             t_midievent *sev = &x->x_sequence[x->x_eventreadhead++];
             int status = mifiread_getstatus(mr);
             sev->e_delta = scoretime;
@@ -658,80 +740,399 @@ static int midi_mrhook(t_mifiread *mr, void *hookdata, int evtype){
                 sev->e_bytes[3] = MIDI_META;
             }
         }
-        else if(x->x_eventreadhead == x->x_nevents){
-            pd_error(x, "bug [midi]: midi_mrhook 1");
-            x->x_eventreadhead++;
-        }
     }
     else if(evtype == MIFIMETA_TEMPO){
-        if(x->x_temporeadhead < x->x_ntempi){
-            t_miditempo *stm = &x->x_tempomap[x->x_temporeadhead++];
-            stm->t_scoretime = scoretime;
-            stm->t_sr = mifiread_gettempo(mr);
+        t_miditempo *stm;
+        if(x->x_temporeadhead == x->x_tempomapsize){
+            int nrequested = x->x_tempomapsize + 1, nexisting = x->x_temporeadhead;
+            x->x_tempomap = grow_withdata(&nrequested, &nexisting, &x->x_tempomapsize,
+                x->x_tempomap, MIDI_INITEMPOMAPSIZE, x->x_tempomapini, sizeof(*x->x_tempomap));
+            if(nrequested <= x->x_temporeadhead)
+                return(0);
         }
-        else if(x->x_temporeadhead == x->x_ntempi){
-            pd_error(x, "bug [midi]: midi_mrhook 2");
-            x->x_temporeadhead++;
+        stm = &x->x_tempomap[x->x_temporeadhead++];
+        stm->t_scoretime = scoretime;
+        stm->t_sr = mifiread_gettempo(mr);
+    }
+    else if(evtype == MIFIMETA_TIMESIG){
+        t_midimeter *smm;
+        if(x->x_meterreadhead == x->x_metermapsize){
+            int nrequested = x->x_metermapsize + 1, nexisting = x->x_meterreadhead;
+            x->x_metermap = grow_withdata(&nrequested, &nexisting, &x->x_metermapsize,
+                x->x_metermap, MIDI_INIMETERMAPSIZE, x->x_metermapini, sizeof(*x->x_metermap));
+            if(nrequested <= x->x_meterreadhead)
+                return(0);
         }
+        smm = &x->x_metermap[x->x_meterreadhead++];
+        smm->m_scoretime = scoretime;
+        smm->m_barspan = mifiread_getbarspan(mr);
     }
     return(1);
 }
 
-/* apply tempo and fold */
-static void midi_foldtime(t_midi *x, double deftempo){
-    t_midievent *sev;
-    t_miditempo *stm = x->x_tempomap;
-    double coef = 1000. / deftempo;
-    int ex, tx = 0;
-    double prevscoretime = 0.;
-    while(tx < x->x_ntempi && stm->t_scoretime < MIDI_TICKEPSILON)
-    tx++, coef = 1000. / stm++->t_sr;
-    for(ex = 0, sev = x->x_sequence; ex < x->x_nevents; ex++, sev++){
-        double clockdelta = 0.;
-        while(tx < x->x_ntempi && stm->t_scoretime <= sev->e_delta){
-            clockdelta += (stm->t_scoretime - prevscoretime) * coef;
-            prevscoretime = stm->t_scoretime;
-            tx++;
-            coef = 1000. / stm++->t_sr;
+// tempo and meter changes in score order, a change keeps its place among
+// those at the same time (an insertion sort, as the maps are mostly sorted)
+static void midi_sortmaps(t_midi *x){
+    for(int i = 1; i < x->x_ntempi; i++){
+        t_miditempo tm = x->x_tempomap[i];
+        int j = i;
+        for(; j > 0 && x->x_tempomap[j-1].t_scoretime > tm.t_scoretime; j--)
+            x->x_tempomap[j] = x->x_tempomap[j-1];
+        x->x_tempomap[j] = tm;
+    }
+    for(int i = 1; i < x->x_nmeters; i++){
+        t_midimeter mm = x->x_metermap[i];
+        int j = i;
+        for(; j > 0 && x->x_metermap[j-1].m_scoretime > mm.m_scoretime; j--)
+            x->x_metermap[j] = x->x_metermap[j-1];
+        x->x_metermap[j] = mm;
+    }
+}
+
+// state of the tempo map while folding score times into clock deltas
+typedef struct _midifold{
+    t_miditempo  *f_tempo;
+    int           f_tx;
+    double        f_coef;
+    double        f_prevscoretime;
+}t_midifold;
+
+static void midi_foldstart(t_midi *x, t_midifold *fd, double deftempo){
+    fd->f_tempo = x->x_tempomap;
+    fd->f_tx = 0;
+    fd->f_coef = 1000. / deftempo;
+    fd->f_prevscoretime = 0.;
+    while(fd->f_tx < x->x_ntempi && fd->f_tempo->t_scoretime < MIDI_TICKEPSILON)
+        fd->f_tx++, fd->f_coef = 1000. / fd->f_tempo++->t_sr;
+}
+
+/* apply tempo and fold: the clock delta of an event at 'scoretime' from
+   the previous one */
+static double midi_fold(t_midi *x, t_midifold *fd, double scoretime){
+    double clockdelta = 0.;
+    while(fd->f_tx < x->x_ntempi && fd->f_tempo->t_scoretime <= scoretime){
+        clockdelta += (fd->f_tempo->t_scoretime - fd->f_prevscoretime) * fd->f_coef;
+        fd->f_prevscoretime = fd->f_tempo->t_scoretime;
+        fd->f_tx++;
+        fd->f_coef = 1000. / fd->f_tempo++->t_sr;
+    }
+    clockdelta += (scoretime - fd->f_prevscoretime) * fd->f_coef;
+    fd->f_prevscoretime = scoretime;
+    return(clockdelta);
+}
+
+// a track being merged: its next event and end in the unmerged sequence
+typedef struct _miditrack{
+    int  t_next;
+    int  t_end;
+    int  t_ndx;
+}t_miditrack;
+
+// ties go to the earlier track, so events at the same time keep the order
+// of the file
+static int midi_trackbefore(t_midievent *ev, t_miditrack *t1, t_miditrack *t2){
+    double d1 = ev[t1->t_next].e_delta, d2 = ev[t2->t_next].e_delta;
+    return(d1 < d2 || (d1 == d2 && t1->t_ndx < t2->t_ndx));
+}
+
+static void midi_heapdown(t_midievent *ev, t_miditrack *heap, int nheap, int i){
+    t_miditrack tr = heap[i];
+    for(int child; (child = 2*i + 1) < nheap; i = child){
+        if(child + 1 < nheap && midi_trackbefore(ev, &heap[child+1], &heap[child]))
+            child++;
+        if(!midi_trackbefore(ev, &heap[child], &tr))
+            break;
+        heap[i] = heap[child];
+    }
+    heap[i] = tr;
+}
+
+/* The events of each track are in score order already (the tracks start
+   at 'starts', followed by the end of the sequence): merge them with a
+   heap of the tracks' next events and fold the times on the way. */
+static int midi_mergetracks(t_midi *x, int *starts, int ntracks, double deftempo){
+    int n = x->x_nevents, nheap = 0;
+    t_midievent *ev = getbytes(n * sizeof(*ev));
+    t_miditrack *heap = getbytes(ntracks * sizeof(*heap));
+    t_midifold fd;
+    if(!ev || !heap){
+        if(ev)
+            freebytes(ev, n * sizeof(*ev));
+        if(heap)
+            freebytes(heap, ntracks * sizeof(*heap));
+        return(0);
+    }
+    memcpy(ev, x->x_sequence, n * sizeof(*ev));
+    for(int t = 0; t < ntracks; t++){
+        if(starts[t] < starts[t+1]){
+            heap[nheap].t_next = starts[t];
+            heap[nheap].t_end = starts[t+1];
+            heap[nheap++].t_ndx = t;
         }
-        clockdelta += (sev->e_delta - prevscoretime) * coef;
-        prevscoretime = sev->e_delta;
-        sev->e_delta = clockdelta;
     }
+    for(int i = nheap / 2 - 1; i >= 0; i--)
+        midi_heapdown(ev, heap, nheap, i);
+    midi_foldstart(x, &fd, deftempo);
+    for(int i = 0; i < n; i++){
+        t_midievent *sev = &x->x_sequence[i];
+        *sev = ev[heap->t_next];
+        sev->e_delta = midi_fold(x, &fd, sev->e_delta);
+        if(++heap->t_next == heap->t_end)
+            heap[0] = heap[--nheap];
+        midi_heapdown(ev, heap, nheap, 0);
+    }
+    freebytes(ev, n * sizeof(*ev));
+    freebytes(heap, ntracks * sizeof(*heap));
+    return(1);
 }
 
 static int midi_mfread(t_midi *x, char *path){
-    int result = 0;
+    int result = 0, evtype, ntracks = 0, *starts = 0, nstarts = 0;
     t_mifiread *mr = mifiread_new((t_pd *)x);
-    if(!mifiread_open(mr, path, "", 0))
+    midi_clear(x);
+    if(!mifiread_openstream(mr, path, "", 0))
         goto mfreadfailed;
-    if(!midi_dogrowing(x, mifiread_getnevents(mr), mifiread_getntempi(mr)))
+    nstarts = mifiread_gethdtracks(mr) + 1;
+    if(!(starts = getbytes(nstarts * sizeof(*starts))))
         goto mfreadfailed;
+    // a single pass, the arrays grow as the events come
     x->x_eventreadhead = 0;
     x->x_temporeadhead = 0;
-    if(mifiread_doit(mr, midi_mrhook, x) != MIFIREAD_EOF)
+    x->x_meterreadhead = 0;
+    while((evtype = mifiread_next(mr)) >= 0){
+        if((MIFI_ISCHANNEL(evtype) || evtype == MIFIMETA_EOT)
+        && (!ntracks || mifiread_gettrackndx(mr) != ntracks - 1))
+            starts[ntracks++] = x->x_eventreadhead; // first event of a track
+        if(!midi_mrhook(mr, x, evtype))
+            goto mfreadfailed;
+    }
+    if(evtype != MIFIREAD_EOF)
         goto mfreadfailed;
-    if(x->x_eventreadhead < x->x_nevents){
-        pd_error(x, "bug [midi]: midi_mfread 1");
-        post("declared %d events, got %d", x->x_nevents, x->x_eventreadhead);
-        x->x_nevents = x->x_eventreadhead;
-    }
-    if(x->x_nevents)
-        qsort(x->x_sequence, x->x_nevents, sizeof(*x->x_sequence), midi_eventcomparehook);
-    if(x->x_temporeadhead < x->x_ntempi){
-        pd_error(x, "bug [midi]: midi_mfread 2");
-        post("declared %d tempi, got %d", x->x_ntempi, x->x_temporeadhead);
-        x->x_ntempi = x->x_temporeadhead;
-    }
-    if(x->x_ntempi)
-        qsort(x->x_tempomap, x->x_ntempi, sizeof(*x->x_tempomap), midi_tempocomparehook);
-    midi_foldtime(x, mifiread_getdeftempo(mr));
+    starts[ntracks] = x->x_nevents = x->x_eventreadhead;
+    x->x_ntempi = x->x_temporeadhead;
+    x->x_nmeters = x->x_meterreadhead;
+    midi_sortmaps(x);
+    x->x_deftempo = mifiread_getdeftempo(mr);
+    if(!midi_mergetracks(x, starts, ntracks, x->x_deftempo)){
+        midi_clear(x);
+        goto mfreadfailed;
+    }
     result = 1;
 mfreadfailed:
+    if(starts)
+        freebytes(starts, nstarts * sizeof(*starts));
     mifiread_free(mr);
     return(result);
 }
 
+/* Seeking: the time of every event from the start and a snapshot of the
+   state of all channels every 'x_chasestep' events are kept, so a jump finds
+   its event with a binary search and chases controllers and held notes from
+   the nearest snapshot instead of replaying the sequence from the start.
+   The index is built at the first jump, and again if the sequence was read
+   or recorded since. */
+static void midi_freeindex(t_midi *x){
+    if(x->x_times)
+        freebytes(x->x_times, x->x_ntimes * sizeof(*x->x_times));
+    if(x->x_chase)
+        freebytes(x->x_chase, x->x_nchase * sizeof(*x->x_chase));
+    x->x_times = NULL;
+    x->x_chase = NULL;
+    x->x_ntimes = x->x_nchase = 0;
+    x->x_indexed = 0;
+}
+
+static void midi_chaseevent(t_midichase *c, unsigned char *bp){
+    int ch = bp[0] & 0x0f;
+    if(bp[1] == MIDI_META) // sysex packets fall through the switch
+        return;
+    switch(bp[0] & 0xf0){
+        case 0xc0:
+            c->c_program[ch] = bp[1] & 0x7f;
+            return;
+        case 0xd0:
+            c->c_pressure[ch] = bp[1] & 0x7f;
+            return;
+    }
+    if(bp[2] == MIDI_META)
+        return;
+    switch(bp[0] & 0xf0){
+        case 0x80:
+            c->c_notes[ch][bp[1] & 0x7f] = 0;
+            break;
+        case 0x90:
+            c->c_notes[ch][bp[1] & 0x7f] = bp[2] & 0x7f;
+            break;
+        case 0xb0:
+            c->c_ctl[ch][bp[1] & 0x7f] = bp[2] & 0x7f;
+            break;
+        case 0xe0:
+            c->c_bend[ch][0] = bp[1] & 0x7f;
+            c->c_bend[ch][1] = bp[2] & 0x7f;
+            break;
+    }
+}
+
+static int midi_index(t_midi *x){
+    int n = x->x_nevents, step = MIDI_CHASESTEP;
+    t_midichase c;
+    double ms = 0.;
+    if(x->x_indexed)
+        return(1);
+    midi_freeindex(x);
+    while(n / step >= MIDI_MAXCHASE)
+        step *= 2;
+    if(!(x->x_times = getbytes(n * sizeof(*x->x_times))))
+        return(0);
+    x->x_ntimes = n;
+    if(!(x->x_chase = getbytes((n / step + 1) * sizeof(*x->x_chase)))){
+        midi_freeindex(x);
+        return(0);
+    }
+    x->x_nchase = n / step + 1;
+    x->x_chasestep = step;
+    memset(&c, MIDI_UNSET, sizeof(c));
+    memset(c.c_notes, 0, sizeof(c.c_notes));
+    for(int i = 0; i < n; i++){
+        t_midievent *ep = &x->x_sequence[i];
+        if(i % step == 0)
+            x->x_chase[i / step] = c;
+        midi_chaseevent(&c, ep->e_bytes);
+        x->x_times[i] = (ms += ep->e_delta);
+    }
+    x->x_indexed = 1;
+    return(1);
+}
+
+static void midi_chaseout(t_midi *x, int status, int data1, int data2){
+    outlet_float(((t_object *)x)->ob_outlet, status);
+    panic_input(x, status);
+    outlet_float(((t_object *)x)->ob_outlet, data1);
+    panic_input(x, data1);
+    if(data2 >= 0){
+        outlet_float(((t_object *)x)->ob_outlet, data2);
+        panic_input(x, data2);
+    }
+}
+
+// held notes are released, then the state before event 'ndx' is sent
+static void midi_chase(t_midi *x, int ndx){
+    t_midichase c = x->x_chase[ndx / x->x_chasestep];
+    for(int i = ndx - ndx % x->x_chasestep; i < ndx; i++)
+        midi_chaseevent(&c, x->x_sequence[i].e_bytes);
+    midi_panic(x);
+    for(int ch = 0; ch < 16; ch++){
+        if(c.c_program[ch] != MIDI_UNSET)
+            midi_chaseout(x, 0xc0 | ch, c.c_program[ch], -1);
+        for(int i = 0; i < 128; i++)
+            if(c.c_ctl[ch][i] != MIDI_UNSET)
+                midi_chaseout(x, 0xb0 | ch, i, c.c_ctl[ch][i]);
+        if(c.c_pressure[ch] != MIDI_UNSET)
+            midi_chaseout(x, 0xd0 | ch, c.c_pressure[ch], -1);
+        if(c.c_bend[ch][0] != MIDI_UNSET)
+            midi_chaseout(x, 0xe0 | ch, c.c_bend[ch][0], c.c_bend[ch][1]);
+        for(int i = 0; i < 128; i++)
+            if(c.c_notes[ch][i])
+                midi_chaseout(x, 0x90 | ch, i, c.c_notes[ch][i]);
+    }
+}
+
+// jump to 'ms' of score time (before 'speed'), cued and paused if idle
+static void midi_seek(t_midi *x, double ms){
+    int lo = 0, hi = x->x_nevents - 1;
+    if(x->x_mode == MIDI_RECMODE){
+        pd_error(x, "[midi]: can't seek while recording");
+        return;
+    }
+    if(!x->x_nevents)
+        return;
+    if(!midi_index(x)){
+        pd_error(x, "[midi]: not enough memory to seek");
+        return;
+    }
+    if(ms < 0.)
+        ms = 0.;
+    if(ms > x->x_times[hi] + MIDI_TICKEPSILON){ // past the end, stop there
+        midi_panic(x);
+        if(x->x_mode != MIDI_IDLEMODE)
+            midi_setmode(x, MIDI_IDLEMODE);
+        return;
+    }
+    while(lo < hi){ // the first event at or after 'ms'
+        int mid = (lo + hi) / 2;
+        if(x->x_times[mid] < ms - MIDI_TICKEPSILON)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if(x->x_times[lo] < ms)
+        ms = x->x_times[lo];
+    if(x->x_mode == MIDI_IDLEMODE){
+        midi_setmode(x, MIDI_PLAYMODE);
+        // clock_delay() has been called in setmode, LATER avoid
+        clock_unset(x->x_clock);
+        x->x_prevtime = 0.;
+    }
+    midi_chase(x, lo);
+    if(x->x_mode != MIDI_PLAYMODE && x->x_mode != MIDI_SLAVEMODE)
+        return; // protecting against outlet -> 'stop' etc.
+    x->x_playhead = lo;
+    x->x_nextscoretime = x->x_times[lo];
+    x->x_lead = 0.;
+    x->x_clockdelay = (x->x_times[lo] - ms) * x->x_timescale;
+    if(x->x_clockdelay < 0.)
+        x->x_clockdelay = 0.;
+    if(MIDI_ISRUNNING(x)){
+        clock_delay(x->x_clock, x->x_clockdelay);
+        x->x_prevtime = clock_getlogicaltime();
+    }
+}
+
+// score ticks to ms through the tempo map
+static double midi_scorems(t_midi *x, double scoretime){
+    t_midifold fd;
+    midi_foldstart(x, &fd, x->x_deftempo);
+    return(midi_fold(x, &fd, scoretime));
+}
+
+// score ticks at the start of 'bar' (from 0) through the time signatures,
+// one in the middle of a bar starts a new bar
+static double midi_barticks(t_midi *x, double bar){
+    double start = 0., span = MIDI_BARTICKS;
+    for(int i = 0; i < x->x_nmeters; i++){
+        t_midimeter *mm = &x->x_metermap[i];
+        double nbars = ceil((mm->m_scoretime - start) / span - MIDI_TICKEPSILON);
+        if(bar < nbars)
+            break;
+        bar -= nbars;
+        start = mm->m_scoretime;
+        span = mm->m_barspan;
+    }
+    return(start + bar * span);
+}
+
+// 'goto <ms>', 'goto beat <n>' or 'goto bar <n>', beats are quarter notes
+// and beats and bars count from 1
+static void midi_goto(t_midi *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    if(ac && av->a_type == A_FLOAT)
+        midi_seek(x, atom_getfloat(av));
+    else if(ac > 1 && av->a_type == A_SYMBOL && (av+1)->a_type == A_FLOAT){
+        t_symbol *unit = atom_getsymbol(av);
+        double n = atom_getfloat(av+1) - 1.;
+        if(n < 0.)
+            n = 0.;
+        if(unit == gensym("beat"))
+            midi_seek(x, midi_scorems(x, n * MIDI_BEATTICKS));
+        else if(unit == gensym("bar"))
+            midi_seek(x, midi_scorems(x, midi_barticks(x, n)));
+        else
+            pd_error(x, "[midi]: goto takes ms, 'beat' or 'bar'");
+    }
+    else
+        pd_error(x, "[midi]: goto takes ms, 'beat' or 'bar'");
+}
+
 static void midi_click(t_midi *x){
     panel_click_open(x->x_elsefilehandle);
 }
@@ -868,6 +1269,7 @@ static void midi_doread(t_midi *x, t_symbol *fn){
     if(!midi_mfread(x, fname))
         midi_textread(x, fname);
     x->x_playhead = 0;
+    midi_freeindex(x); // built at the first seek
 }
 
 static void midi_dowrite(t_midi *x, t_symbol *fn){
@@ -929,6 +1331,11 @@ static void midi_free(t_midi *x){
         freebytes(x->x_sequence, x->x_midisize * sizeof(*x->x_sequence));
     if(x->x_tempomap != x->x_tempomapini)
         freebytes(x->x_tempomap, x->x_tempomapsize * sizeof(*x->x_tempomap));
+    if(x->x_metermap != x->x_metermapini)
+        freebytes(x->x_metermap, x->x_metermapsize * sizeof(*x->x_metermap));
+    midi_freeindex(x);
+    if(x->x_blockvec)
+        freebytes(x->x_blockvec, x->x_blocksize * sizeof(t_atom));
 }
 
 static void *midi_new(t_symbol * s, int ac, t_atom *av){
@@ -946,6 +1353,10 @@ static void *midi_new(t_symbol * s, int ac, t_atom *av){
     x->x_tempomapsize = MIDI_INITEMPOMAPSIZE;
     x->x_ntempi = 0;
     x->x_tempomap = x->x_tempomapini;
+    x->x_metermapsize = MIDI_INIMETERMAPSIZE;
+    x->x_nmeters = 0;
+    x->x_metermap = x->x_metermapini;
+    x->x_deftempo = MIDI_DEFTEMPO;
     x->x_defname = &s_;
     int argn = 0;
     while(ac){
@@ -955,6 +1366,10 @@ static void *midi_new(t_symbol * s, int ac, t_atom *av){
                 x->x_loop = 1;
                 ac--, av++;
             }
+            else if(s == gensym("-block") && !argn){
+                x->x_block = 1;
+                ac--, av++;
+            }
             else{
                 argn = 1;
                 midi_doread(x, x->x_defname = s);
@@ -991,7 +1406,7 @@ void midi_setup(void){
     class_addmethod(midi_class, (t_method)midi_pause, gensym("pause"), 0);
     class_addmethod(midi_class, (t_method)midi_continue, gensym("continue"), 0);
     class_addmethod(midi_class, (t_method)midi_click, gensym("click"), A_FLOAT, A_FLOAT, A_FLOAT, A_FLOAT, A_FLOAT, 0);
-//    class_addmethod(midi_class, (t_method)midi_goto, gensym("goto"), A_DEFFLOAT, A_DEFFLOAT, 0);
+    class_addmethod(midi_class, (t_method)midi_goto, gensym("goto"), A_GIMME, 0);
     class_addmethod(midi_class, (t_method)midi_speed, gensym("speed"), A_FLOAT, 0);;
     elsefile_setup();
 }
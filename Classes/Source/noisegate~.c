@@ -0,0 +1,159 @@
+// noise gate, runs on the dynamics core (shared/dynamics.c)
+
+#include "m_pd.h"
+#include "dynamics.h"
+
+#define MAX_CHANS 64
+#define REPORT_PERIOD 1024 // samples between gain reduction reports
+
+typedef struct _noisegate{
+    t_object    x_obj;
+    t_dynamics  x_dyn;
+    int         x_count;
+    t_clock    *x_clock;
+    t_outlet   *x_out_gr;
+    t_float   **x_ins;
+    t_float   **x_outs;
+}t_noisegate;
+
+static t_class *noisegate_class;
+
+static void noisegate_tick(t_noisegate *x){
+    outlet_float(x->x_out_gr, dyn_reduction(&x->x_dyn));
+}
+
+static void noisegate_time(t_noisegate *x, t_floatarg f){
+    x->x_dyn.d_attack = x->x_dyn.d_release = f;
+    dyn_update(&x->x_dyn);
+}
+
+// threshold and optionally the attack/release time
+static void noisegate_thresh(t_noisegate *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    if(ac)
+        x->x_dyn.d_thresh = atom_getfloat(av);
+    if(ac > 1)
+        noisegate_time(x, atom_getfloat(av + 1));
+}
+
+static void noisegate_size(t_noisegate *x, t_floatarg f){
+    x->x_dyn.d_window = f < 1 ? 1 : f;
+    dyn_update(&x->x_dyn);
+}
+
+static void noisegate_peak(t_noisegate *x, t_floatarg f){
+    x->x_dyn.d_peak = f != 0;
+}
+
+static void noisegate_link(t_noisegate *x, t_floatarg f){
+    x->x_dyn.d_link = f != 0;
+}
+
+static void noisegate_lookahead(t_noisegate *x, t_floatarg f){
+    dyn_lookahead(&x->x_dyn, f);
+}
+
+static void noisegate_clear(t_noisegate *x){
+    dyn_clear(&x->x_dyn);
+}
+
+static t_int *noisegate_perform(t_int *w){
+    t_noisegate *x = (t_noisegate *)(w[1]);
+    int n = (int)(w[2]);
+    dyn_perform(&x->x_dyn, n, x->x_ins, NULL, x->x_outs);
+    if((x->x_count += n) >= REPORT_PERIOD){
+        x->x_count = 0;
+        clock_delay(x->x_clock, 0);
+    }
+    return(w + 3);
+}
+
+static void noisegate_dsp(t_noisegate *x, t_signal **sp){
+    int nch = x->x_dyn.d_nch, n = sp[0]->s_n;
+    if(sp[0]->s_sr != x->x_dyn.d_sr){
+        x->x_dyn.d_sr = sp[0]->s_sr;
+        dyn_update(&x->x_dyn);
+        dyn_lookahead(&x->x_dyn, x->x_dyn.d_lookahead);
+    }
+    dyn_block(&x->x_dyn, n);
+    for(int ch = 0; ch < nch; ch++){
+        x->x_ins[ch] = sp[ch]->s_vec;
+        x->x_outs[ch] = sp[nch + ch]->s_vec;
+    }
+    dsp_add(noisegate_perform, 2, x, n);
+}
+
+static void noisegate_free(t_noisegate *x){
+    int nch = x->x_dyn.d_nch;
+    clock_free(x->x_clock);
+    freebytes(x->x_ins, nch * sizeof(t_float *));
+    freebytes(x->x_outs, nch * sizeof(t_float *));
+    dyn_free(&x->x_dyn);
+}
+
+static void *noisegate_new(t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    t_noisegate *x = (t_noisegate *)pd_new(noisegate_class);
+    int nch = 1, peak = 0, link = 1;
+    t_float lookahead = 0, size = 256;
+    while(ac && av->a_type == A_SYMBOL){
+        t_symbol *flag = atom_getsymbol(av);
+        if(flag == gensym("-size") && ac >= 2){
+            size = atom_getfloat(av + 1);
+            ac -= 2, av += 2;
+        }
+        else if(flag == gensym("-ch") && ac >= 2){
+            int n = (int)atom_getfloat(av + 1);
+            nch = n < 1 ? 1 : n > MAX_CHANS ? MAX_CHANS : n;
+            ac -= 2, av += 2;
+        }
+        else if(flag == gensym("-lookahead") && ac >= 2){
+            lookahead = atom_getfloat(av + 1);
+            ac -= 2, av += 2;
+        }
+        else if(flag == gensym("-peak")){
+            peak = 1;
+            ac--, av++;
+        }
+        else if(flag == gensym("-unlink")){
+            link = 0;
+            ac--, av++;
+        }
+        else{
+            pd_error(x, "[noisegate~]: unknown flag '%s' ignored", flag->s_name);
+            ac--, av++;
+        }
+    }
+    t_dynamics *d = &x->x_dyn;
+    dyn_init(d, DYN_GATE, nch, 0, sys_getsr());
+    d->d_peak = peak, d->d_link = link;
+    // thresh time
+    d->d_thresh = ac < 1 ? -100 : atom_getfloatarg(0, ac, av);
+    d->d_attack = d->d_release = ac < 2 ? 10 : atom_getfloatarg(1, ac, av);
+    noisegate_size(x, size);
+    dyn_lookahead(d, lookahead);
+    x->x_clock = clock_new(x, (t_method)noisegate_tick);
+    x->x_ins = (t_float **)getbytes(nch * sizeof(t_float *));
+    x->x_outs = (t_float **)getbytes(nch * sizeof(t_float *));
+    for(int ch = 1; ch < nch; ch++)
+        inlet_new(&x->x_obj, &x->x_obj.ob_pd, &s_signal, &s_signal);
+    inlet_new(&x->x_obj, &x->x_obj.ob_pd, &s_list, gensym("thresh"));
+    for(int ch = 0; ch < nch; ch++)
+        outlet_new(&x->x_obj, &s_signal);
+    x->x_out_gr = outlet_new(&x->x_obj, &s_float);
+    return(x);
+}
+
+void noisegate_tilde_setup(void){
+    noisegate_class = class_new(gensym("noisegate~"), (t_newmethod)noisegate_new,
+        (t_method)noisegate_free, sizeof(t_noisegate), CLASS_DEFAULT, A_GIMME, 0);
+    class_addmethod(noisegate_class, nullfn, gensym("signal"), 0);
+    class_addmethod(noisegate_class, (t_method)noisegate_dsp, gensym("dsp"), A_CANT, 0);
+    class_addmethod(noisegate_class, (t_method)noisegate_thresh, gensym("thresh"), A_GIMME, 0);
+    class_addmethod(noisegate_class, (t_method)noisegate_time, gensym("time"), A_FLOAT, 0);
+    class_addmethod(noisegate_class, (t_method)noisegate_size, gensym("size"), A_FLOAT, 0);
+    class_addmethod(noisegate_class, (t_method)noisegate_peak, gensym("peak"), A_FLOAT, 0);
+    class_addmethod(noisegate_class, (t_method)noisegate_link, gensym("link"), A_FLOAT, 0);
+    class_addmethod(noisegate_class, (t_method)noisegate_lookahead, gensym("lookahead"), A_FLOAT, 0);
+    class_addmethod(noisegate_class, (t_method)noisegate_clear, gensym("clear"), 0);
+}
@@ -0,0 +1,90 @@
+// Porres 2017, compiled version of the old abstraction
+
+#include "m_pd.h"
+#include "oscbank.h"
+
+static t_class *oscbank2_class;
+
+typedef struct _oscbank2_tilde{
+    t_object  x_obj;
+    t_oscbank x_bank;
+}t_oscbank2_tilde;
+
+static void oscbank2_tilde_freq(t_oscbank2_tilde *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    oscbank_set(&x->x_bank, x, &x->x_bank.b_freq, ac, av, 0);
+}
+
+static void oscbank2_tilde_amp(t_oscbank2_tilde *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    oscbank_set(&x->x_bank, x, &x->x_bank.b_amp, ac, av, 0);
+}
+
+static void oscbank2_tilde_phase(t_oscbank2_tilde *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    oscbank_set(&x->x_bank, x, &x->x_bank.b_offset, ac, av, 0);
+}
+
+static void oscbank2_tilde_ramp(t_oscbank2_tilde *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    bank_ramp(&x->x_bank.b_bank, x, ac, av);
+}
+
+static void oscbank2_tilde_rampall(t_oscbank2_tilde *x, t_floatarg f){
+    bank_rampall(&x->x_bank.b_bank, f);
+}
+
+static t_int *oscbank2_tilde_perform(t_int *w){
+    t_oscbank2_tilde *x = (t_oscbank2_tilde *)(w[1]);
+    oscbank_perform(&x->x_bank, (int)(w[2]), NULL, (t_float *)(w[3]));
+    return(w+4);
+}
+
+static void oscbank2_tilde_dsp(t_oscbank2_tilde *x, t_signal **sp){
+    x->x_bank.b_bank.b_sr = sp[0]->s_sr;
+    dsp_add(oscbank2_tilde_perform, 3, x, sp[0]->s_n, sp[0]->s_vec);
+}
+
+static void oscbank2_tilde_free(t_oscbank2_tilde *x){
+    oscbank_free(&x->x_bank);
+}
+
+static void *oscbank2_tilde_new(t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    t_oscbank2_tilde *x = (t_oscbank2_tilde *)pd_new(oscbank2_class);
+    t_bank_flag flags[] = {
+        {"-freq", 1, 0, NULL},
+        {"-amp", 1, 0, NULL},
+        {"-phase", 1, 0, NULL},
+        {"-ramp", 1, 0, NULL},
+        {"-rampall", 0, 0, NULL}
+    };
+    int n = bank_getflags(x, &ac, &av, flags, 5);
+    t_float ramp = flags[4].f_ac ? atom_getfloat(flags[4].f_av) : 10;
+    if(!n){ // no list flags: number of oscillators, ramp time
+        if(ac && av->a_type == A_FLOAT)
+            n = atom_getfloat(av), ac--, av++;
+        if(ac && av->a_type == A_FLOAT)
+            ramp = atom_getfloat(av), ac--, av++;
+    }
+    oscbank_init(&x->x_bank, n, 0, ramp);
+    if(flags[3].f_ac)
+        bank_ramp(&x->x_bank.b_bank, x, flags[3].f_ac, flags[3].f_av);
+    for(int i = 0; i < 3; i++) if(flags[i].f_ac){
+        t_bank_param *p = i == 0 ? &x->x_bank.b_freq : i == 1 ? &x->x_bank.b_amp : &x->x_bank.b_offset;
+        oscbank_set(&x->x_bank, x, p, flags[i].f_ac, flags[i].f_av, 1);
+    }
+    outlet_new(&x->x_obj, &s_signal);
+    return(x);
+}
+
+void oscbank2_tilde_setup(void){
+    oscbank2_class = class_new(gensym("oscbank2~"), (t_newmethod)oscbank2_tilde_new,
+        (t_method)oscbank2_tilde_free, sizeof(t_oscbank2_tilde), 0, A_GIMME, 0);
+    class_addmethod(oscbank2_class, (t_method)oscbank2_tilde_dsp, gensym("dsp"), A_CANT, 0);
+    class_addmethod(oscbank2_class, (t_method)oscbank2_tilde_freq, gensym("freq"), A_GIMME, 0);
+    class_addmethod(oscbank2_class, (t_method)oscbank2_tilde_amp, gensym("amp"), A_GIMME, 0);
+    class_addmethod(oscbank2_class, (t_method)oscbank2_tilde_phase, gensym("phase"), A_GIMME, 0);
+    class_addmethod(oscbank2_class, (t_method)oscbank2_tilde_ramp, gensym("ramp"), A_GIMME, 0);
+    class_addmethod(oscbank2_class, (t_method)oscbank2_tilde_rampall, gensym("rampall"), A_FLOAT, 0);
+}
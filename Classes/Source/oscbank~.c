@@ -0,0 +1,97 @@
+// Porres 2017, compiled version of the old abstraction
+
+#include "m_pd.h"
+#include "oscbank.h"
+
+static t_class *oscbank_class;
+
+typedef struct _oscbank_tilde{
+    t_object  x_obj;
+    t_float   x_freq;
+    t_oscbank x_bank;
+}t_oscbank_tilde;
+
+static void oscbank_tilde_ratio(t_oscbank_tilde *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    oscbank_set(&x->x_bank, x, &x->x_bank.b_freq, ac, av, 0);
+}
+
+static void oscbank_tilde_amp(t_oscbank_tilde *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    oscbank_set(&x->x_bank, x, &x->x_bank.b_amp, ac, av, 0);
+}
+
+static void oscbank_tilde_phase(t_oscbank_tilde *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    oscbank_set(&x->x_bank, x, &x->x_bank.b_offset, ac, av, 0);
+}
+
+static void oscbank_tilde_ramp(t_oscbank_tilde *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    bank_ramp(&x->x_bank.b_bank, x, ac, av);
+}
+
+static void oscbank_tilde_rampall(t_oscbank_tilde *x, t_floatarg f){
+    bank_rampall(&x->x_bank.b_bank, f);
+}
+
+static t_int *oscbank_tilde_perform(t_int *w){
+    t_oscbank_tilde *x = (t_oscbank_tilde *)(w[1]);
+    oscbank_perform(&x->x_bank, (int)(w[2]), (t_float *)(w[3]), (t_float *)(w[4]));
+    return(w+5);
+}
+
+static void oscbank_tilde_dsp(t_oscbank_tilde *x, t_signal **sp){
+    x->x_bank.b_bank.b_sr = sp[0]->s_sr;
+    dsp_add(oscbank_tilde_perform, 4, x, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec);
+}
+
+static void oscbank_tilde_free(t_oscbank_tilde *x){
+    oscbank_free(&x->x_bank);
+}
+
+static void *oscbank_tilde_new(t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    t_oscbank_tilde *x = (t_oscbank_tilde *)pd_new(oscbank_class);
+    t_bank_flag flags[] = {
+        {"-ratio", 1, 0, NULL},
+        {"-amp", 1, 0, NULL},
+        {"-phase", 1, 0, NULL},
+        {"-ramp", 1, 0, NULL},
+        {"-rampall", 0, 0, NULL},
+        {"-freq", 0, 0, NULL}
+    };
+    int n = bank_getflags(x, &ac, &av, flags, 6);
+    t_float freq = flags[5].f_ac ? atom_getfloat(flags[5].f_av) : 0;
+    t_float ramp = flags[4].f_ac ? atom_getfloat(flags[4].f_av) : 10;
+    if(!n){ // no list flags: number of oscillators, frequency, ramp time
+        if(ac && av->a_type == A_FLOAT)
+            n = atom_getfloat(av), ac--, av++;
+        if(ac && av->a_type == A_FLOAT)
+            freq = atom_getfloat(av), ac--, av++;
+        if(ac && av->a_type == A_FLOAT)
+            ramp = atom_getfloat(av), ac--, av++;
+    }
+    oscbank_init(&x->x_bank, n, 1, ramp);
+    if(flags[3].f_ac)
+        bank_ramp(&x->x_bank.b_bank, x, flags[3].f_ac, flags[3].f_av);
+    for(int i = 0; i < 3; i++) if(flags[i].f_ac){
+        t_bank_param *p = i == 0 ? &x->x_bank.b_freq : i == 1 ? &x->x_bank.b_amp : &x->x_bank.b_offset;
+        oscbank_set(&x->x_bank, x, p, flags[i].f_ac, flags[i].f_av, 1);
+    }
+    x->x_freq = freq;
+    outlet_new(&x->x_obj, &s_signal);
+    return(x);
+}
+
+void oscbank_tilde_setup(void){
+    oscbank_class = class_new(gensym("oscbank~"), (t_newmethod)oscbank_tilde_new,
+        (t_method)oscbank_tilde_free, sizeof(t_oscbank_tilde), 0, A_GIMME, 0);
+    CLASS_MAINSIGNALIN(oscbank_class, t_oscbank_tilde, x_freq);
+    class_addmethod(oscbank_class, (t_method)oscbank_tilde_dsp, gensym("dsp"), A_CANT, 0);
+    class_addmethod(oscbank_class, (t_method)oscbank_tilde_ratio, gensym("ratio"), A_GIMME, 0);
+    class_addmethod(oscbank_class, (t_method)oscbank_tilde_amp, gensym("amp"), A_GIMME, 0);
+    class_addmethod(oscbank_class, (t_method)oscbank_tilde_phase, gensym("phase"), A_GIMME, 0);
+    class_addmethod(oscbank_class, (t_method)oscbank_tilde_ramp, gensym("ramp"), A_GIMME, 0);
+    class_addmethod(oscbank_class, (t_method)oscbank_tilde_rampall, gensym("rampall"), A_FLOAT, 0);
+}
@@ -9,9 +9,29 @@
 #define DEF_RADIANS (0.31830989569 * 0.5)
 #define PLUCK_STACK 48000 // stack buf size
 #define PLUCK_MAXD  4294967294 // max delay = 2**32 - 2
+#define PLUCK_LANES 4           // strings processed together in bank mode
+#define PLUCK_MINHZ 20          // lowest string in bank mode
+#define PLUCK_FLOOR 0.000001f   // a string is idle below this (-120dB)
+#define LOG001      log(0.001)
 
 static t_class *pluck_class;
 
+// a string of the bank mode
+typedef struct _pluckstring{
+    t_float        *s_buf;      // its region of the delay arena
+    t_float         s_hz;
+    int             s_del;      // delay in samples
+    unsigned int    s_wh;       // writehead
+    t_float         s_fb;
+    t_float         s_amp;
+    int             s_excite;   // samples of noise left
+    t_float         s_xnm1;
+    t_float         s_ynm1;
+    t_float         s_peak;     // since the last period
+    int             s_count;    // samples since the last period
+    int             s_slot;     // position in 'x_active', -1 if idle
+}t_pluckstring;
+
 typedef struct _pluck{
     t_object        x_obj;
     t_random_state  x_rstate;
@@ -43,9 +63,27 @@ typedef struct _pluck{
     double          x_a0;
     double          x_a1;
     double          x_b1;
+    // bank mode
+    int             x_bank;     // number of strings, 0 for one
+    t_pluckstring  *x_strings;
+    int            *x_active;   // the strings that are ringing
+    int             x_nactive;
+    t_float        *x_arena;    // one delay region per string
+    unsigned int    x_len;      // region size, a power of 2
+    t_float        *x_xs;       // the lanes of a chunk, interleaved
+    t_float        *x_ys;
+    t_float        *x_noise;
+    t_float        *x_in;
+    int             x_nblock;
 }t_pluck;
 
+static void pluck_bank_clear(t_pluck *x);
+
 static void pluck_bang(t_pluck *x){
+    if(x->x_bank){
+        pd_error(x, "[pluck~]: bank mode needs a 'string amp' list");
+        return;
+    }
     x->x_control_trig = 1;
 }
 
@@ -57,6 +95,10 @@ static void pluck_float(t_pluck *x, t_float f){
 }
 
 static void pluck_clear(t_pluck *x){
+    if(x->x_bank){
+        pluck_bank_clear(x);
+        return;
+    }
     for(unsigned int i = 0; i < x->x_sz; i++)
         x->x_ybuf[i] = 0.;
     x->x_wh = 0;
@@ -216,7 +258,7 @@ static t_int *pluck_perform_noise_input(t_int *w){
         }
     };
     x->x_sum = sum; // next
-    x->x_last_trig = amp;
+    x->x_amp = amp;
     x->x_last_trig = last_trig;
     x->x_xnm1 = xnm1;
     x->x_ynm1 = ynm1;
@@ -295,14 +337,272 @@ static t_int *pluck_perform(t_int *w){
         }
     };
     x->x_sum = sum; // next
-    x->x_last_trig = amp;
+    x->x_amp = amp;
     x->x_last_trig = last_trig;
     x->x_xnm1 = xnm1;
     x->x_ynm1 = ynm1;
     return(w+9);
 }
 
+////////////////////////////////////////////////////////////////////////////////////
+// bank mode: the strings share one delay arena and the ringing ones run in
+// groups of PLUCK_LANES, the lowpass of a group is computed for all its lanes
+// at once. As a string's delay is at least the chunk length, the delayed
+// samples of a chunk are all known before it's filtered.
+
+static void pluck_string_fb(t_pluck *x, t_pluckstring *p){
+    double fb = x->x_ain;
+    p->s_fb = fb == 0 ? 0 : copysign(exp(LOG001 * (1000. / p->s_hz) / fabs(fb)), fb);
+}
+
+static void pluck_string_tune(t_pluck *x, t_pluckstring *p, t_float hz){
+    if(hz < PLUCK_MINHZ)
+        hz = PLUCK_MINHZ;
+    if(hz > x->x_sr * 0.5)
+        hz = x->x_sr * 0.5;
+    p->s_hz = hz;
+    p->s_del = (int)roundf(x->x_sr / hz);
+    if(p->s_del < 1)
+        p->s_del = 1;
+    if(p->s_del > (int)x->x_len - 1)
+        p->s_del = x->x_len - 1;
+    pluck_string_fb(x, p);
+}
+
+// silence a string and take it out of the active list
+static void pluck_string_stop(t_pluck *x, t_pluckstring *p){
+    if(p->s_slot >= 0){
+        int moved = x->x_active[--x->x_nactive];
+        x->x_active[p->s_slot] = moved;
+        x->x_strings[moved].s_slot = p->s_slot;
+        p->s_slot = -1;
+    }
+    for(unsigned int i = 0; i < x->x_len; i++)
+        p->s_buf[i] = 0;
+    p->s_wh = p->s_excite = p->s_count = 0;
+    p->s_xnm1 = p->s_ynm1 = p->s_peak = 0;
+}
+
+static void pluck_string_pluck(t_pluck *x, t_pluckstring *p, t_float amp){
+    p->s_amp = amp;
+    p->s_excite = p->s_del + 1;
+    p->s_peak = p->s_count = 0;
+    if(p->s_slot < 0){
+        p->s_slot = x->x_nactive;
+        x->x_active[x->x_nactive++] = p - x->x_strings;
+    }
+}
+
+static void pluck_bank_clear(t_pluck *x){
+    for(int j = 0; j < x->x_bank; j++)
+        pluck_string_stop(x, &x->x_strings[j]);
+}
+
+// a region for the lowest string at the current sample rate
+static void pluck_bank_size(t_pluck *x){
+    unsigned int len = 1, n = x->x_bank, need = (unsigned int)(x->x_sr / PLUCK_MINHZ) + 2;
+    while(len < need)
+        len *= 2;
+    if(len != x->x_len){
+        x->x_arena = (t_float *)resizebytes(x->x_arena,
+            n * x->x_len * sizeof(t_float), n * len * sizeof(t_float));
+        x->x_len = len;
+    }
+    for(unsigned int j = 0; j < n; j++){
+        x->x_strings[j].s_buf = x->x_arena + j * len;
+        pluck_string_tune(x, &x->x_strings[j], x->x_strings[j].s_hz);
+    }
+    pluck_bank_clear(x);
+}
+
+static void pluck_bank_coeffs(t_pluck *x, t_float decay, t_float cutoff){
+    double nyq = x->x_sr * 0.5;
+    if(cutoff < 0.000001)
+        cutoff = 0.000001;
+    if(cutoff > nyq - 0.000001)
+        cutoff = nyq - 0.000001;
+    if(x->x_f != cutoff)
+        update_coeffs(x, cutoff);
+    if(x->x_ain != decay){
+        x->x_ain = decay;
+        for(int j = 0; j < x->x_bank; j++)
+            pluck_string_fb(x, &x->x_strings[j]);
+    }
+}
+
+// 'nl' strings in lanes for a block, added to 'out'
+static void pluck_bank_group(t_pluck *x, t_pluckstring **s, int nl, int n, t_float *out, int noise_input){
+    t_float *xs = x->x_xs, *ys = x->x_ys;
+    t_float xnm1[PLUCK_LANES], ynm1[PLUCK_LANES], peak[PLUCK_LANES];
+    t_float a0 = x->x_a0, a1 = x->x_a1, b1 = x->x_b1;
+    unsigned int mask = x->x_len - 1;
+    for(int k = 0; k < PLUCK_LANES; k++){ // unused lanes stay silent
+        xnm1[k] = k < nl ? s[k]->s_xnm1 : 0;
+        ynm1[k] = k < nl ? s[k]->s_ynm1 : 0;
+        peak[k] = k < nl ? s[k]->s_peak : 0;
+    }
+    for(int i = 0; i < n;){
+        int m = n - i;
+        for(int k = 0; k < nl; k++)
+            if(s[k]->s_del < m)
+                m = s[k]->s_del;
+        // delayed samples and excitation
+        for(int k = 0; k < PLUCK_LANES; k++){
+            if(k >= nl){
+                for(int t = 0; t < m; t++)
+                    xs[t*PLUCK_LANES+k] = 0;
+                continue;
+            }
+            t_pluckstring *p = s[k];
+            t_float fb = p->s_fb, *buf = p->s_buf;
+            unsigned int rh = p->s_wh - p->s_del;
+            for(int t = 0; t < m; t++)
+                xs[t*PLUCK_LANES+k] = fb * buf[(rh + t) & mask];
+            int e = p->s_excite < m ? p->s_excite : m;
+            if(e > 0){
+                t_float *noise = x->x_in + i;
+                if(!noise_input)
+                    random_block(&x->x_rstate, noise = x->x_noise, e);
+                for(int t = 0; t < e; t++)
+                    xs[t*PLUCK_LANES+k] += p->s_amp * noise[t];
+                p->s_excite -= e;
+            }
+        }
+        // the lowpass of all lanes
+        for(int t = 0; t < m; t++){
+            t_float sum = 0;
+            for(int k = 0; k < PLUCK_LANES; k++){
+                t_float in = xs[t*PLUCK_LANES+k];
+                t_float y = a0 * in + a1 * xnm1[k] + b1 * ynm1[k];
+                t_float a = fabsf(y);
+                peak[k] = a > peak[k] ? a : peak[k];
+                ys[t*PLUCK_LANES+k] = ynm1[k] = y;
+                xnm1[k] = in;
+                sum += in;
+            }
+            out[i+t] += sum;
+        }
+        // back to the delay lines, a string is quiet when a whole period was
+        for(int k = 0; k < nl; k++){
+            t_pluckstring *p = s[k];
+            t_float *buf = p->s_buf;
+            unsigned int wh = p->s_wh;
+            for(int t = 0; t < m; t++)
+                buf[(wh + t) & mask] = ys[t*PLUCK_LANES+k];
+            p->s_wh = (wh + m) & mask;
+            if((p->s_count += m) >= p->s_del){
+                if(!p->s_excite && peak[k] < PLUCK_FLOOR)
+                    p->s_slot = -2; // stopped after the block
+                peak[k] = p->s_count = 0;
+            }
+        }
+        i += m;
+    }
+    for(int k = 0; k < nl; k++){
+        s[k]->s_xnm1 = PD_BIGORSMALL(xnm1[k]) ? 0 : xnm1[k];
+        s[k]->s_ynm1 = PD_BIGORSMALL(ynm1[k]) ? 0 : ynm1[k];
+        s[k]->s_peak = peak[k];
+    }
+}
+
+// decay and cutoff are read once per block
+static t_int *pluck_bank_perform(t_int *w){
+    t_pluck *x = (t_pluck *)(w[1]);
+    int n = (int)(w[2]);
+    t_float *decay_in = (t_float *)(w[3]);
+    t_float *cut_in = (t_float *)(w[4]);
+    t_float *noise_in = (t_float *)(w[5]);
+    t_float *out = (t_float *)(w[6]);
+    pluck_bank_coeffs(x, decay_in[0], cut_in[0]);
+    if(x->x_noise_input) // the input may be the output
+        for(int i = 0; i < n; i++)
+            x->x_in[i] = noise_in[i];
+    for(int i = 0; i < n; i++)
+        out[i] = 0;
+    for(int g = 0; g < x->x_nactive; g += PLUCK_LANES){
+        t_pluckstring *lanes[PLUCK_LANES];
+        int nl = x->x_nactive - g < PLUCK_LANES ? x->x_nactive - g : PLUCK_LANES;
+        for(int k = 0; k < nl; k++)
+            lanes[k] = &x->x_strings[x->x_active[g+k]];
+        pluck_bank_group(x, lanes, nl, n, out, x->x_noise_input);
+    }
+    for(int k = 0; k < x->x_nactive;){ // strings that went quiet
+        t_pluckstring *p = &x->x_strings[x->x_active[k]];
+        if(p->s_slot == -2){
+            p->s_slot = k;
+            pluck_string_stop(x, p);
+        }
+        else
+            k++;
+    }
+    return(w+7);
+}
+
+static void pluck_bank_dsp(t_pluck *x, t_signal **sp){
+    int n = sp[0]->s_n, size = n * PLUCK_LANES;
+    if(n != x->x_nblock){
+        int old = x->x_nblock * PLUCK_LANES;
+        x->x_xs = (t_float *)resizebytes(x->x_xs, old * sizeof(t_float), size * sizeof(t_float));
+        x->x_ys = (t_float *)resizebytes(x->x_ys, old * sizeof(t_float), size * sizeof(t_float));
+        x->x_noise = (t_float *)resizebytes(x->x_noise, x->x_nblock * sizeof(t_float), n * sizeof(t_float));
+        x->x_in = (t_float *)resizebytes(x->x_in, x->x_nblock * sizeof(t_float), n * sizeof(t_float));
+        x->x_nblock = n;
+    }
+    if(sp[0]->s_sr != x->x_sr){
+        x->x_sr = sp[0]->s_sr;
+        pluck_bank_size(x);
+        update_coeffs(x, x->x_f);
+    }
+    dsp_add(pluck_bank_perform, 6, x, n, sp[1]->s_vec, sp[2]->s_vec,
+        x->x_noise_input ? sp[3]->s_vec : sp[0]->s_vec, sp[3 + x->x_noise_input]->s_vec);
+}
+
+// 'string amp' plucks a string, 'string hz amp' also tunes it
+static void pluck_list(t_pluck *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    if(!ac){
+        pluck_bang(x);
+        return;
+    }
+    if(!x->x_bank){ // spread over the inlets
+        t_inlet *inlets[3] = {x->x_freq_inlet, x->x_decay_inlet, x->x_cutoff_inlet};
+        for(int i = (ac > 4 ? 4 : ac) - 1; i > 0; i--)
+            pd_float((t_pd *)inlets[i-1], atom_getfloat(av + i));
+        pluck_float(x, atom_getfloat(av));
+        return;
+    }
+    if(ac < 2){
+        pd_error(x, "[pluck~]: bank mode needs a 'string amp' list");
+        return;
+    }
+    int j = (int)atom_getfloat(av);
+    if(j < 0 || j >= x->x_bank)
+        return;
+    t_pluckstring *p = &x->x_strings[j];
+    if(ac > 2)
+        pluck_string_tune(x, p, atom_getfloat(av + 1));
+    t_float amp = atom_getfloat(av + ac - 1);
+    if(amp != 0)
+        pluck_string_pluck(x, p, amp);
+}
+
+static void pluck_freq(t_pluck *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    if(!x->x_bank){
+        pd_error(x, "[pluck~]: 'freq' is for the bank mode");
+        return;
+    }
+    for(int j = 0; j < ac && j < x->x_bank; j++)
+        pluck_string_tune(x, &x->x_strings[j], atom_getfloat(av + j));
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
 static void pluck_dsp(t_pluck *x, t_signal **sp){
+    if(x->x_bank){
+        pluck_bank_dsp(x, sp);
+        return;
+    }
     int sr = sp[0]->s_sr;
     if(sr != x->x_sr){ // if new sample rate isn't old sample rate, need to realloc
         x->x_sr = sr;
@@ -329,6 +629,7 @@ static void *pluck_new(t_symbol *s, int argc, t_atom *argv){
     x->x_float_trig = 1;
     x->x_control_trig = 0;
     x->x_noise_input = 0;
+    x->x_bank = 0;
     int argnum = 0;
     while(argc > 0){
         if(argv->a_type == A_FLOAT){ //if current argument is a float
@@ -355,35 +656,58 @@ static void *pluck_new(t_symbol *s, int argc, t_atom *argv){
                 x->x_noise_input = 1;
                 argc--, argv++;
             }
+            else if(curarg == gensym("-bank") && argc >= 2){
+                int n = (int)atom_getfloatarg(1, argc, argv);
+                x->x_bank = n < 1 ? 1 : n;
+                argc -= 2, argv += 2;
+            }
             else
                 goto errstate;
         }
         else
             goto errstate;
     };
-    x->x_alloc = x->x_last_trig = 0;
-    x->x_xnm1 = x->x_ynm1 = 0.;
-    x->x_sum = PLUCK_MAXD;
-    x->x_sz = PLUCK_STACK;
-// clear out stack buf, set pointer to stack
-    x->x_ybuf = x->x_fbstack;
-    pluck_clear(x);
-    x->x_freq = (double)freq;
-    x->x_ain = decay;
-    x->x_f = (double)cut_freq;
-    x->x_maxdel = 1000;
-// ship off to the helper method to deal with allocation if necessary
-    pluck_sz(x);
-    
-    if(x->x_freq > 1){
-        update_time(x, x->x_freq);
-        update_fb(x, x->x_ain, x->x_delms);
+    if(x->x_bank){ // all strings start at the frequency argument
+        x->x_strings = (t_pluckstring *)getbytes(x->x_bank * sizeof(t_pluckstring));
+        x->x_active = (int *)getbytes(x->x_bank * sizeof(int));
+        x->x_nactive = x->x_nblock = 0;
+        x->x_arena = x->x_xs = x->x_ys = x->x_noise = x->x_in = NULL;
+        x->x_len = 0;
+        for(int j = 0; j < x->x_bank; j++){
+            x->x_strings[j].s_hz = freq;
+            x->x_strings[j].s_slot = -1;
+        }
+        x->x_ain = decay + 1; // so the feedback is computed
+        pluck_bank_size(x);
+        pluck_bank_coeffs(x, decay, cut_freq);
+    }
+    else{
+        x->x_alloc = x->x_last_trig = 0;
+        x->x_xnm1 = x->x_ynm1 = 0.;
+        x->x_sum = PLUCK_MAXD;
+        x->x_sz = PLUCK_STACK;
+    // clear out stack buf, set pointer to stack
+        x->x_ybuf = x->x_fbstack;
+        pluck_clear(x);
+        x->x_freq = (double)freq;
+        x->x_ain = decay;
+        x->x_f = (double)cut_freq;
+        x->x_maxdel = 1000;
+    // ship off to the helper method to deal with allocation if necessary
+        pluck_sz(x);
+        
+        if(x->x_freq > 1){
+            update_time(x, x->x_freq);
+            update_fb(x, x->x_ain, x->x_delms);
+        }
+        if(x->x_f >= 0)
+            update_coeffs(x, x->x_f);
+    }
+// inlets / outlet, the frequencies of a bank come from messages
+    if(!x->x_bank){
+        x->x_freq_inlet = inlet_new((t_object *)x, (t_pd *)x, &s_signal, &s_signal);
+            pd_float((t_pd *)x->x_freq_inlet, freq);
     }
-    if(x->x_f >= 0)
-        update_coeffs(x, x->x_f);
-// inlets / outlet
-    x->x_freq_inlet = inlet_new((t_object *)x, (t_pd *)x, &s_signal, &s_signal);
-        pd_float((t_pd *)x->x_freq_inlet, freq);
     x->x_decay_inlet = inlet_new((t_object *)x, (t_pd *)x, &s_signal, &s_signal); // decay time
         pd_float((t_pd *)x->x_decay_inlet, decay);
     x->x_cutoff_inlet = inlet_new((t_object *)x, (t_pd *)x, &s_signal, &s_signal);
@@ -400,7 +724,18 @@ errstate:
 static void * pluck_free(t_pluck *x){
     if(x->x_alloc)
         free(x->x_ybuf);
-    inlet_free(x->x_freq_inlet);
+    if(x->x_bank){
+        int size = x->x_nblock * PLUCK_LANES;
+        freebytes(x->x_strings, x->x_bank * sizeof(t_pluckstring));
+        freebytes(x->x_active, x->x_bank * sizeof(int));
+        freebytes(x->x_arena, x->x_bank * x->x_len * sizeof(t_float));
+        freebytes(x->x_xs, size * sizeof(t_float));
+        freebytes(x->x_ys, size * sizeof(t_float));
+        freebytes(x->x_noise, x->x_nblock * sizeof(t_float));
+        freebytes(x->x_in, x->x_nblock * sizeof(t_float));
+    }
+    else
+        inlet_free(x->x_freq_inlet);
     inlet_free(x->x_decay_inlet);
     inlet_free(x->x_cutoff_inlet);
     return(void *)x;
@@ -414,4 +749,6 @@ void pluck_tilde_setup(void){
     class_addbang(pluck_class, pluck_bang);
     class_addmethod(pluck_class, (t_method)pluck_dsp, gensym("dsp"), A_CANT, 0);
     class_addmethod(pluck_class, (t_method)pluck_clear, gensym("clear"), 0);
+    class_addmethod(pluck_class, (t_method)pluck_freq, gensym("freq"), A_GIMME, 0);
+    class_addlist(pluck_class, pluck_list);
 }
@@ -10,6 +10,8 @@
 #include "elsefile.h"
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <limits.h>
 
 #ifdef FLT_MAX
 #define SHARED_FLT_MAX  FLT_MAX
@@ -20,9 +22,27 @@
 #define REC_MAXTRACKS       64
 #define REC_FILEBUFSIZE     4096
 #define REC_FILEMAXCOLUMNS  78
+#define REC_INISIZE         64      // events and atoms of a new track
+#define REC_MAXHINT         (1 << 20) // counts read from a file that are preallocated
+#define REC_MAXSTACK        64      // atoms of an event unpacked on the stack
+#define REC_BINMAGIC        "elserec"
+#define REC_BINVERSION      1
 
 enum{REC_STOPMODE, REC_RECMODE, REC_PLAYMODE};
 
+/* A track keeps its events in two arrays: the events with their deltas, and
+   an arena with the atoms of all of them, one after the other. The atoms are
+   packed as words, and their types are in a byte array at the end of the
+   arena, so an atom takes 9 bytes instead of the 16 of a t_atom, and
+   playback steps from one event to the next without scanning for deltas
+   and semicolons. */
+typedef struct _rec_event{
+    double         e_delta;     // ms since the previous event
+    double         e_time;      // ms from the start of the track, for seeking
+    int            e_onset;     // first atom in the arena
+    int            e_natoms;
+}t_rec_event;
+
 typedef struct _rec_track{
     t_pd           tr_pd;
     struct _rec   *tr_owner;
@@ -31,9 +51,16 @@ typedef struct _rec_track{
     int            tr_mode;
     int            tr_muted;
     int            tr_restarted;
-    t_atom        *tr_atdelta;
-    int            tr_ixnext;
-    t_binbuf      *tr_binbuf;
+    int            tr_ixnext;       // next event
+    int            tr_due;          // its delta has elapsed
+    double         tr_pos;          // ms from the start of the track
+    t_rec_event   *tr_events;
+    int            tr_nevents;
+    int            tr_eventsize;    // as allocated
+    t_word        *tr_words;        // the arena
+    unsigned char *tr_types;        // its end
+    int            tr_natoms;
+    int            tr_atomsize;     // as allocated
     float          tr_tempo;
     double         tr_clockdelay;
     double         tr_prevtime;
@@ -49,7 +76,12 @@ typedef struct _rec{
     int            x_ntracks;  
     t_rec_track  **x_tracks;
     t_elsefile    *x_elsefilehandle;
+    int            x_bin;           // 'save -bin', for the save dialog too
     t_outlet      *x_bangout;
+    int            x_loop;
+    double         x_loopstart;     // ms
+    double         x_loopend;       // ms, the end of the longest track if not after start
+    double         x_gotoms;        // for rec_track_goto()
 }t_rec;
 
 static t_class *rec_track_class;
@@ -65,69 +97,149 @@ static void check_EOT(t_rec *x){
     outlet_bang(x->x_bangout);
 }
 
+// room for 'nevents' events and 'natoms' atoms
+static int rec_track_grow(t_rec_track *tp, int nevents, int natoms){
+    if(nevents > tp->tr_eventsize){
+        int size = tp->tr_eventsize ? tp->tr_eventsize : REC_INISIZE;
+        t_rec_event *events;
+        while(size < nevents){
+            if(size > INT_MAX / 2)
+                return(0);
+            size *= 2;
+        }
+        if((size_t)size > SIZE_MAX / sizeof(*events) || !(events = resizebytes(tp->tr_events,
+        tp->tr_eventsize * sizeof(*events), size * sizeof(*events))))
+            return(0);
+        tp->tr_events = events;
+        tp->tr_eventsize = size;
+    }
+    if(natoms > tp->tr_atomsize){
+        int old = tp->tr_atomsize, size = old ? old : REC_INISIZE;
+        size_t atomsize = sizeof(t_word) + 1;
+        char *arena;
+        while(size < natoms){
+            if(size > INT_MAX / 2)
+                return(0);
+            size *= 2;
+        }
+        if((size_t)size > SIZE_MAX / atomsize || !(arena = resizebytes(tp->tr_words, old * atomsize, size * atomsize)))
+            return(0);
+        // the types move up to the new end
+        memmove(arena + size * sizeof(t_word), arena + old * sizeof(t_word), old);
+        tp->tr_words = (t_word *)arena;
+        tp->tr_types = (unsigned char *)(arena + size * sizeof(t_word));
+        tp->tr_atomsize = size;
+    }
+    return(1);
+}
+
+// a new event, its atoms come with rec_track_addatoms()
+static int rec_track_newevent(t_rec_track *tp, double delta){
+    t_rec_event *ep;
+    if(!rec_track_grow(tp, tp->tr_nevents + 1, 0))
+        return(0);
+    ep = &tp->tr_events[tp->tr_nevents++];
+    ep->e_delta = delta;
+    ep->e_time = (delta > 0. ? delta : 0.) + (tp->tr_nevents > 1 ? ep[-1].e_time : 0.);
+    ep->e_onset = tp->tr_natoms;
+    ep->e_natoms = 0;
+    return(1);
+}
+
+static int rec_track_addatoms(t_rec_track *tp, int ac, t_atom *av){
+    if(!rec_track_grow(tp, 0, tp->tr_natoms + ac))
+        return(0);
+    for(int i = 0; i < ac; i++, av++){
+        tp->tr_words[tp->tr_natoms] = av->a_w;
+        tp->tr_types[tp->tr_natoms++] = av->a_type;
+    }
+    tp->tr_events[tp->tr_nevents - 1].e_natoms += ac;
+    return(1);
+}
+
+static void rec_track_output(t_rec_track *tp, t_rec_event *ep){
+    t_atom stackvec[REC_MAXSTACK], *vec = stackvec;
+    int ac = ep->e_natoms;
+    if(ac > REC_MAXSTACK && !(vec = getbytes(ac * sizeof(*vec))))
+        return;
+    for(int i = 0; i < ac; i++){
+        vec[i].a_type = tp->tr_types[ep->e_onset + i];
+        vec[i].a_w = tp->tr_words[ep->e_onset + i];
+    }
+    if(vec->a_type == A_FLOAT)
+        outlet_list(tp->tr_trackout, &s_list, ac, vec);
+    else if(vec->a_type == A_SYMBOL)
+        outlet_anything(tp->tr_trackout, vec->a_w.w_symbol, ac-1, vec+1);
+    if(vec != stackvec)
+        freebytes(vec, ac * sizeof(*vec));
+}
+
+// the next event is the first at or after 'ms'
+static void rec_track_seek(t_rec_track *tp, double ms){
+    int lo = 0, hi = tp->tr_nevents;
+    while(lo < hi){
+        int mid = (lo + hi) / 2;
+        if(tp->tr_events[mid].e_time < ms)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    tp->tr_ixnext = lo;
+    tp->tr_pos = ms;
+    tp->tr_due = 0;
+}
+
+// the loop end, or 0 if there's no loop to play
+static double rec_getloopend(t_rec *x){
+    double end = x->x_loopend;
+    if(!x->x_loop)
+        return(0.);
+    if(end <= x->x_loopstart){ // the end of the longest track
+        end = 0.;
+        for(int i = 0; i < x->x_ntracks; i++){
+            t_rec_track *tp = x->x_tracks[i];
+            if(tp->tr_nevents && tp->tr_events[tp->tr_nevents - 1].e_time > end)
+                end = tp->tr_events[tp->tr_nevents - 1].e_time;
+        }
+    }
+    // at least a millisecond, or loops of nothing would hang the scheduler
+    return(end - x->x_loopstart >= 1. ? end : 0.);
+}
+
 static void rec_track_donext(t_rec_track *tp){
-    if(tp->tr_ixnext < 0)
-        goto endoftrack;
     while(1){
-        int natoms = binbuf_getnatom(tp->tr_binbuf);
-        int ixmess = tp->tr_ixnext;
-        t_atom *atmess;
-        int last_item = (ixmess >= (natoms - 2));
-        if(ixmess >= natoms)
-            goto endoftrack;
-        atmess = binbuf_getvec(tp->tr_binbuf) + ixmess;
-        while(atmess->a_type == A_SEMI){
-            if(++ixmess >= natoms)
-                goto endoftrack;
-            atmess++;
-        }
-        if(!tp->tr_atdelta && atmess->a_type == A_FLOAT){  // delta atom
-            float delta = atmess->a_w.w_float;
-            if(delta < 0.)
-                delta = 0.;
-            tp->tr_atdelta = atmess;
-            tp->tr_ixnext = ixmess + 1;
-            if(tp->tr_mode == REC_PLAYMODE){
-                clock_delay(tp->tr_clock, tp->tr_clockdelay = delta * tp->tr_tempo);
-                tp->tr_prevtime = clock_getlogicaltime();
-            }
-            else if(ixmess < 2)  // LATER rethink
-                continue;  // CHECKED first delta skipped
-            else{  // CHECKED this is not blocked with the muted flag
-                t_atom at[2];
-                SETFLOAT(&at[0], tp->tr_id);
-                SETFLOAT(&at[1], delta);
-            }
+        int end = (tp->tr_ixnext >= tp->tr_nevents);
+        double next = end ? 0. : tp->tr_events[tp->tr_ixnext].e_time;
+        double loopend = rec_getloopend(tp->tr_owner);
+        int wrap = (loopend > 0. && (end || next >= loopend));
+        t_rec_event *ep;
+        if(end && !wrap)
+            break;
+        if(!tp->tr_due){ // wait for the delta first
+            double delta = (wrap ? loopend : next) - tp->tr_pos;
+            tp->tr_due = 1;
+            clock_delay(tp->tr_clock, tp->tr_clockdelay = (delta > 0. ? delta : 0.) * tp->tr_tempo);
+            tp->tr_prevtime = clock_getlogicaltime();
             return;
         }
-        else{  // message beginning
-            int wasrestarted = tp->tr_restarted;  // LATER rethink
-            int ixnext = ixmess + 1;
-            t_atom *atnext = atmess + 1;
-            while(ixnext < natoms && atnext->a_type != A_SEMI)
-                ixnext++, atnext++;
+        if(wrap){ // tracks wrap at the same time, so they stay together
+            rec_track_seek(tp, tp->tr_owner->x_loopstart);
+            continue;
+        }
+        ep = &tp->tr_events[tp->tr_ixnext++];
+        tp->tr_due = 0;
+        tp->tr_pos = next;
+        // CHECKED a last single atom message is not sent (the 'EOT' of a recording)
+        if(!tp->tr_muted && ep->e_natoms
+        && (tp->tr_ixnext < tp->tr_nevents || ep->e_natoms > 1)){
             tp->tr_restarted = 0;
-            if(!tp->tr_muted){
-                int ac = ixnext - ixmess;
-                if(!last_item){
-                    if(atmess->a_type == A_FLOAT)
-                        outlet_list(tp->tr_trackout, &s_list, ac, atmess);
-                    else if(atmess->a_type == A_SYMBOL)
-                        outlet_anything(tp->tr_trackout, atmess->a_w.w_symbol, ac-1, atmess+1);
-                }
-            }
-            tp->tr_atdelta = 0;
-            tp->tr_ixnext = ixnext;
-            if(tp->tr_restarted)
-                return;
-            tp->tr_restarted = wasrestarted;
+            rec_track_output(tp, ep);
+            if(tp->tr_restarted || tp->tr_mode != REC_PLAYMODE)
+                return; // protecting against outlet -> 'play', 'stop' etc.
         }
     }
-endoftrack:
-    if(tp->tr_mode == REC_PLAYMODE){
-        tp->tr_ixnext = 0; // ready to go in stop mode after play
-    }
-    tp->tr_atdelta = 0;
+    tp->tr_ixnext = 0; // ready to go in stop mode after play
+    tp->tr_due = 0;
     tp->tr_prevtime = 0.;
     tp->tr_mode = REC_STOPMODE;
     check_EOT(tp->tr_owner);
@@ -140,6 +252,10 @@ static void rec_track_tick(t_rec_track *tp){
     }
 }
 
+static void rec_track_clear(t_rec_track *tp){
+    tp->tr_nevents = tp->tr_natoms = 0;
+}
+
 static void rec_track_setmode(t_rec_track *tp, int newmode){
     if(tp->tr_mode == REC_PLAYMODE){
         clock_unset(tp->tr_clock);
@@ -149,13 +265,13 @@ static void rec_track_setmode(t_rec_track *tp, int newmode){
         case REC_STOPMODE:
             break;
         case REC_RECMODE:
-            binbuf_clear(tp->tr_binbuf);
+            rec_track_clear(tp);
             tp->tr_prevtime = clock_getlogicaltime();
             break;
         case REC_PLAYMODE:
-            tp->tr_atdelta = 0;
-            tp->tr_ixnext = 0;
+            rec_track_seek(tp, 0.);
             tp->tr_prevtime = 0.;
+            tp->tr_restarted = 1;
             rec_track_donext(tp);
             break;
         default:
@@ -165,14 +281,9 @@ static void rec_track_setmode(t_rec_track *tp, int newmode){
 
 static void rec_track_doadd(t_rec_track *tp, int ac, t_atom *av){
     if(tp->tr_prevtime > 0.){
-        t_binbuf *bb = tp->tr_binbuf;
-        t_atom at;
-    	float elapsed = clock_gettimesince(tp->tr_prevtime);
-        SETFLOAT(&at, elapsed);
-        binbuf_add(bb, 1, &at);
-        binbuf_add(bb, ac, av);
-        SETSEMI(&at);
-        binbuf_add(bb, 1, &at);
+        if(!rec_track_newevent(tp, clock_gettimesince(tp->tr_prevtime))
+        || !rec_track_addatoms(tp, ac, av))
+            pd_error(tp->tr_owner, "[rec]: not enough memory to record");
         tp->tr_prevtime = clock_getlogicaltime();
     }
 }
@@ -247,6 +358,19 @@ static void rec_track_anything(t_rec_track *tp, t_symbol *s, int ac, t_atom *av)
     }
 }
 
+// play from 'x_gotoms', a track that is playing jumps there
+static void rec_track_goto(t_rec_track *tp){
+    if(tp->tr_mode == REC_RECMODE)
+        return;
+    if(tp->tr_mode == REC_PLAYMODE)
+        clock_unset(tp->tr_clock);
+    tp->tr_mode = REC_PLAYMODE;
+    rec_track_seek(tp, tp->tr_owner->x_gotoms);
+    tp->tr_prevtime = 0.;
+    tp->tr_restarted = 1;
+    rec_track_donext(tp);
+}
+
 static void rec_track_record(t_rec_track *tp){
     rec_track_setmode(tp, REC_RECMODE);
 }
@@ -274,10 +398,6 @@ static void rec_track_unmute(t_rec_track *tp){
     tp->tr_muted = 0;
 }
 
-static void rec_track_clear(t_rec_track *tp){
-    binbuf_clear(tp->tr_binbuf);
-}
-
 static void rec_track_speed(t_rec_track *tp, t_floatarg f){
     float newtempo;
     if(f < 1e-20)
@@ -330,6 +450,32 @@ static void rec_speed(t_rec *x, t_floatarg f){
         rec_track_speed(*tpp++, f);
 }
 
+// 'goto <ms> <list>': all tracks or the listed ones play from 'ms'
+static void rec_goto(t_rec *x, t_symbol *s, int ac, t_atom *av){
+    if(!ac || av->a_type != A_FLOAT){
+        pd_error(x, "[rec]: goto needs a time in ms");
+        return;
+    }
+    x->x_gotoms = atom_getfloat(av) > 0 ? atom_getfloat(av) : 0.;
+    rec_calltracks(x, rec_track_goto, s, ac-1, av+1);
+}
+
+// 'loop <float>' loops all tracks, 'loop <start> <end>' loops from 'start'
+// to 'end' in ms, an end that isn't after the start is the end of the
+// longest track
+static void rec_loop(t_rec *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    if(ac >= 2){
+        x->x_loop = 1;
+        x->x_loopstart = atom_getfloat(av) > 0 ? atom_getfloat(av) : 0.;
+        x->x_loopend = atom_getfloat(av+1);
+    }
+    else{
+        x->x_loop = ac ? (atom_getfloat(av) != 0) : 1;
+        x->x_loopstart = x->x_loopend = 0.;
+    }
+}
+
 static void rec_record(t_rec *x, t_symbol *s, int ac, t_atom *av){
     rec_calltracks(x, rec_track_record, s, ac, av);
 }
@@ -354,6 +500,176 @@ static void rec_clear(t_rec *x, t_symbol *s, int ac, t_atom *av){
     rec_calltracks(x, rec_track_clear, s, ac, av);
 }
 
+/* Binary files start with REC_BINMAGIC and a version byte, then come the
+   nonempty tracks, each as its id, number of events and number of atoms,
+   followed by the events: the delta, the number of atoms and the atoms.
+   An atom is a type byte and its value: 'f' a float32, 'd' a float64 (for
+   floats that don't fit in 32 bits), 's' a symbol as its length in 16 bits
+   and its characters, ',' a comma, '$' a dollar as its index in 32 bits and
+   '#' a dollsym like a symbol. All numbers are little endian, so files
+   can be read as a stream on any machine. */
+static void rec_put32(unsigned char *bp, uint32_t n){
+    for(int i = 0; i < 4; i++, n >>= 8)
+        bp[i] = n & 0xff;
+}
+
+static uint32_t rec_get32(unsigned char *bp){
+    return(bp[0] | (bp[1] << 8) | (bp[2] << 16) | ((uint32_t)bp[3] << 24));
+}
+
+static void rec_putdouble(unsigned char *bp, double d){
+    uint64_t n;
+    memcpy(&n, &d, 8);
+    for(int i = 0; i < 8; i++, n >>= 8)
+        bp[i] = n & 0xff;
+}
+
+static double rec_getdouble(unsigned char *bp){
+    uint64_t n = 0;
+    double d;
+    for(int i = 7; i >= 0; i--)
+        n = (n << 8) | bp[i];
+    memcpy(&d, &n, 8);
+    return(d);
+}
+
+static int rec_readatom(FILE *fp, t_atom *ap){
+    unsigned char buf[MAXPDSTRING];
+    int type = getc(fp);
+    if(type == 'f'){
+        uint32_t n;
+        float f;
+        if(fread(buf, 1, 4, fp) < 4)
+            return(0);
+        n = rec_get32(buf);
+        memcpy(&f, &n, 4);
+        SETFLOAT(ap, f);
+    }
+    else if(type == 'd'){
+        if(fread(buf, 1, 8, fp) < 8)
+            return(0);
+        SETFLOAT(ap, rec_getdouble(buf));
+    }
+    else if(type == '$'){
+        if(fread(buf, 1, 4, fp) < 4)
+            return(0);
+        SETDOLLAR(ap, (int32_t)rec_get32(buf));
+    }
+    else if(type == 's' || type == '#'){
+        int length;
+        if(fread(buf, 1, 2, fp) < 2)
+            return(0);
+        if((length = buf[0] | (buf[1] << 8)) >= MAXPDSTRING
+        || fread(buf, 1, length, fp) < (size_t)length)
+            return(0);
+        buf[length] = 0;
+        if(type == '#')
+            SETDOLLSYM(ap, gensym((char *)buf));
+        else
+            SETSYMBOL(ap, gensym((char *)buf));
+    }
+    else if(type == ',')
+        SETCOMMA(ap);
+    else
+        return(0);
+    return(1);
+}
+
+// returns 0 if the file is truncated or corrupted, or out of memory
+static int rec_readbin(t_rec *x, FILE *fp){
+    unsigned char buf[12];
+    t_rec_track *tp;
+    size_t n;
+    while((n = fread(buf, 1, 12, fp)) == 12){
+        int id = (int32_t)rec_get32(buf);
+        int nevents = (int32_t)rec_get32(buf + 4), natoms = (int32_t)rec_get32(buf + 8);
+        tp = 0;
+        if(nevents < 0 || natoms < 0)
+            return(0);
+        if(id < 1 || id > x->x_ntracks)
+            post("[rec] cann't load track %d... no such track", id);
+        else{
+            tp = x->x_tracks[id - 1];
+            rec_track_clear(tp);
+            // the counts are only hints, the track grows as the events come
+            rec_track_grow(tp, nevents < REC_MAXHINT ? nevents : REC_MAXHINT,
+                natoms < REC_MAXHINT ? natoms : REC_MAXHINT);
+        }
+        for(int i = 0; i < nevents; i++){
+            int count;
+            if(fread(buf, 1, 12, fp) < 12 || (count = (int32_t)rec_get32(buf + 8)) < 0)
+                return(0);
+            if(tp && !rec_track_newevent(tp, rec_getdouble(buf)))
+                goto nomemory;
+            while(count--){
+                t_atom at;
+                if(!rec_readatom(fp, &at))
+                    return(0);
+                if(tp && !rec_track_addatoms(tp, 1, &at))
+                    goto nomemory;
+            }
+        }
+    }
+    return(n == 0);
+nomemory:
+    pd_error(x, "[rec]: not enough memory to read track %d", tp->tr_id);
+    return(0);
+}
+
+/* text files: a 'track <id>;' line, then the events as messages led by their
+   delta, up to an 'end;' line. Long messages are wrapped over lines. */
+static void rec_readtext(t_rec *x, FILE *fp){
+    t_rec_track *tp = 0;
+    int inevent = 0;
+    char linebuf[REC_FILEBUFSIZE];
+    t_binbuf *bb = binbuf_new();
+    while(fgets(linebuf, REC_FILEBUFSIZE, fp)){
+        char *line = linebuf;
+        int linelen;
+        while(*line && (*line == ' ' || *line == '\t')) line++;
+        if((linelen = strlen(line))){
+            if(tp){
+                if(!strncmp(line, "end;", 4))
+                    tp = 0;
+                else{
+                    int ac, ok = 1;
+                    t_atom *ap;
+                    binbuf_text(bb, line, linelen);
+                    ac = binbuf_getnatom(bb);
+                    for(ap = binbuf_getvec(bb); ok && ac--; ap++){
+                        if(ap->a_type == A_SEMI)
+                            inevent = 0;
+                        else if(!inevent){ // CHECKED no delta is 0, negative is 0
+                            int isdelta = (ap->a_type == A_FLOAT);
+                            double delta = isdelta && ap->a_w.w_float > 0. ? ap->a_w.w_float : 0.;
+                            inevent = 1;
+                            ok = rec_track_newevent(tp, delta)
+                                && (isdelta || rec_track_addatoms(tp, 1, ap));
+                        }
+                        else
+                            ok = rec_track_addatoms(tp, 1, ap);
+                    }
+                    if(!ok){
+                        pd_error(x, "[rec]: not enough memory to read track %d", tp->tr_id);
+                        tp = 0;
+                    }
+                }
+            }
+            else if(!strncmp(line, "track ", 6)){
+                int id = strtol(line + 6, 0, 10);
+                if(id < 1 || id > x->x_ntracks)
+                    post("[rec] cann't load track %d... no such track", id);  // LATER rethink
+                else
+                    tp = x->x_tracks[id - 1];
+                if(tp)
+                    rec_track_clear(tp);
+                inevent = 0;
+            }
+        }
+    }
+    binbuf_free(bb);
+}
+
 static void rec_doread(t_rec *x, t_symbol *fname){
     char path[MAXPDSTRING];
     char *bufptr;
@@ -367,49 +683,23 @@ static void rec_doread(t_rec *x, t_symbol *fname){
         return;
     }
     FILE *fp;
-    if((fp = sys_fopen(path, "r"))){
-        t_rec_track *tp = 0;
-        char linebuf[REC_FILEBUFSIZE];
-        t_binbuf *bb = binbuf_new();
-        while(fgets(linebuf, REC_FILEBUFSIZE, fp)){
-            char *line = linebuf;
-            int linelen;
-            while(*line && (*line == ' ' || *line == '\t')) line++;
-            if((linelen = strlen(line))){
-                if(tp){
-                    if(!strncmp(line, "end;", 4))
-                        tp = 0;
-                    else{
-                        int ac;
-                        binbuf_text(bb, line, linelen);
-                        if((ac = binbuf_getnatom(bb))){
-                            t_atom *ap = binbuf_getvec(bb);
-                            if(!binbuf_getnatom(tp->tr_binbuf)){
-                                if(ap->a_type != A_FLOAT){
-                                    t_atom at;
-                                    SETFLOAT(&at, 0.);
-                                    binbuf_add(tp->tr_binbuf, 1, &at);
-                                }
-                                else if(ap->a_w.w_float < 0.)
-                                    ap->a_w.w_float = 0.;
-                            }
-                            binbuf_add(tp->tr_binbuf, ac, ap);
-                        }
-                    }
-                }
-                else if(!strncmp(line, "track ", 6)){
-                    int id = strtol(line + 6, 0, 10);
-                    if(id < 1 || id > x->x_ntracks)
-                        post("[rec] cann't load track %d... no such track", id);  // LATER rethink
-                    else
-                        tp = x->x_tracks[id - 1];
-                    if(tp)
-                        binbuf_clear(tp->tr_binbuf);
-                }
+    if((fp = sys_fopen(path, "rb"))){
+        char magic[sizeof(REC_BINMAGIC) + 1];
+        // anything without a valid binary header is read as text
+        if(fread(magic, 1, sizeof(magic), fp) == sizeof(magic)
+        && !memcmp(magic, REC_BINMAGIC, sizeof(REC_BINMAGIC))
+        && magic[sizeof(REC_BINMAGIC)] == REC_BINVERSION){
+            if(!rec_readbin(x, fp))
+                pd_error(x, "[rec]: bad binary file \"%s\" (truncated or corrupted)", path);
+            fclose(fp);
+        }
+        else{
+            fclose(fp);
+            if((fp = sys_fopen(path, "r"))){
+                rec_readtext(x, fp);
+                fclose(fp);
             }
         }
-        fclose(fp);
-        binbuf_free(bb);
     }
     else
         panel_click_open(x->x_elsefilehandle);
@@ -417,49 +707,60 @@ static void rec_doread(t_rec *x, t_symbol *fname){
 
 static int rec_writetrack(t_rec *x, t_rec_track *tp, FILE *fp){
     x = NULL;
-    int natoms = binbuf_getnatom(tp->tr_binbuf);
-    if(natoms) { /* CHECKED empty tracks not stored */
+    if(tp->tr_nevents) { /* CHECKED empty tracks not stored */
         char sbuf[REC_FILEBUFSIZE], *bp = sbuf, *ep = sbuf + REC_FILEBUFSIZE;
         int ncolumn = 0;
-        t_atom *ap = binbuf_getvec(tp->tr_binbuf);
         fprintf(fp, "track %d;\n", tp->tr_id);
-        for(; natoms--; ap++){
-            int length;
-            // from binbuf_write():
-	       // ``estimate how many characters will be needed.  Printing out
-	       // symbols may need extra characters for inserting backslashes.''
-            if(ap->a_type == A_SYMBOL || ap->a_type == A_DOLLSYM)
-                length = 80 + strlen(ap->a_w.w_symbol->s_name);
-            else
-                length = 40;
-            if(bp > sbuf && ep - bp < length){
-                if(fwrite(sbuf, bp - sbuf, 1, fp) < 1)
-                    return(1);
-                bp = sbuf;
-            }
-            if(ap->a_type == A_SEMI){
-                *bp++ = ';';
-                *bp++ = '\n';
-                ncolumn = 0;
-            }
-            else if(ap->a_type == A_COMMA){
-                *bp++ = ',';
-                ncolumn++;
-            }
-            else{
-                if(ncolumn){
-                    *bp++ = ' ';
+        for(int i = 0; i < tp->tr_nevents; i++){
+            t_rec_event *evp = &tp->tr_events[i];
+            // the delta, the atoms and a semicolon
+            for(int j = -1; j <= evp->e_natoms; j++){
+                t_atom at, *ap = &at;
+                int length;
+                if(j < 0)
+                    SETFLOAT(ap, evp->e_delta);
+                else if(j == evp->e_natoms)
+                    SETSEMI(ap);
+                else{
+                    ap->a_type = tp->tr_types[evp->e_onset + j];
+                    ap->a_w = tp->tr_words[evp->e_onset + j];
+                }
+                // from binbuf_write():
+                // ``estimate how many characters will be needed.  Printing out
+                // symbols may need extra characters for inserting backslashes.''
+                if(ap->a_type == A_SYMBOL || ap->a_type == A_DOLLSYM)
+                    length = 80 + strlen(ap->a_w.w_symbol->s_name);
+                else
+                    length = 40;
+                if(bp > sbuf && ep - bp < length){
+                    if(fwrite(sbuf, bp - sbuf, 1, fp) < 1)
+                        return(1);
+                    bp = sbuf;
+                }
+                if(ap->a_type == A_SEMI){
+                    *bp++ = ';';
+                    *bp++ = '\n';
+                    ncolumn = 0;
+                }
+                else if(ap->a_type == A_COMMA){
+                    *bp++ = ',';
                     ncolumn++;
                 }
-                atom_string(ap, bp, (ep - bp) - 2);
-                length = strlen(bp);
-                if(ncolumn && ncolumn + length > REC_FILEMAXCOLUMNS){
-                    bp[-1] = '\n';
-                    ncolumn = length;
+                else{
+                    if(ncolumn){
+                        *bp++ = ' ';
+                        ncolumn++;
+                    }
+                    atom_string(ap, bp, (ep - bp) - 2);
+                    length = strlen(bp);
+                    if(ncolumn && ncolumn + length > REC_FILEMAXCOLUMNS){
+                        bp[-1] = '\n';
+                        ncolumn = length;
+                    }
+                    else
+                        ncolumn += length;
+                    bp += length;
                 }
-                else
-                    ncolumn += length;
-                bp += length;
             }
         }
         if(bp > sbuf && fwrite(sbuf, bp - sbuf, 1, fp) < 1)
@@ -470,9 +771,73 @@ static int rec_writetrack(t_rec *x, t_rec_track *tp, FILE *fp){
     return(0);
 }
 
+static int rec_writebintrack(t_rec_track *tp, FILE *fp){
+    unsigned char buf[MAXPDSTRING + 3];
+    if(!tp->tr_nevents)
+        return(0);
+    rec_put32(buf, tp->tr_id);
+    rec_put32(buf + 4, tp->tr_nevents);
+    rec_put32(buf + 8, tp->tr_natoms);
+    if(fwrite(buf, 1, 12, fp) < 12)
+        return(1);
+    for(int i = 0; i < tp->tr_nevents; i++){
+        t_rec_event *evp = &tp->tr_events[i];
+        rec_putdouble(buf, evp->e_delta);
+        rec_put32(buf + 8, evp->e_natoms);
+        if(fwrite(buf, 1, 12, fp) < 12)
+            return(1);
+        for(int j = evp->e_onset; j < evp->e_onset + evp->e_natoms; j++){
+            t_atom at;
+            size_t n;
+            at.a_type = tp->tr_types[j];
+            at.a_w = tp->tr_words[j];
+            if(at.a_type == A_FLOAT){
+                float f = at.a_w.w_float;
+                if(f == at.a_w.w_float){
+                    uint32_t u;
+                    memcpy(&u, &f, 4);
+                    buf[0] = 'f';
+                    rec_put32(buf + 1, u);
+                    n = 5;
+                }
+                else{
+                    buf[0] = 'd';
+                    rec_putdouble(buf + 1, at.a_w.w_float);
+                    n = 9;
+                }
+            }
+            else if(at.a_type == A_COMMA){
+                buf[0] = ',';
+                n = 1;
+            }
+            else if(at.a_type == A_DOLLAR){
+                buf[0] = '$';
+                rec_put32(buf + 1, at.a_w.w_index);
+                n = 5;
+            }
+            else{ // symbols, and anything else as its text
+                size_t length;
+                if(at.a_type == A_SYMBOL || at.a_type == A_DOLLSYM)
+                    strncpy((char *)buf + 3, at.a_w.w_symbol->s_name, MAXPDSTRING - 1);
+                else
+                    atom_string(&at, (char *)buf + 3, MAXPDSTRING - 1);
+                buf[3 + MAXPDSTRING - 1] = 0;
+                length = strlen((char *)buf + 3);
+                buf[0] = at.a_type == A_DOLLSYM ? '#' : 's';
+                buf[1] = length & 0xff;
+                buf[2] = length >> 8;
+                n = 3 + length;
+            }
+            if(fwrite(buf, 1, n, fp) < n)
+                return(1);
+        }
+    }
+    return(0);
+}
+
 // CHECKED empty sequence stored as an empty elsefile
 static void rec_dowrite(t_rec *x, t_symbol *fname){
-    int failed = 0;
+    int failed = 0, bin = x->x_bin;
     char path[MAXPDSTRING];
     FILE *fp;
     if(x->x_canvas)
@@ -481,18 +846,23 @@ static void rec_dowrite(t_rec *x, t_symbol *fname){
     	strncpy(path, fname->s_name, MAXPDSTRING);
     	path[MAXPDSTRING-1] = 0;
     }
-    if((fp = sys_fopen(path, "w"))){
+    if((fp = sys_fopen(path, bin ? "wb" : "w"))){
         int id;  // single-track writing does not seem to work (a bug?)
         t_rec_track **tpp;
-        for(id = 0, tpp = x->x_tracks; id < x->x_ntracks; id++, tpp++)
-            if((failed = rec_writetrack(x, *tpp, fp)))
-                break;
-        fclose(fp);
+        if(bin){
+            unsigned char magic[sizeof(REC_BINMAGIC) + 1] = REC_BINMAGIC;
+            magic[sizeof(REC_BINMAGIC)] = REC_BINVERSION;
+            failed = (fwrite(magic, 1, sizeof(magic), fp) < sizeof(magic));
+        }
+        for(id = 0, tpp = x->x_tracks; !failed && id < x->x_ntracks; id++, tpp++)
+            failed = bin ? rec_writebintrack(*tpp, fp) : rec_writetrack(x, *tpp, fp);
+        if(fclose(fp))
+            failed = 1;
     }
     else
         failed = 1;
     if(failed)
-        pd_error(x, "[rec]: writing text elsefile \"%s\" failed", path);
+        pd_error(x, "[rec]: writing %s elsefile \"%s\" failed", bin ? "binary" : "text", path);
 }
 
 static void rec_readhook(t_pd *z, t_symbol *fname, int ac, t_atom *av){
@@ -514,8 +884,14 @@ static void rec_read(t_rec *x, t_symbol *s){
         panel_click_open(x->x_elsefilehandle);
 }
 
-static void rec_write(t_rec *x, t_symbol *s){
-    if(s && s != &s_)
+static void rec_write(t_rec *x, t_symbol *s, int ac, t_atom *av){
+    s = &s_;
+    x->x_bin = 0;
+    if(ac && av->a_type == A_SYMBOL && atom_getsymbol(av) == gensym("-bin"))
+        x->x_bin = 1, ac--, av++;
+    if(ac && av->a_type == A_SYMBOL)
+        s = atom_getsymbol(av);
+    if(s != &s_)
         rec_dowrite(x, s);
     else
         panel_save(x->x_elsefilehandle, canvas_getdir(x->x_canvas), 0);
@@ -531,8 +907,10 @@ static void rec_free(t_rec *x){
         t_rec_track **tpp = x->x_tracks;
         while(ntracks--){
             t_rec_track *tp = *tpp++;
-            if(tp->tr_binbuf)
-                binbuf_free(tp->tr_binbuf);
+            if(tp->tr_events)
+                freebytes(tp->tr_events, tp->tr_eventsize * sizeof(*tp->tr_events));
+            if(tp->tr_words)
+                freebytes(tp->tr_words, tp->tr_atomsize * (sizeof(t_word) + 1));
             if(tp->tr_clock)
                 clock_free(tp->tr_clock);
 	    pd_free((t_pd *)tp);
@@ -563,7 +941,6 @@ static void *rec_new(t_symbol * s, int ac, t_atom *av){
     int i;
     for(i = 0, tpp = tracks; i < ntracks; i++, tpp++){
         *tpp = (t_rec_track *)pd_new(rec_track_class);
-        (*tpp)->tr_binbuf = binbuf_new();
         (*tpp)->tr_clock = clock_new(*tpp, (t_method)rec_track_tick);
     }
     x->x_canvas = canvas_getcurrent();
@@ -582,8 +959,8 @@ static void *rec_new(t_symbol * s, int ac, t_atom *av){
         tp->tr_mode = REC_STOPMODE;
         tp->tr_muted = 0;
         tp->tr_restarted = 0;
-        tp->tr_atdelta = 0;
         tp->tr_ixnext = 0;
+        tp->tr_due = 0;
         tp->tr_tempo = 1.;
         tp->tr_clockdelay = 0.;
         tp->tr_prevtime = 0.;
@@ -608,8 +985,10 @@ void rec_setup(void){
     class_addmethod(rec_class, (t_method)rec_unmute, gensym("unmute"), A_GIMME, 0);
     class_addmethod(rec_class, (t_method)rec_clear, gensym("clear"), A_GIMME, 0);
     class_addmethod(rec_class, (t_method)rec_read, gensym("open"), A_DEFSYM, 0);
-    class_addmethod(rec_class, (t_method)rec_write, gensym("save"), A_DEFSYM, 0);
+    class_addmethod(rec_class, (t_method)rec_write, gensym("save"), A_GIMME, 0);
     class_addmethod(rec_class, (t_method)rec_speed, gensym("speed"), A_DEFFLOAT, 0);
+    class_addmethod(rec_class, (t_method)rec_goto, gensym("goto"), A_GIMME, 0);
+    class_addmethod(rec_class, (t_method)rec_loop, gensym("loop"), A_GIMME, 0);
     class_addmethod(rec_class, (t_method)rec_click, gensym("click"), 0);
     elsefile_setup();
 }
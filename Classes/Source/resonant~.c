@@ -1,9 +1,7 @@
 // Porres 2017
 
 #include "m_pd.h"
-#include <math.h>
-
-#define PI 3.14159265358979323846
+#include "rbj.h"
 
 typedef struct _resonant{
     t_object    x_obj;
@@ -11,44 +9,16 @@ typedef struct _resonant{
     t_inlet    *x_inlet_freq;
     t_inlet    *x_inlet_q;
     t_outlet   *x_out;
-    t_float     x_nyq;
     int         x_bypass;
-    int         x_t60;
+    t_rbj       x_rbj;
     double      x_xnm1;
     double      x_xnm2;
     double      x_ynm1;
     double      x_ynm2;
-    double      x_f;
-    double      x_reson;
-    double      x_a0;
-    double      x_a2;
-    double      x_b1;
-    double      x_b2;
 }t_resonant;
 
 static t_class *resonant_class;
 
-static void update_coeffs(t_resonant *x, double f, double reson){
-    x->x_f = f;
-    x->x_reson = reson;
-    double omega = f * PI/x->x_nyq;
-    double q;
-    if(x->x_t60) // reson is t60 in ms
-        q = f * (PI * reson/1000) / log(1000);
-    else
-        q = reson;
-    if(q < 0.000001) // force bypass
-        x->x_a0 = 1, x->x_a2 = x->x_b1 = x->x_b2 = 0;
-    else{
-        double alphaQ = sin(omega) / (2*q);
-        double b0 = alphaQ + 1;
-        x->x_a0 = alphaQ*q / b0;
-        x->x_a2 = -x->x_a0;
-        x->x_b1 = 2*cos(omega) / b0;
-        x->x_b2 = (alphaQ - 1) / b0;
-    }
-}
-
 static t_int *resonant_perform(t_int *w){
     t_resonant *x = (t_resonant *)(w[1]);
     int nblock = (int)(w[2]);
@@ -60,7 +30,9 @@ static t_int *resonant_perform(t_int *w){
     double xnm2 = x->x_xnm2;
     double ynm1 = x->x_ynm1;
     double ynm2 = x->x_ynm2;
-    t_float nyq = x->x_nyq;
+    t_rbj *r = &x->x_rbj;
+    t_rbj_coeffs *c = &r->r_c;
+    double nyq = r->r_nyq;
     while(nblock--){
         double xn = *in1++, f = *in2++, reson = *in3++, yn;
         if(f < 0.000001)
@@ -70,9 +42,8 @@ static t_int *resonant_perform(t_int *w){
         if(x->x_bypass)
             *out++ = xn;
         else{
-            if(f != x->x_f || reson != x->x_reson)
-                update_coeffs(x, (double)f, (double)reson);
-            yn = x->x_a0 * xn + x->x_a2 * xnm2 + x->x_b1 * ynm1 + x->x_b2 * ynm2;
+            rbj_tick(r, f, reson, 0);
+            yn = c->a0 * xn + c->a2 * xnm2 + c->b1 * ynm1 + c->b2 * ynm2;
             *out++ = yn;
             xnm2 = xnm1;
             xnm1 = xn;
@@ -88,11 +59,7 @@ static t_int *resonant_perform(t_int *w){
 }
 
 static void resonant_dsp(t_resonant *x, t_signal **sp){
-    t_float nyq = sp[0]->s_sr / 2;
-    if(nyq != x->x_nyq){
-        x->x_nyq = nyq;
-        update_coeffs(x, x->x_f, x->x_reson);
-    }
+    rbj_nyq(&x->x_rbj, sp[0]->s_sr / 2);
     dsp_add(resonant_perform, 6, x, sp[0]->s_n, sp[0]->s_vec,sp[1]->s_vec, sp[2]->s_vec,
             sp[3]->s_vec);
 }
@@ -103,16 +70,22 @@ static void resonant_clear(t_resonant *x){
 
 static void resonant_bypass(t_resonant *x, t_floatarg f){
     x->x_bypass = (int)(f != 0);
-    update_coeffs(x, x->x_f, x->x_reson);
 }
 
 static void resonant_t60(t_resonant *x){
-    x->x_t60 = 1;
-    update_coeffs(x, x->x_f, x->x_reson);
+    rbj_bw(&x->x_rbj, 1);
 }
 
 static void resonant_q(t_resonant *x){
-    x->x_t60 = 0;
+    rbj_bw(&x->x_rbj, 0);
+}
+
+static void resonant_rate(t_resonant *x, t_floatarg f){
+    rbj_period(&x->x_rbj, (int)f);
+}
+
+static void resonant_fast(t_resonant *x, t_floatarg f){
+    rbj_fast(&x->x_rbj, (int)(f != 0));
 }
 
 static void *resonant_new(t_symbol *s, int argc, t_atom *argv){
@@ -149,9 +122,8 @@ static void *resonant_new(t_symbol *s, int argc, t_atom *argv){
         else
             goto errstate;
     };
-    x->x_t60 = t60;
-    x->x_nyq = sys_getsr()/2;
-    update_coeffs(x, (double)freq, (double)reson);
+    rbj_init(&x->x_rbj, RBJ_RESONANT, t60, sys_getsr()/2);
+    rbj_set(&x->x_rbj, freq, reson, 0);
     x->x_inlet_freq = inlet_new((t_object *)x, (t_pd *)x, &s_signal, &s_signal);
     pd_float((t_pd *)x->x_inlet_freq, freq);
     x->x_inlet_q = inlet_new((t_object *)x, (t_pd *)x, &s_signal, &s_signal);
@@ -170,6 +142,8 @@ void resonant_tilde_setup(void){
     class_addmethod(resonant_class, nullfn, gensym("signal"), 0);
     class_addmethod(resonant_class, (t_method)resonant_clear, gensym("clear"), 0);
     class_addmethod(resonant_class, (t_method)resonant_bypass, gensym("bypass"), A_DEFFLOAT, 0);
+    class_addmethod(resonant_class, (t_method)resonant_rate, gensym("rate"), A_FLOAT, 0);
+    class_addmethod(resonant_class, (t_method)resonant_fast, gensym("fast"), A_FLOAT, 0);
     class_addmethod(resonant_class, (t_method)resonant_t60, gensym("t60"), 0);
     class_addmethod(resonant_class, (t_method)resonant_q, gensym("q"), 0);
 }
@@ -0,0 +1,104 @@
+// Porres 2017, compiled version of the old abstraction
+
+#include "m_pd.h"
+#include "resonbank.h"
+
+static t_class *resonbank2_class;
+
+typedef struct _resonbank2_tilde{
+    t_object    x_obj;
+    t_float     x_f;
+    t_resonbank x_bank;
+}t_resonbank2_tilde;
+
+static void resonbank2_tilde_freq(t_resonbank2_tilde *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    resonbank_set(&x->x_bank, x, &x->x_bank.b_freq, ac, av, 0);
+}
+
+static void resonbank2_tilde_decay(t_resonbank2_tilde *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    resonbank_set(&x->x_bank, x, &x->x_bank.b_reson, ac, av, 0);
+}
+
+static void resonbank2_tilde_attack(t_resonbank2_tilde *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    resonbank_set(&x->x_bank, x, &x->x_bank.b_attack, ac, av, 0);
+}
+
+static void resonbank2_tilde_amp(t_resonbank2_tilde *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    resonbank_set(&x->x_bank, x, &x->x_bank.b_amp, ac, av, 0);
+}
+
+static void resonbank2_tilde_ramp(t_resonbank2_tilde *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    bank_ramp(&x->x_bank.b_bank, x, ac, av);
+}
+
+static void resonbank2_tilde_rampall(t_resonbank2_tilde *x, t_floatarg f){
+    bank_rampall(&x->x_bank.b_bank, f);
+}
+
+static void resonbank2_tilde_clear(t_resonbank2_tilde *x){
+    resonbank_clear(&x->x_bank);
+}
+
+static t_int *resonbank2_tilde_perform(t_int *w){
+    t_resonbank2_tilde *x = (t_resonbank2_tilde *)(w[1]);
+    resonbank_perform(&x->x_bank, (int)(w[2]), (t_float *)(w[3]), (t_float *)(w[4]));
+    return(w+5);
+}
+
+static void resonbank2_tilde_dsp(t_resonbank2_tilde *x, t_signal **sp){
+    resonbank_sr(&x->x_bank, sp[0]->s_sr);
+    dsp_add(resonbank2_tilde_perform, 4, x, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec);
+}
+
+static void resonbank2_tilde_free(t_resonbank2_tilde *x){
+    resonbank_free(&x->x_bank);
+}
+
+static void *resonbank2_tilde_new(t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    t_resonbank2_tilde *x = (t_resonbank2_tilde *)pd_new(resonbank2_class);
+    t_bank_flag flags[] = {
+        {"-freq", 1, 0, NULL},
+        {"-decay", 1, 0, NULL},
+        {"-amp", 1, 0, NULL},
+        {"-ramp", 1, 0, NULL},
+        {"-rampall", 0, 0, NULL},
+        {"-attack", 1, 0, NULL}
+    };
+    int n = bank_getflags(x, &ac, &av, flags, 6);
+    t_float ramp = flags[4].f_ac ? atom_getfloat(flags[4].f_av) : 10;
+    if(!n){ // no list flags: number of filters, ramp time
+        if(ac && av->a_type == A_FLOAT)
+            n = atom_getfloat(av), ac--, av++;
+        if(ac && av->a_type == A_FLOAT)
+            ramp = atom_getfloat(av), ac--, av++;
+    }
+    resonbank_init(&x->x_bank, RESONBANK_RESON2, n, ramp);
+    if(flags[3].f_ac)
+        bank_ramp(&x->x_bank.b_bank, x, flags[3].f_ac, flags[3].f_av);
+    t_bank_param *p[] = {&x->x_bank.b_freq, &x->x_bank.b_reson, &x->x_bank.b_amp,
+        NULL, NULL, &x->x_bank.b_attack};
+    for(int i = 0; i < 6; i++) if(p[i] && flags[i].f_ac)
+        resonbank_set(&x->x_bank, x, p[i], flags[i].f_ac, flags[i].f_av, 1);
+    outlet_new(&x->x_obj, &s_signal);
+    return(x);
+}
+
+void resonbank2_tilde_setup(void){
+    resonbank2_class = class_new(gensym("resonbank2~"), (t_newmethod)resonbank2_tilde_new,
+        (t_method)resonbank2_tilde_free, sizeof(t_resonbank2_tilde), 0, A_GIMME, 0);
+    CLASS_MAINSIGNALIN(resonbank2_class, t_resonbank2_tilde, x_f);
+    class_addmethod(resonbank2_class, (t_method)resonbank2_tilde_dsp, gensym("dsp"), A_CANT, 0);
+    class_addmethod(resonbank2_class, (t_method)resonbank2_tilde_freq, gensym("freq"), A_GIMME, 0);
+    class_addmethod(resonbank2_class, (t_method)resonbank2_tilde_decay, gensym("decay"), A_GIMME, 0);
+    class_addmethod(resonbank2_class, (t_method)resonbank2_tilde_attack, gensym("attack"), A_GIMME, 0);
+    class_addmethod(resonbank2_class, (t_method)resonbank2_tilde_amp, gensym("amp"), A_GIMME, 0);
+    class_addmethod(resonbank2_class, (t_method)resonbank2_tilde_ramp, gensym("ramp"), A_GIMME, 0);
+    class_addmethod(resonbank2_class, (t_method)resonbank2_tilde_rampall, gensym("rampall"), A_FLOAT, 0);
+    class_addmethod(resonbank2_class, (t_method)resonbank2_tilde_clear, gensym("clear"), 0);
+}
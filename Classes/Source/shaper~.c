@@ -2,6 +2,7 @@
 
 #include "m_pd.h"
 #include "buffer.h"
+#include "oversample.h"
 #include <math.h>
 #include <stdlib.h>
 
@@ -24,6 +25,7 @@ typedef struct _shaper{
     double      x_xnm1;
     double      x_ynm1;
     t_buffer   *x_buffer;
+    t_oversample x_os;
 }t_shaper;
 
 static double lin_interp(t_word *buf, double i){ // linear interpolation
@@ -97,6 +99,29 @@ static void shaper_list(t_shaper *x, t_symbol *s, short ac, t_atom *av){
     x->x_arrayset = 0;
 }
 
+static void shaper_oversample(t_shaper *x, t_floatarg f){
+    if(!oversample_factor(&x->x_os, (int)f))
+        pd_error(x, "[shaper~]: oversampling is 1, 2, 4 or 8");
+}
+
+// the transfer function, this is what runs oversampled
+static void shaper_run(t_shaper *x, int n, t_float *in, t_float *out){
+    t_word *buf = (t_word *)x->x_buffer->c_vectors[0];
+    double maxidx = (double)(x->x_buffer->c_npts - 1);
+    int array = x->x_arrayset && x->x_buffer->c_playable;
+    for(int j = 0; j < n; j++){
+        double ph = ((double)in[j] + 1) * 0.5; // get phase (0-1)
+        while(ph < 0) // wrap
+            ph++;
+        while(ph >= 1)
+            ph--;
+        if(array)
+            out[j] = lin_interp(buf, ph * maxidx);
+        else
+            out[j] = x->x_cheby[(int)(ph * (double)(FLEN - 1))];
+    }
+}
+
 static t_int *shaper_perform(t_int *w){
     t_shaper *x = (t_shaper *) (w[1]);
     t_float *in = (t_float *)(w[2]);
@@ -105,30 +130,22 @@ static t_int *shaper_perform(t_int *w){
     double ynm1 = x->x_ynm1;
     double a = x->x_a;
     int n = (int)(w[4]);
-    t_word *buf = (t_word *)x->x_buffer->c_vectors[0];
-    double maxidx = (double)(x->x_buffer->c_npts - 1);
+    t_oversample *os = &x->x_os;
+    if(os->o_factor == 1)
+        shaper_run(x, n, in, out);
+    else{
+        t_float *buf = oversample_up(os, in);
+        shaper_run(x, n << os->o_shift, buf, buf);
+        oversample_down(os, out);
+    }
     while(n--){
         double yn, xn;
-        float output = 0;
-        double ph = ((double)*in++ + 1) * 0.5; // get phase (0-1)
-        while(ph < 0) // wrap
-            ph++;
-        while(ph >= 1)
-            ph--;
-        if(x->x_arrayset && x->x_buffer->c_playable){
-            double i = ph * maxidx;
-            output = lin_interp(buf, i);
-        }
-        else{
-            int i = (int)(ph * (double)(FLEN - 1));
-            output = x->x_cheby[i];
-        }
-        xn = yn = (double)output;
+        xn = yn = (double)*out;
         if(x->x_dc_filter){
             yn = xn - xnm1 + (a * ynm1);
-            output = (float)yn;
+            *out = (float)yn;
         }
-        *out++ = output;
+        out++;
         xnm1 = xn;
         ynm1 = yn;
     }
@@ -143,11 +160,13 @@ static void shaper_dsp(t_shaper *x, t_signal **sp){
         x->x_a = 1 - (5*TWO_PI/(double)x->x_sr);
     }
     buffer_checkdsp(x->x_buffer);
+    oversample_dsp(&x->x_os, sp[0]->s_n);
     dsp_add(shaper_perform, 4, x, sp[0]->s_vec, sp[1]->s_vec, sp[0]->s_n);
 }
 
 static void shaper_free(t_shaper *x){
     buffer_free(x->x_buffer);
+    oversample_free(&x->x_os);
     free(x->x_cheby);
     free(x->x_coef);
 }
@@ -165,6 +184,7 @@ static void *shaper_new(t_symbol *s, int ac, t_atom *av){
     x->x_dc_filter = 1;
     x->x_arrayset = 0;
     x->x_a = 1 - (5*TWO_PI/(double)sys_getsr());
+    oversample_init(&x->x_os, 1);
     int argn = 0;
     if(ac){
         x->x_count = 1;
@@ -194,6 +214,14 @@ static void *shaper_new(t_symbol *s, int ac, t_atom *av){
                     else
                         goto errstate;
                 }
+                else if(curarg == gensym("-oversample")){
+                    if(ac >= 2 && (av+1)->a_type == A_FLOAT){
+                        shaper_oversample(x, atom_getfloatarg(1, ac, av));
+                        ac-=2, av+=2;
+                    }
+                    else
+                        goto errstate;
+                }
                 else if(curarg == gensym("-filter")){
                     if(ac >= 2 && (av+1)->a_type == A_FLOAT){
                         x->x_dc_filter = atom_getfloatarg(1, ac, av) != 0;
@@ -234,4 +262,5 @@ void shaper_tilde_setup(void){
     class_addmethod(shaper_class, (t_method)shaper_dc, gensym("dc"), A_DEFFLOAT, 0);
     class_addmethod(shaper_class, (t_method)shaper_filter, gensym("filter"), A_DEFFLOAT, 0);
     class_addmethod(shaper_class, (t_method)shaper_set, gensym("set"), A_SYMBOL, 0);
+    class_addmethod(shaper_class, (t_method)shaper_oversample, gensym("oversample"), A_FLOAT, 0);
 }
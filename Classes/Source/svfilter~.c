@@ -1,42 +1,95 @@
-/* Based on Chamberlin's prototype from "Musical Applications of
-   Microprocessors" (csound's svfilter).  Slightly distorted,
-   no upsampling. */
+/* State variable filter, originally based on Chamberlin's prototype from
+   "Musical Applications of Microprocessors" (csound's svfilter), now a zero
+   delay feedback filter (shared/svf.c) with the same controls. */
 
 /* CHECKED scalar case: input preserved (not coefs) after changing mode */
 /* CHECKME if creation args (or defaults) restored after signal disconnection */
 
-#include <math.h>
 #include "m_pd.h"
-
-#ifndef M_PI
-    #define M_PI 3.14159265358979323846
-#endif
+#include "svf.h"
+#include "bank.h"
 
 #define SVFILTER_DRIVE     .0001
 #define SVFILTER_QSTRETCH  1.2   /* CHECKED */
 #define SVFILTER_MINR      0.    /* CHECKME */
 #define SVFILTER_MAXR      1.2   /* CHECKME */
-#define SVFILTER_MINOMEGA  0.    /* CHECKME */
-#define SVFILTER_MAXOMEGA  (M_PI * .5)  /* CHECKME */
-#define TWO_PI             (M_PI * 2.)
 #define SVFILTER_DEFFREQ   0.
 #define SVFILTER_DEFQ      .01  /* CHECKME */
 
+typedef enum _svfilter_mode{
+    SVFILTER_LOWPASS,
+    SVFILTER_HIGHPASS,
+    SVFILTER_BANDPASS,
+    SVFILTER_NOTCH
+}t_svfilter_mode;
+
 typedef struct _svfilter{
     t_object x_obj;
-    t_inlet *svfilter;
     t_inlet  *x_freq_inlet;
     t_inlet  *x_q_inlet;
-    int    x_mode;
-    float  x_srcoef;
-    float  x_band;
-    float  x_low;
+    int       x_bank;     // number of filters in bank mode, 0 for a single filter
+    t_svfilter_mode x_mode; // the output of each filter in bank mode
+    t_svf     x_svf;
+    t_float  *x_freq;     // frequency and q of each filter (the last block's in single mode)
+    t_float  *x_q;
+    t_float **x_outs;
+    double   *x_lp, *x_bp, *x_hp; // the outputs of all filters, interleaved
+    int       x_nblock;
 }t_svfilter;
 
 static t_class *svfilter_class;
 
+// damping (1/q) from the 0-1 resonance of the old Chamberlin filter
+static double svfilter_damping(t_float q){
+    double r = (1. - q) * SVFILTER_QSTRETCH;  /* CHECKED */
+    if(r < SVFILTER_MINR)
+        r = SVFILTER_MINR;
+    else if(r > SVFILTER_MAXR)
+        r = SVFILTER_MAXR;
+    return(r * r);
+}
+
 static void svfilter_clear(t_svfilter *x){
-    x->x_band = x->x_low = 0.;
+    svf_clear(&x->x_svf);
+}
+
+static void svfilter_update(t_svfilter *x, int jump){
+    for(int j = 0; j < x->x_svf.s_n; j++)
+        svf_set(&x->x_svf, j, x->x_freq[j], svfilter_damping(x->x_q[j]), jump);
+}
+
+static void svfilter_freq(t_svfilter *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    if(!x->x_bank){
+        pd_error(x, "[svfilter~]: 'freq' needs bank mode, use the inlet");
+        return;
+    }
+    bank_getlist(x, ac, av, x->x_freq, x->x_bank);
+    svfilter_update(x, 0);
+}
+
+static void svfilter_q(t_svfilter *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    if(!x->x_bank){
+        pd_error(x, "[svfilter~]: 'q' needs bank mode, use the inlet");
+        return;
+    }
+    bank_getlist(x, ac, av, x->x_q, x->x_bank);
+    svfilter_update(x, 0);
+}
+
+static int svfilter_getmode(t_svfilter *x, t_symbol *s){
+    const char *names[] = {"lowpass", "highpass", "bandpass", "notch"};
+    for(int i = 0; i < 4; i++) if(s == gensym(names[i])){
+        x->x_mode = (t_svfilter_mode)i;
+        return(1);
+    }
+    pd_error(x, "[svfilter~]: unknown mode '%s'", s->s_name);
+    return(0);
+}
+
+static void svfilter_mode(t_svfilter *x, t_symbol *s){
+    svfilter_getmode(x, s);
 }
 
 static t_int *svfilter_perform(t_int *w){
@@ -49,55 +102,132 @@ static t_int *svfilter_perform(t_int *w){
     t_float *hout = (t_float *)(w[7]);
     t_float *bout = (t_float *)(w[8]);
     t_float *nout = (t_float *)(w[9]);
-    float band = x->x_band;
-    float low = x->x_low;
-    while(n--){
-        float c1, c2;
-        float r = (1. - rin0) * SVFILTER_QSTRETCH;  /* CHECKED */
-        if (r < SVFILTER_MINR)
-            r = SVFILTER_MINR;
-        else if (r > SVFILTER_MAXR)
-            r = SVFILTER_MAXR;
-        c2 = r * r;
-        
-        float omega = fin0 * x->x_srcoef;
-        if (omega < SVFILTER_MINOMEGA)
-            omega = SVFILTER_MINOMEGA;
-        else if (omega > SVFILTER_MAXOMEGA)
-            omega = SVFILTER_MAXOMEGA;
-        c1 = sinf(omega);
-        
-        float high, xn = *xin++;
-        *lout++ = low = low + c1 * band;
-        *hout++ = high = xn - low - c2 * band;
-        *bout++ = band = c1 * high + band;
-        *nout++ = low + high;
-        band -= band * band * band * SVFILTER_DRIVE;
+    double *lp = x->x_lp, *bp = x->x_bp, *hp = x->x_hp;
+    // frequency and q are taken once per block and glide over it
+    x->x_freq[0] = fin0, x->x_q[0] = rin0;
+    svf_set(&x->x_svf, 0, fin0, svfilter_damping(rin0), 0);
+    svf_perform(&x->x_svf, n, xin, lp, bp, hp);
+    for(int i = 0; i < n; i++){
+        lout[i] = lp[i];
+        hout[i] = hp[i];
+        bout[i] = bp[i];
+        nout[i] = lp[i] + hp[i];
     }
-    x->x_band = (PD_BIGORSMALL(band) ? 0. : band);
-    x->x_low = (PD_BIGORSMALL(low) ? 0. : low);
     return(w + 10);
 }
 
+// all filters of the bank on the same input, each outlet is one filter
+static t_int *svfilter_bank_perform(t_int *w){
+    t_svfilter *x = (t_svfilter *)(w[1]);
+    int n = (int)(w[2]);
+    t_float *xin = (t_float *)(w[3]);
+    int nf = x->x_bank;
+    double *lp = x->x_lp, *bp = x->x_bp, *hp = x->x_hp;
+    svf_perform(&x->x_svf, n, xin, lp, bp, hp);
+    for(int j = 0; j < nf; j++){
+        t_float *out = x->x_outs[j];
+        switch(x->x_mode){
+            case SVFILTER_LOWPASS:
+                for(int i = 0; i < n; i++)
+                    out[i] = lp[i*nf + j];
+                break;
+            case SVFILTER_HIGHPASS:
+                for(int i = 0; i < n; i++)
+                    out[i] = hp[i*nf + j];
+                break;
+            case SVFILTER_BANDPASS:
+                for(int i = 0; i < n; i++)
+                    out[i] = bp[i*nf + j];
+                break;
+            default:
+                for(int i = 0; i < n; i++)
+                    out[i] = lp[i*nf + j] + hp[i*nf + j];
+        }
+    }
+    return(w + 4);
+}
+
 static void svfilter_dsp(t_svfilter *x, t_signal **sp){
-    x->x_srcoef = TWO_PI / sp[0]->s_sr;
+    int n = sp[0]->s_n, nf = x->x_svf.s_n;
+    if(n != x->x_nblock){
+        int old = 3 * x->x_nblock * nf;
+        x->x_lp = (double *)resizebytes(x->x_lp, old * sizeof(double), 3 * n * nf * sizeof(double));
+        x->x_bp = x->x_lp + n * nf;
+        x->x_hp = x->x_bp + n * nf;
+        x->x_nblock = n;
+    }
+    if(sp[0]->s_sr != x->x_svf.s_sr){
+        x->x_svf.s_sr = sp[0]->s_sr;
+        svfilter_update(x, 1);
+    }
     svfilter_clear(x);
-    dsp_add(svfilter_perform, 9, x, sp[0]->s_n,
-	    sp[0]->s_vec, sp[1]->s_vec, sp[2]->s_vec, sp[3]->s_vec,
-	    sp[4]->s_vec, sp[5]->s_vec, sp[6]->s_vec);
+    if(x->x_bank){
+        for(int j = 0; j < nf; j++)
+            x->x_outs[j] = sp[1 + j]->s_vec;
+        dsp_add(svfilter_bank_perform, 3, x, n, sp[0]->s_vec);
+    }
+    else
+        dsp_add(svfilter_perform, 9, x, n,
+            sp[0]->s_vec, sp[1]->s_vec, sp[2]->s_vec, sp[3]->s_vec,
+            sp[4]->s_vec, sp[5]->s_vec, sp[6]->s_vec);
+}
+
+static void svfilter_free(t_svfilter *x){
+    freebytes(x->x_lp, 3 * x->x_nblock * x->x_svf.s_n * sizeof(double));
+    freebytes(x->x_freq, x->x_svf.s_n * sizeof(t_float));
+    freebytes(x->x_q, x->x_svf.s_n * sizeof(t_float));
+    if(x->x_bank)
+        freebytes(x->x_outs, x->x_bank * sizeof(t_float *));
+    svf_free(&x->x_svf);
 }
 
 static void *svfilter_new(t_symbol *s, int ac, t_atom *av){
     s = NULL;
     t_svfilter *x = (t_svfilter *)pd_new(svfilter_class);
     t_float freq = SVFILTER_DEFFREQ, qcoef = SVFILTER_DEFQ;
+    x->x_mode = SVFILTER_BANDPASS;
+    while(ac && av->a_type == A_SYMBOL){
+        t_symbol *flag = atom_getsymbol(av);
+        if(flag == gensym("-bank") && ac >= 2){
+            int nf = (int)atom_getfloat(av + 1);
+            x->x_bank = nf < 1 ? 1 : nf;
+            ac -= 2, av += 2;
+        }
+        else if(flag == gensym("-mode") && ac >= 2){
+            svfilter_getmode(x, atom_getsymbol(av + 1));
+            ac -= 2, av += 2;
+        }
+        else{
+            pd_error(x, "[svfilter~]: improper args");
+            return(NULL);
+        }
+    }
     if(ac && av->a_type == A_FLOAT){
         freq = av->a_w.w_float;
         ac--; av++;
         if(ac && av->a_type == A_FLOAT)
             qcoef = av->a_w.w_float;
     }
-    x->x_srcoef = M_PI / sys_getsr();
+    x->x_svf.s_drive = SVFILTER_DRIVE;
+    if(x->x_bank){
+        int nf = x->x_bank;
+        svf_init(&x->x_svf, nf, sys_getsr());
+        x->x_freq = (t_float *)getbytes(nf * sizeof(t_float));
+        x->x_q = (t_float *)getbytes(nf * sizeof(t_float));
+        x->x_outs = (t_float **)getbytes(nf * sizeof(t_float *));
+        for(int j = 0; j < nf; j++){
+            x->x_freq[j] = freq;
+            x->x_q[j] = qcoef;
+            outlet_new((t_object *)x, &s_signal);
+        }
+        svfilter_update(x, 1);
+        return(x);
+    }
+    svf_init(&x->x_svf, 1, sys_getsr());
+    x->x_freq = (t_float *)getbytes(sizeof(t_float));
+    x->x_q = (t_float *)getbytes(sizeof(t_float));
+    x->x_freq[0] = freq, x->x_q[0] = qcoef;
+    svfilter_update(x, 1);
     x->x_freq_inlet = inlet_new((t_object *)x, (t_pd *)x, &s_signal, &s_signal);
     pd_float((t_pd *)x->x_freq_inlet, freq);
     x->x_q_inlet = inlet_new((t_object *)x, (t_pd *)x, &s_signal, &s_signal);
@@ -106,14 +236,16 @@ static void *svfilter_new(t_symbol *s, int ac, t_atom *av){
     outlet_new((t_object *)x, &s_signal);
     outlet_new((t_object *)x, &s_signal);
     outlet_new((t_object *)x, &s_signal);
-    svfilter_clear(x);
     return (x);
 }
 
 void svfilter_tilde_setup(void){
-    svfilter_class = class_new(gensym("svfilter~"),
-        (t_newmethod)svfilter_new, 0, sizeof(t_svfilter), 0, A_GIMME, 0);
+    svfilter_class = class_new(gensym("svfilter~"), (t_newmethod)svfilter_new,
+        (t_method)svfilter_free, sizeof(t_svfilter), 0, A_GIMME, 0);
     class_addmethod(svfilter_class, nullfn, gensym("signal"), 0);
     class_addmethod(svfilter_class, (t_method)svfilter_dsp, gensym("dsp"), A_CANT, 0);
     class_addmethod(svfilter_class, (t_method)svfilter_clear, gensym("clear"), 0);
+    class_addmethod(svfilter_class, (t_method)svfilter_freq, gensym("freq"), A_GIMME, 0);
+    class_addmethod(svfilter_class, (t_method)svfilter_q, gensym("q"), A_GIMME, 0);
+    class_addmethod(svfilter_class, (t_method)svfilter_mode, gensym("mode"), A_SYMBOL, 0);
 }
@@ -0,0 +1,215 @@
+// Porres 2018, compiled version of the old abstraction
+
+#include "m_pd.h"
+#include <math.h>
+
+#define PI 3.14159265358979323846
+#define VOCODER_GATE 0.001  // noise gate threshold (-60 dB)
+#define VOCODER_NORM 0.5    // output rms (-6 dB)
+
+static t_class *vocoder_class;
+
+typedef struct _vocoder{
+    t_object    x_obj;
+    t_float     x_f;
+    t_inlet    *x_inlet_mod;
+    t_inlet    *x_inlet_q;
+    t_float     x_sr;
+    t_float     x_q;
+    int         x_n;        // number of bands
+    int         x_size;     // allocated bands, retuning never allocates
+    t_float    *x_pitch;    // center frequency of each band in MIDI
+    t_float     x_lo;       // range of the bands, the top one is a step below 'x_hi'
+    t_float     x_hi;
+    // all bands are bandpass biquads that share the coefficients for the
+    // analysis (modulator) and synthesis (carrier) filters, kept in arrays
+    // so each sample is one vectorized loop over the analysis bands and
+    // another over the synthesis bands
+    double     *x_a0, *x_b1, *x_b2;
+    double     *x_ya1, *x_ya2;  // analysis state
+    double     *x_ys1, *x_ys2;  // synthesis state
+    double     *x_env;          // mean square of each analysis band
+    double      x_m1, x_m2, x_c1, x_c2;
+    double      x_gate_m, x_gate_c, x_gain_m, x_gain_c; // noise gates
+    double      x_norm;         // mean square of the output
+}t_vocoder;
+
+static void vocoder_coeffs(t_vocoder *x){
+    double nyq = x->x_sr * 0.5, q = x->x_q < 0.000001 ? 0.000001 : x->x_q;
+    for(int k = 0; k < x->x_n; k++){
+        double f = 8.17579891564 * exp(.0577622650 * x->x_pitch[k]); // mtof
+        if(f > nyq - 0.000001)
+            f = nyq - 0.000001;
+        double omega = f * PI / nyq;
+        double alphaQ = sin(omega) / (2*q);
+        double b0 = alphaQ + 1;
+        x->x_a0[k] = alphaQ / b0;
+        x->x_b1[k] = 2*cos(omega) / b0;
+        x->x_b2[k] = (alphaQ - 1) / b0;
+    }
+}
+
+static void vocoder_clear(t_vocoder *x);
+
+// only allocates when there are more bands than ever before
+static void vocoder_resize(t_vocoder *x, int n){
+    int moved = n > x->x_size;
+    if(moved){
+        int old = x->x_size;
+        x->x_pitch = (t_float *)resizebytes(x->x_pitch, old * sizeof(t_float), n * sizeof(t_float));
+        x->x_a0 = (double *)resizebytes(x->x_a0, 8 * old * sizeof(double), 8 * n * sizeof(double));
+        x->x_size = n;
+    }
+    int size = x->x_size;
+    x->x_b1 = x->x_a0 + size;
+    x->x_b2 = x->x_b1 + size;
+    x->x_ya1 = x->x_b2 + size;
+    x->x_ya2 = x->x_ya1 + size;
+    x->x_ys1 = x->x_ya2 + size;
+    x->x_ys2 = x->x_ys1 + size;
+    x->x_env = x->x_ys2 + size;
+    if(moved){ // the arrays moved, so start over
+        x->x_n = n;
+        vocoder_clear(x);
+    }
+    else for(int k = x->x_n; k < n; k++) // new bands start silent
+        x->x_ya1[k] = x->x_ya2[k] = x->x_ys1[k] = x->x_ys2[k] = x->x_env[k] = 0;
+    x->x_n = n;
+}
+
+// n bands evenly spaced between two pitches
+static void vocoder_spacing(t_vocoder *x, t_floatarg lo, t_floatarg hi){
+    x->x_lo = lo, x->x_hi = hi;
+    for(int k = 0; k < x->x_n; k++)
+        x->x_pitch[k] = lo + k * (hi - lo) / x->x_n;
+    vocoder_coeffs(x);
+}
+
+static void vocoder_bands(t_vocoder *x, t_floatarg f){
+    int n = f < 1 ? 1 : (int)f;
+    vocoder_resize(x, n);
+    vocoder_spacing(x, x->x_lo, x->x_hi);
+}
+
+static void vocoder_freq(t_vocoder *x, t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    for(int k = 0; k < ac && k < x->x_n; k++)
+        x->x_pitch[k] = atom_getfloat(av + k);
+    // the range spans the lowest to the highest band plus a mean step, so
+    // 'bands' spaces them evenly over it
+    t_float lo = x->x_pitch[0], hi = lo;
+    for(int k = 1; k < x->x_n; k++){
+        if(x->x_pitch[k] < lo)
+            lo = x->x_pitch[k];
+        if(x->x_pitch[k] > hi)
+            hi = x->x_pitch[k];
+    }
+    hi += x->x_n > 1 ? (hi - lo) / (x->x_n - 1) : x->x_hi - x->x_lo;
+    x->x_lo = lo, x->x_hi = hi;
+    vocoder_coeffs(x);
+}
+
+static void vocoder_q(t_vocoder *x, t_floatarg f){
+    x->x_q = f;
+    vocoder_coeffs(x);
+}
+
+static void vocoder_clear(t_vocoder *x){
+    for(int k = 0; k < x->x_n; k++)
+        x->x_ya1[k] = x->x_ya2[k] = x->x_ys1[k] = x->x_ys2[k] = x->x_env[k] = 0;
+    x->x_m1 = x->x_m2 = x->x_c1 = x->x_c2 = x->x_norm = 0;
+}
+
+static t_int *vocoder_perform(t_int *w){
+    t_vocoder *x = (t_vocoder *)(w[1]);
+    int nblock = (int)(w[2]);
+    t_float *car_in = (t_float *)(w[3]);
+    t_float *mod_in = (t_float *)(w[4]);
+    t_float *out = (t_float *)(w[5]);
+    int n = x->x_n;
+    double *a0 = x->x_a0, *b1 = x->x_b1, *b2 = x->x_b2;
+    double *ya1 = x->x_ya1, *ya2 = x->x_ya2, *ys1 = x->x_ys1, *ys2 = x->x_ys2;
+    double *env = x->x_env;
+    double m1 = x->x_m1, m2 = x->x_m2, c1 = x->x_c1, c2 = x->x_c2;
+    double gate_m = x->x_gate_m, gate_c = x->x_gate_c;
+    double gain_m = x->x_gain_m, gain_c = x->x_gain_c, norm = x->x_norm;
+    // one pole versions of the old moving rms windows (in samples) and gate glide
+    double env_coef = 1 - exp(-2./512), norm_coef = 1 - exp(-2./1024);
+    double attack_coef = 1 - exp(-2./64);
+    double gate_coef = 1 - exp(-2./256), glide_coef = 1 - exp(-1./(0.01 * x->x_sr));
+    for(int i = 0; i < nblock; i++){
+        double m = mod_in[i], c = car_in[i], sum = 0;
+        gate_m += gate_coef * (m*m - gate_m);
+        gate_c += gate_coef * (c*c - gate_c);
+        gain_m += glide_coef * ((gate_m >= VOCODER_GATE*VOCODER_GATE) - gain_m);
+        gain_c += glide_coef * ((gate_c >= VOCODER_GATE*VOCODER_GATE) - gain_c);
+        m *= gain_m, c *= gain_c;
+        for(int k = 0; k < n; k++){ // analysis
+            double y = a0[k] * (m - m2) + b1[k] * ya1[k] + b2[k] * ya2[k];
+            ya2[k] = ya1[k];
+            ya1[k] = y;
+            env[k] += env_coef * (y*y - env[k]);
+        }
+        for(int k = 0; k < n; k++){ // synthesis
+            double y = a0[k] * (c - c2) + b1[k] * ys1[k] + b2[k] * ys2[k];
+            ys2[k] = ys1[k];
+            ys1[k] = y;
+            sum += y * sqrt(env[k]);
+        }
+        m2 = m1, m1 = m, c2 = c1, c1 = c;
+        double sq = sum*sum; // rises faster so onsets don't blow up
+        norm += (sq > norm ? attack_coef : norm_coef) * (sq - norm);
+        out[i] = norm > 1e-20 ? sum * VOCODER_NORM / sqrt(norm) : 0;
+    }
+    x->x_m1 = m1, x->x_m2 = m2, x->x_c1 = c1, x->x_c2 = c2;
+    x->x_gate_m = gate_m, x->x_gate_c = gate_c;
+    x->x_gain_m = gain_m, x->x_gain_c = gain_c, x->x_norm = norm;
+    return(w+6);
+}
+
+static void vocoder_dsp(t_vocoder *x, t_signal **sp){
+    if(sp[0]->s_sr != x->x_sr){
+        x->x_sr = sp[0]->s_sr;
+        vocoder_coeffs(x);
+    }
+    dsp_add(vocoder_perform, 5, x, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec, sp[2]->s_vec);
+}
+
+static void vocoder_free(t_vocoder *x){
+    freebytes(x->x_pitch, x->x_size * sizeof(t_float));
+    freebytes(x->x_a0, 8 * x->x_size * sizeof(double));
+    inlet_free(x->x_inlet_mod);
+    inlet_free(x->x_inlet_q);
+}
+
+static void *vocoder_new(t_symbol *s, int ac, t_atom *av){
+    s = NULL;
+    t_vocoder *x = (t_vocoder *)pd_new(vocoder_class);
+    int n = 1;
+    x->x_q = 50;
+    if(ac && av->a_type == A_FLOAT)
+        n = atom_getfloat(av), ac--, av++;
+    if(ac && av->a_type == A_FLOAT)
+        x->x_q = atom_getfloat(av), ac--, av++;
+    x->x_sr = sys_getsr();
+    vocoder_resize(x, n < 1 ? 1 : n);
+    vocoder_spacing(x, 28, 108);
+    if(ac)
+        vocoder_freq(x, NULL, ac, av);
+    x->x_inlet_mod = inlet_new(&x->x_obj, &x->x_obj.ob_pd, &s_signal, &s_signal);
+    x->x_inlet_q = inlet_new(&x->x_obj, &x->x_obj.ob_pd, &s_float, gensym("q"));
+    outlet_new(&x->x_obj, &s_signal);
+    return(x);
+}
+
+void vocoder_tilde_setup(void){
+    vocoder_class = class_new(gensym("vocoder~"), (t_newmethod)vocoder_new,
+        (t_method)vocoder_free, sizeof(t_vocoder), 0, A_GIMME, 0);
+    CLASS_MAINSIGNALIN(vocoder_class, t_vocoder, x_f);
+    class_addmethod(vocoder_class, (t_method)vocoder_dsp, gensym("dsp"), A_CANT, 0);
+    class_addmethod(vocoder_class, (t_method)vocoder_freq, gensym("freq"), A_GIMME, 0);
+    class_addmethod(vocoder_class, (t_method)vocoder_q, gensym("q"), A_FLOAT, 0);
+    class_addmethod(vocoder_class, (t_method)vocoder_bands, gensym("bands"), A_FLOAT, 0);
+    class_addmethod(vocoder_class, (t_method)vocoder_spacing, gensym("spacing"), A_FLOAT, A_FLOAT, 0);
+    class_addmethod(vocoder_class, (t_method)vocoder_clear, gensym("clear"), 0);
+}
@@ -1,24 +1,46 @@
 // porres 2018-2019
 
 #include "m_pd.h"
+#include <stdint.h>
+#include <string.h>
 
 static t_class *voices_class;
 
+// Voices are linked in lists instead of being searched: the unused ones
+// in the free list, oldest first, and the used ones in the order they were
+// allocated, so the head is the one to steal. Used voices are also chained
+// by pitch in a hash table for note offs, and released voices wait in a
+// queue sorted by the time they're freed, which is served by one clock.
+
 typedef struct voice{
-    t_clock        *v_clock;
     t_float         v_pitch;
     int             v_used;
     int             v_released;
-    unsigned long   v_count;
+    double          v_end;      // logical time its release is over
+    struct voice   *v_prev;     // in the free or used list
+    struct voice   *v_next;
+    struct voice   *v_hnext;    // in the hash chain of its pitch
+    struct voice   *v_rprev;    // in the release queue
+    struct voice   *v_rnext;
 }t_voice;
 
+typedef struct voicelist{
+    t_voice        *l_head;
+    t_voice        *l_tail;
+}t_voicelist;
+
 typedef struct voices{
     t_object        x_obj;
     t_voice        *x_vec;
+    t_voice       **x_hash;     // used voices by pitch
     t_outlet      **x_outs;
     t_outlet       *x_extra;
-    t_clock        *x_clock; // clock to check voices
-    unsigned long   x_count;
+    t_clock        *x_clock;    // frees released voices
+    t_voicelist     x_free;
+    t_voicelist     x_used;
+    t_voicelist     x_releasing; // linked by 'v_rprev' and 'v_rnext'
+    int             x_nused;
+    int             x_hashbits;
     int             x_n;
     int             x_retrig;
     int             x_steal;
@@ -28,195 +50,231 @@ typedef struct voices{
     float           x_vel;
 }t_voices;
 
+static void voices_unlink(t_voicelist *l, t_voice *v){
+    if(v->v_prev)
+        v->v_prev->v_next = v->v_next;
+    else
+        l->l_head = v->v_next;
+    if(v->v_next)
+        v->v_next->v_prev = v->v_prev;
+    else
+        l->l_tail = v->v_prev;
+    v->v_prev = v->v_next = NULL;
+}
+
+static void voices_append(t_voicelist *l, t_voice *v){
+    v->v_next = NULL;
+    v->v_prev = l->l_tail;
+    if(l->l_tail)
+        l->l_tail->v_next = v;
+    else
+        l->l_head = v;
+    l->l_tail = v;
+}
+
+static t_voice **voices_bucket(t_voices *x, t_float pitch){
+    double d = pitch == 0 ? 0 : pitch; // -0 and 0 are the same pitch
+    uint64_t key;
+    memcpy(&key, &d, sizeof(key));
+    key *= 0x9E3779B97F4A7C15ULL;
+    return(&x->x_hash[key >> (64 - x->x_hashbits)]);
+}
+
+// chains keep the allocation order, so the oldest voice of a pitch is first
+static void voices_hashadd(t_voices *x, t_voice *v){
+    t_voice **vp = voices_bucket(x, v->v_pitch);
+    while(*vp)
+        vp = &(*vp)->v_hnext;
+    *vp = v;
+    v->v_hnext = NULL;
+}
+
+static void voices_hashremove(t_voices *x, t_voice *v){
+    t_voice **vp = voices_bucket(x, v->v_pitch);
+    while(*vp != v)
+        vp = &(*vp)->v_hnext;
+    *vp = v->v_hnext;
+    v->v_hnext = NULL;
+}
+
+// oldest used voice with this pitch, only unreleased ones if 'held'
+static t_voice *voices_find(t_voices *x, t_float pitch, int held){
+    for(t_voice *v = *voices_bucket(x, pitch); v; v = v->v_hnext)
+        if(v->v_pitch == pitch && !(held && v->v_released))
+            return(v);
+    return(NULL);
+}
+
+// the queue is sorted by end time, and with a fixed release time a new
+// voice always goes at the end
+static void voices_queue(t_voices *x, t_voice *v){
+    t_voicelist *l = &x->x_releasing;
+    t_voice *prev = l->l_tail;
+    while(prev && prev->v_end > v->v_end)
+        prev = prev->v_rprev;
+    v->v_rprev = prev;
+    v->v_rnext = prev ? prev->v_rnext : l->l_head;
+    if(v->v_rnext)
+        v->v_rnext->v_rprev = v;
+    else
+        l->l_tail = v;
+    if(prev)
+        prev->v_rnext = v;
+    else{
+        l->l_head = v;
+        clock_set(x->x_clock, v->v_end);
+    }
+}
+
+static void voices_dequeue(t_voices *x, t_voice *v){
+    t_voicelist *l = &x->x_releasing;
+    if(v->v_rprev)
+        v->v_rprev->v_rnext = v->v_rnext;
+    else
+        l->l_head = v->v_rnext;
+    if(v->v_rnext)
+        v->v_rnext->v_rprev = v->v_rprev;
+    else
+        l->l_tail = v->v_rprev;
+    v->v_rprev = v->v_rnext = NULL;
+    v->v_released = 0;
+}
+
+// all voices unused, in order
+static void voices_reset(t_voices *x){
+    x->x_free.l_head = x->x_free.l_tail = NULL;
+    x->x_used.l_head = x->x_used.l_tail = NULL;
+    x->x_releasing.l_head = x->x_releasing.l_tail = NULL;
+    for(int i = 0; i < x->x_n; i++){
+        t_voice *v = &x->x_vec[i];
+        v->v_pitch = v->v_used = v->v_released = 0;
+        v->v_hnext = v->v_rprev = v->v_rnext = NULL;
+        voices_append(&x->x_free, v);
+    }
+    for(int i = 0; i < (1 << x->x_hashbits); i++)
+        x->x_hash[i] = NULL;
+    x->x_nused = 0;
+    clock_unset(x->x_clock);
+}
+
+static void voices_alloc(t_voices *x, int n){
+    int bits = 1;
+    while((1 << bits) < 2 * n)
+        bits++;
+    x->x_vec = (t_voice *)getbytes(n * sizeof(*x->x_vec));
+    x->x_hash = (t_voice **)getbytes((1 << bits) * sizeof(*x->x_hash));
+    x->x_n = n;
+    x->x_hashbits = bits;
+    voices_reset(x);
+}
+
+static void voices_freevoice(t_voices *x, t_voice *v){
+    if(v->v_released)
+        voices_dequeue(x, v);
+    voices_hashremove(x, v);
+    voices_unlink(&x->x_used, v);
+    v->v_used = v->v_pitch = 0;
+    voices_append(&x->x_free, v);
+    if(!--x->x_nused) // all are unused, start again from the first one
+        voices_reset(x);
+}
+
 static void voices_tick(t_voices *x){
-    if(x->x_count != 0){ // check if voices are unused, if so: reset counter
-        int used = 0;
-        int i;
-        t_voice *v;
-        for(v = x->x_vec, i = 0; i < x->x_n; v++, i++){ // search used voices
-            if(v->v_used){
-                used = 1;
-                break;
-            }
-        }
-        if(!used){ // all are unused, reset counter
-            for(v = x->x_vec, i = x->x_n; i--; v++)
-                v->v_count = 0;
-            x->x_count = 0;
-        }
+    double now = clock_getlogicaltime();
+    t_voice *v;
+    while((v = x->x_releasing.l_head) && v->v_end <= now)
+        voices_freevoice(x, v);
+    if(v)
+        clock_set(x->x_clock, v->v_end);
+}
+
+static void voices_out(t_voices *x, t_voice *v, t_float pitch, t_float vel){
+    int i = (int)(v - x->x_vec);
+    if(x->x_list_mode){
+        t_atom at[3];
+        SETFLOAT(at, i + x->x_offset);                      // voice number
+        SETFLOAT(at+1, pitch);                              // pitch
+        SETFLOAT(at+2, vel);                                // velocity
+        outlet_list(x->x_obj.ob_outlet, &s_list, 3, at);
     }
+    else{
+        t_atom at[2];
+        SETFLOAT(at, pitch);                                // pitch
+        SETFLOAT(at+1, vel);                                // velocity
+        outlet_list(x->x_outs[i], &s_list, 2, at);
+    }
+}
+
+static void voices_extra(t_voices *x, t_float pitch, t_float vel){
+    t_atom at[2];
+    SETFLOAT(at, pitch);                                    // pitch
+    SETFLOAT(at+1, vel);                                    // velocity
+    outlet_list(x->x_extra, &s_list, 2, at);
 }
 
-static void voice_tick(t_voice *v_n){ //    post("free voice");
-    v_n->v_used = v_n->v_released = v_n->v_pitch = 0.;
+// send note off and free the voice now or after the release time
+static void voices_noteoff(t_voices *x, t_voice *v){
+    t_float pitch = v->v_pitch;
+    if(x->x_release > 0){
+        v->v_released = 1;
+        v->v_end = clock_getsystimeafter(x->x_release);
+        voices_queue(x, v);
+    }
+    else
+        voices_freevoice(x, v);
+    voices_out(x, v, pitch, 0);
 }
 
 static void voices_noteon(t_voices *x, t_float f){
-    t_voice *v, *first_used = 0, *first_unused = 0;
-    unsigned int used_idx = 0, unused_idx = 0;
-    int i;
-    unsigned int count_used = 0xffffffff, count_unused = 0xffffffff;
-// find first_used (on) / first_unused (off)
-    for(v = x->x_vec, i = 0; i < x->x_n; v++, i++){
-        if(v->v_used && v->v_count < count_used) // find first used (on) voice
-            first_used = v, count_used = (unsigned int)v->v_count, used_idx = i;
-        else if(!v->v_used && v->v_count < count_unused) // find first unused (off) voice
-            first_unused = v, count_unused = (unsigned int)v->v_count, unused_idx = i;
+    t_voice *v;
+    if((v = x->x_free.l_head)){ // if there's an unused voice, use it
+        voices_unlink(&x->x_free, v);
+        voices_append(&x->x_used, v);
+        v->v_used = 1;
+        v->v_pitch = f;
+        voices_hashadd(x, v);
+        x->x_nused++;
+        voices_out(x, v, f, x->x_vel);
     }
-    if(first_unused){ // if there's an unused voice, use it
-        first_unused->v_used = 1; // mark as used
-        first_unused->v_pitch = f; // set pitch
-        first_unused->v_count = x->x_count++; // increase counter
-        if(x->x_list_mode){
-            t_atom at[3];
-            SETFLOAT(at, unused_idx + x->x_offset);             // voice number
-            SETFLOAT(at+1, first_unused->v_pitch);              // pitch
-            SETFLOAT(at+2, x->x_vel);                           // Note-On velocity
-            outlet_list(x->x_obj.ob_outlet, &s_list, 3, at);
-        }
-        else{
-            t_atom at[2];
-            SETFLOAT(at, first_unused->v_pitch);                // pitch
-            SETFLOAT(at+1, x->x_vel);                           // Note-On velocity
-            outlet_list(x->x_outs[unused_idx], &s_list, 2, at);
-        }
-    }
-    else{ // there's no unused voice / all voices are being used
-        if(x->x_steal){ // if "steal", steal first used voice
-            // "free" first used (send note off)
-            // at1 / at2 ?
-            if(x->x_list_mode){
-                 t_atom at1[3];
-                 SETFLOAT(at1, used_idx + x->x_offset);           // voice number
-                 SETFLOAT(at1+1, first_used->v_pitch);            // pitch
-                 SETFLOAT(at1+2, 0);                              // Note-Off
-                 outlet_list(x->x_obj.ob_outlet, &s_list, 3, at1);
-                 // note on
-                 t_atom at2[3];
-                 SETFLOAT(at2, used_idx + x->x_offset);           // voice number
-                 SETFLOAT(at2+1, f);                              // pitch
-                 SETFLOAT(at2+2, x->x_vel);                       // Note-On velocity
-                 outlet_list(x->x_obj.ob_outlet, &s_list, 3, at2);
-            }
-            else{
-                t_atom at1[2];
-                SETFLOAT(at1, first_used->v_pitch);               // pitch
-                SETFLOAT(at1+1, 0);                               // Note-Off
-                outlet_list(x->x_outs[used_idx], &s_list, 2, at1);
-                // note on
-                t_atom at2[2];
-                SETFLOAT(at2, f);                                 // pitch
-                SETFLOAT(at2+1, x->x_vel);                        // Note-On velocity
-                outlet_list(x->x_outs[used_idx], &s_list, 2, at2);
-                
-            }
-            first_used->v_pitch = f; // set new pitch
-            first_used->v_count = x->x_count++; // increase counter
-        }
-        else{ // don't steal, output in extra outlet
-            t_atom at[2];
-            SETFLOAT(at, f);                                      // pitch
-            SETFLOAT(at+1, x->x_vel);                             // Note-On velocity
-            outlet_list(x->x_extra, &s_list, 2, at);
-        }
+    else if(x->x_steal){ // steal the oldest voice, even if it's releasing
+        v = x->x_used.l_head;
+        t_float old = v->v_pitch;
+        if(v->v_released)
+            voices_dequeue(x, v);
+        voices_hashremove(x, v);
+        voices_unlink(&x->x_used, v);
+        voices_append(&x->x_used, v);
+        v->v_pitch = f;
+        voices_hashadd(x, v);
+        voices_out(x, v, old, 0);
+        voices_out(x, v, f, x->x_vel);
     }
+    else // don't steal, output in extra outlet
+        voices_extra(x, f, x->x_vel);
 }
 
 static void voices_float(t_voices *x, t_float f){
-    int i;
     t_voice *v;
     if(x->x_vel > 0){ // Note-on
-        if(x->x_retrig == 2){ // retrigger mode 2: different output
+        if(x->x_retrig == 2) // retrigger mode 2: different output
             voices_noteon(x, f); // add new note, nothing different
-        }
-        else{ // retrigger mode 0 & 1
-            t_voice *prev = 0;
-            unsigned int prev_idx = 0;
-            for(v = x->x_vec, i = 0; i < x->x_n; v++, i++){
-                if(v->v_used && v->v_pitch == f){ // find previous pitch
-                    prev = v, prev_idx = i;
-                    break;
-                }
+        else if((v = voices_find(x, f, 0))){ // note already in voice allocation
+            if(x->x_retrig == 1){ // retrigger, on a releasing voice it's held again
+                if(v->v_released)
+                    voices_dequeue(x, v);
+                voices_out(x, v, f, x->x_vel);
             }
-            if(prev){ // note already in voice allocation
-                if(x->x_retrig == 1){ // retrigger
-                    if(x->x_list_mode){
-                        t_atom at[3];
-                        SETFLOAT(at, prev_idx + x->x_offset);       // voice number
-                        SETFLOAT(at+1, f);                          // pitch
-                        SETFLOAT(at+2, x->x_vel);                   // Note-On velocity
-                        outlet_list(x->x_obj.ob_outlet, &s_list, 3, at);
-                    }
-                    else{
-                        t_atom at[2];
-                        SETFLOAT(at, f);                           // pitch
-                        SETFLOAT(at+1, x->x_vel);                  // Note-On velocity
-                        outlet_list(x->x_outs[prev_idx], &s_list, 2, at);
-                    }
-                }
-                else if(x->x_retrig == 0){ // extra
-                    t_atom at[2];
-                    SETFLOAT(at, f);                                  // pitch
-                    SETFLOAT(at+1, x->x_vel);                         // Note-On
-                    outlet_list(x->x_extra, &s_list, 2, at);
-                }
-            }
-            else // new note (not in voice allocation)
-                voices_noteon(x, f);
+            else // extra
+                voices_extra(x, f, x->x_vel);
         }
+        else // new note (not in voice allocation)
+            voices_noteon(x, f);
     }
     else{ // Note off (x->x_vel = 0)
-        t_voice *used_pitch = 0;
-        unsigned int used_idx = 0, count = 0xffffffff;
-        for(v = x->x_vec, i = 0; i < x->x_n; v++, i++){ // search pitch in oldest entry
-            if(v->v_used && !v->v_released && v->v_pitch == f && v->v_count < count)
-                used_pitch = v, count = (unsigned int)v->v_count, used_idx = i;
-        }
-        if(used_pitch){ // pitch was found in a used and unreleased voice
-            // send note-off
-            if(x->x_list_mode){
-                t_atom at[3];
-                SETFLOAT(at, used_idx + x->x_offset);             // voice number
-                SETFLOAT(at+1, used_pitch->v_pitch);              // pitch
-                SETFLOAT(at+2, 0);                                // Note-Off
-                outlet_list(x->x_obj.ob_outlet, &s_list, 3, at);
-            }
-            else{
-                t_atom at[2];
-                SETFLOAT(at, used_pitch->v_pitch);                // pitch
-                SETFLOAT(at+1, 0);                                // Note-Off
-                outlet_list(x->x_outs[used_idx], &s_list, 2, at);
-            }
-            // free voice
-            if(x->x_release > 0){
-                clock_delay(used_pitch->v_clock, x->x_release);
-                clock_delay(x->x_clock, x->x_release);
-                used_pitch->v_released = 1;
-            }
-            else{
-                used_pitch->v_used = used_pitch->v_pitch = 0;
-                if(x->x_count != 0){ // check if all are unused, if so: reset counter
-                    int used = 0;
-                    for(v = x->x_vec, i = 0; i < x->x_n; v++, i++){ // search used voices
-                        if(v->v_used){
-                            used = 1;
-                            break;
-                        }
-                    }
-                    if(!used){ // all are unused, reset counter
-                        for(v = x->x_vec, i = x->x_n; i--; v++)
-                            v->v_count = 0;
-                        x->x_count = 0;
-                    }
-                }
-            }
-        }
-        else{ // pitch not found, send note-off in extra outlet
-            t_atom at[2];
-            SETFLOAT(at, f);                                  // pitch
-            SETFLOAT(at+1, 0);                                // Note-Off
-            outlet_list(x->x_extra, &s_list, 2, at);
-        }
+        if((v = voices_find(x, f, 1))) // oldest used and unreleased voice
+            voices_noteoff(x, v);
+        else // pitch not found, send note-off in extra outlet
+            voices_extra(x, f, 0);
     }
 }
 
@@ -246,73 +304,39 @@ static void voices_retrig(t_voices *x, t_float f){
 }
 
 static void voices_flush(t_voices *x){
-    t_voice *v;
-    int i;
-    for(i = 0, v = x->x_vec; i < x->x_n; i++, v++){
-        if(v->v_used){
-            if(x->x_list_mode){
-                 t_atom at[3];
-                 SETFLOAT(at, i + x->x_offset);                  // voice number
-                 SETFLOAT(at+1, v->v_pitch);                     // pitch
-                 SETFLOAT(at+2, 0);                              // Note-Off
-                 outlet_list(x->x_obj.ob_outlet, &s_list, 3, at);
-            }
-            else{
-                t_atom at[2];
-                SETFLOAT(at, v->v_pitch);                       // pitch
-                SETFLOAT(at+1, 0);                              // Note-Off
-                outlet_list(x->x_outs[i], &s_list, 2, at);
-            }
-            if(x->x_release > 0){
-                clock_delay(v->v_clock, x->x_release);
-                clock_delay(x->x_clock, x->x_release);
-                v->v_released = 1;
-            }
-            else
-                v->v_used = v->v_count = v->v_pitch = 0;
-        }
+    for(int i = 0; i < x->x_n; i++){
+        t_voice *v = &x->x_vec[i];
+        if(!v->v_used)
+            continue;
+        if(v->v_released) // already sent
+            voices_out(x, v, v->v_pitch, 0);
+        else
+            voices_noteoff(x, v);
     }
-    x->x_count = 0;
 }
 
 static void voices_voices(t_voices *x, t_float f){
     if(x->x_list_mode){
-        t_voice *v;
         int n = (int)f < 1 ? 1 : (int)f;
         if(n == x->x_n)
             return;
         voices_flush(x);
-        if(x->x_vec)
-            freebytes(x->x_vec, x->x_n * sizeof(*x->x_vec));
-        x->x_vec = (t_voice *)getbytes(n * sizeof(*x->x_vec));
-        x->x_n = n;
-        int i;
-        for(v = x->x_vec, i = n; i--; v++){ // initialize voices
-            v->v_pitch = v->v_used = v->v_count = 0;
-            v->v_clock = clock_new(v, (t_method)voice_tick);
-        }
+        freebytes(x->x_vec, x->x_n * sizeof(*x->x_vec));
+        freebytes(x->x_hash, (1 << x->x_hashbits) * sizeof(*x->x_hash));
+        voices_alloc(x, n);
     }
     else
         post("[voices]: 'voices' is not pertinent when not in list mode");
 }
 
 static void voices_clear(t_voices *x){
-    t_voice *v;
-    int i;
-    for(v = x->x_vec, i = x->x_n; i--; v++)
-        v->v_pitch = v->v_used = v->v_released = v->v_count = 0; // zero voices
-    x->x_count = 0;
+    voices_reset(x);
 }
 
 static void voices_free(t_voices *x){
-    t_voice *v;
-    int i;
-    for(v = x->x_vec, i = x->x_n; i--; v++){
-        if(v->v_clock) // needed ???
-            clock_free(v->v_clock);
-    }
     clock_free(x->x_clock);
-    freebytes(x->x_vec, x->x_n * sizeof (*x->x_vec));
+    freebytes(x->x_vec, x->x_n * sizeof(*x->x_vec));
+    freebytes(x->x_hash, (1 << x->x_hashbits) * sizeof(*x->x_hash));
     if(x->x_outs)
         freebytes(x->x_outs, x->x_n * sizeof(*x->x_outs));
 }
@@ -321,7 +345,6 @@ static void *voices_new(t_symbol *s, int argc, t_atom *argv){
     t_symbol *dummy = s;
     dummy = NULL;
     t_voices *x = (t_voices *)pd_new(voices_class);
-    t_voice *v;
 // default
     x->x_offset = 0;
     x->x_list_mode = 0;
@@ -385,15 +408,9 @@ static void *voices_new(t_symbol *s, int argc, t_atom *argv){
     x->x_retrig = retrig;
     if(n < 1)
         n = 1;
-    x->x_n = n;
-    x->x_vec = (t_voice *)getbytes(n * sizeof(*x->x_vec));
-    int i;
-    for(v = x->x_vec, i = n; i--; v++){ // initialize voices
-        v->v_pitch = v->v_used = v->v_count = 0;
-        v->v_clock = clock_new(v, (t_method)voice_tick);
-    }
     x->x_clock = clock_new(x, (t_method)voices_tick);
-    x->x_vel = x->x_count = 0;
+    voices_alloc(x, n);
+    x->x_vel = 0;
     floatinlet_new(&x->x_obj, &x->x_vel);
     floatinlet_new(&x->x_obj, &x->x_release);
     if(x->x_list_mode)
@@ -403,7 +420,7 @@ static void *voices_new(t_symbol *s, int argc, t_atom *argv){
         if(!(outs = (t_outlet **)getbytes(x->x_n * sizeof(*outs))))
             return(0);
         x->x_outs = outs;
-        for(i = 0; i < x->x_n; i++)
+        for(int i = 0; i < x->x_n; i++)
             x->x_outs[i] = outlet_new((t_object *)x, &s_list);
     }
     x->x_extra = outlet_new((t_object *)x, &s_list);
@@ -2,6 +2,7 @@
 
 #include "m_pd.h"
 #include "math.h"
+#include "oversample.h"
 
 static t_class *wrap2_class;
 
@@ -10,43 +11,63 @@ typedef struct _wrap2{
     t_inlet   *x_low_let;
     t_inlet   *x_high_let;
     t_outlet  *x_outlet;
+    t_oversample x_os;
 }t_wrap2;
 
+static void wrap2_oversample(t_wrap2 *x, t_floatarg f){
+    if(!oversample_factor(&x->x_os, (int)f))
+        pd_error(x, "[wrap2~]: oversampling is 1, 2, 4 or 8");
+}
+
+static inline float wrap2_kernel(float input, float in_low, float in_high){
+    t_float output;
+    float low = in_low;
+    float high = in_high;
+    if(low > high){
+        low = in_high;
+        high = in_low;
+    }
+    float range = high - low;
+    if(low == high)
+        output = low;
+    else{
+        if(input < low){
+            output = input;
+            while(output < low)
+                output += range;
+        }
+        else
+            output = fmod(input - low, range) + low;
+    }
+    return(output);
+}
+
+// 'n' samples at 2^shift times the rate of the low and high inputs
+static void wrap2_run(int n, t_float *in1, t_float *in2, t_float *in3, t_float *out, int shift){
+    for(int i = 0; i < n; i++)
+        out[i] = wrap2_kernel(in1[i], in2[i >> shift], in3[i >> shift]);
+}
+
 static t_int *wrap2_perform(t_int *w){
+    t_wrap2 *x = (t_wrap2 *)(w[1]);
     int n = (t_int)(w[2]);
     t_float *in1 = (t_float *)(w[3]);
     t_float *in2 = (t_float *)(w[4]);
     t_float *in3 = (t_float *)(w[5]);
     t_float *out = (t_sample *)(w[6]);
-    while(n--){
-        t_float output;
-        float input = *in1++;
-        float in_low = *in2++;
-        float in_high = *in3++;
-        float low = in_low;
-        float high = in_high;
-        if(low > high){
-            low = in_high;
-            high = in_low;
-        }
-        float range = high - low;
-        if(low == high)
-            output = low;
-        else{
-            if(input < low){
-                output = input;
-                while(output < low)
-                    output += range;
-            }
-            else
-                output = fmod(input - low, range) + low;
-        }
-        *out++ = output;
+    t_oversample *os = &x->x_os;
+    if(os->o_factor == 1)
+        wrap2_run(n, in1, in2, in3, out, 0);
+    else{
+        t_float *buf = oversample_up(os, in1);
+        wrap2_run(n << os->o_shift, buf, in2, in3, buf, os->o_shift);
+        oversample_down(os, out);
     }
     return (w + 7);
 }
 
 static void wrap2_dsp(t_wrap2 *x, t_signal **sp){
+    oversample_dsp(&x->x_os, sp[0]->s_n);
     dsp_add(wrap2_perform, 6, x, sp[0]->s_n,
             sp[0]->s_vec, sp[1]->s_vec, sp[2]->s_vec, sp[3]->s_vec);
 }
@@ -55,6 +76,7 @@ static void *wrap2_free(t_wrap2 *x){
     inlet_free(x->x_low_let);
     inlet_free(x->x_high_let);
     outlet_free(x->x_outlet);
+    oversample_free(&x->x_os);
     return (void *)x;
 }
 
@@ -64,6 +86,15 @@ static void *wrap2_new(t_symbol *s, int ac, t_atom *av){
     dummy = NULL;
 /////////////////////////////////////////////////////////////////////////////////////
     float init_low, low, init_high, high;
+    oversample_init(&x->x_os, 1);
+    if(ac >= 2 && av->a_type == A_SYMBOL){
+        if(atom_getsymbol(av) == gensym("-oversample")){
+            wrap2_oversample(x, atom_getfloat(av + 1));
+            ac -= 2, av += 2;
+        }
+        else
+            goto errstate;
+    }
     if(ac){
         if(ac == 1){
             if(av -> a_type == A_FLOAT){
@@ -123,4 +154,5 @@ void wrap2_tilde_setup(void){
         (t_method)wrap2_free, sizeof(t_wrap2), CLASS_DEFAULT, A_GIMME, 0);
     class_addmethod(wrap2_class, nullfn, gensym("signal"), 0);
     class_addmethod(wrap2_class, (t_method)wrap2_dsp, gensym("dsp"), A_CANT, 0);
+    class_addmethod(wrap2_class, (t_method)wrap2_oversample, gensym("oversample"), A_FLOAT, 0);
 }
@@ -26,15 +26,58 @@ Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
 #include <fluidsynth.h>
 #include <string.h>
 
-
 #ifdef _MSC_VER
 #include <Windows.h>
 #else
 #include <unistd.h>
+#include <pthread.h>
+#endif
+
+// threads for the background load and the render ahead: Win32 with MSVC,
+// pthreads elsewhere (MinGW included)
+#ifdef _MSC_VER
+typedef HANDLE              t_sfont_thread;
+typedef CRITICAL_SECTION    t_sfont_mutex;
+typedef CONDITION_VARIABLE  t_sfont_cond;
+#define SFONT_THREAD(fn)            static DWORD WINAPI fn(LPVOID z)
+#define SFONT_THREAD_RETURN         return(0)
+#define sfont_thread_create(t, fn, z)   ((*(t) = CreateThread(NULL, 0, fn, z, 0, NULL)) == NULL)
+#define sfont_thread_join(t)        (WaitForSingleObject(t, INFINITE), CloseHandle(t))
+#define sfont_mutex_init(m)         InitializeCriticalSection(m)
+#define sfont_mutex_destroy(m)      DeleteCriticalSection(m)
+#define sfont_mutex_lock(m)         EnterCriticalSection(m)
+#define sfont_mutex_unlock(m)       LeaveCriticalSection(m)
+#define sfont_cond_init(c)          InitializeConditionVariable(c)
+#define sfont_cond_destroy(c)       ((void)(c)) // nothing to free
+#define sfont_cond_wait(c, m)       SleepConditionVariableCS(c, m, INFINITE)
+#define sfont_cond_broadcast(c)     WakeAllConditionVariable(c)
+#else
+typedef pthread_t           t_sfont_thread;
+typedef pthread_mutex_t     t_sfont_mutex;
+typedef pthread_cond_t      t_sfont_cond;
+#define SFONT_THREAD(fn)            static void *fn(void *z)
+#define SFONT_THREAD_RETURN         return(NULL)
+#define sfont_thread_create(t, fn, z)   pthread_create(t, NULL, fn, z)
+#define sfont_thread_join(t)        pthread_join(t, NULL)
+#define sfont_mutex_init(m)         pthread_mutex_init(m, NULL)
+#define sfont_mutex_destroy(m)      pthread_mutex_destroy(m)
+#define sfont_mutex_lock(m)         pthread_mutex_lock(m)
+#define sfont_mutex_unlock(m)       pthread_mutex_unlock(m)
+#define sfont_cond_init(c)          pthread_cond_init(c, NULL)
+#define sfont_cond_destroy(c)       pthread_cond_destroy(c)
+#define sfont_cond_wait(c, m)       pthread_cond_wait(c, m)
+#define sfont_cond_broadcast(c)     pthread_cond_broadcast(c)
 #endif
 
 #define MAXSYSEXSIZE 1024 // Size of sysex data list (excluding the F0 [240] and F7 [247] bytes)
 
+#define SFONT_POLL      20  // ms between checks for a background load
+
+// states of a background load
+#define SFONT_IDLE      0
+#define SFONT_LOADING   1
+#define SFONT_LOADED    2
+
 static t_class *sfont_class;
  
 static int printed;
@@ -46,28 +89,66 @@ typedef struct _sfont{
     fluid_sfont_t      *x_sfont;
     fluid_preset_t     *x_preset;
     t_elsefile         *x_elsefilehandle;
-    t_outlet           *x_out_left;
-    t_outlet           *x_out_right;
+    t_sample          **x_outs;         // left and right of each pair
+    float             **x_fx;           // effects of each group, mixed to its pair
+    int                 x_nfx;
+    int                 x_nfxchan;      // effects per group, 2 for reverb and chorus
+    int                 x_npairs;       // the channels of each group go to a pair
     t_canvas           *x_canvas;
     t_symbol           *x_sfname;
     t_symbol           *x_tune_name;
     t_outlet           *x_info_out;
     float               x_base;
     int                 x_sysex;
-    int                 x_tune_ch;
+    char                x_tune_mask[256]; // channels to retune
+    int                 x_chtuning[256];  // selected tuning of each channel, -1 if unknown
     int                 x_tune_bank;
     int                 x_tune_prog;
     int                 x_ch;
     int                 x_verbosity;
     int                 x_count;
     int                 x_ready;
-    int                 x_id;
+    int                 x_id;           // of the loaded soundfont
     int                 x_bank;
     int                 x_pgm;
     t_atom              x_at[MAXSYSEXSIZE];
     unsigned char       x_type;
     unsigned char       x_data;
     unsigned char       x_channel;
+    // single note tuning sysex messages for the same tuning are merged and
+    // applied at once, at the end of the logical time or before any other
+    // message that reaches the synth
+    t_clock            *x_sysexclock;
+    int                 x_devid;
+    int                 x_tunen;
+    int                 x_tunebank;
+    int                 x_tuneprog;
+    int                 x_tuneapply;
+    char                x_tuneset[128];
+    double              x_tunepitch[128];
+    // with '-async', soundfonts are loaded by another synth in a thread,
+    // and then moved to 'x_synth', which keeps playing meanwhile
+    fluid_synth_t      *x_loader;
+    fluid_settings_t   *x_loadsettings;
+    t_clock            *x_loadclock;
+    t_sfont_thread      x_loadthread;
+    char                x_loadpath[MAXPDSTRING];
+    t_symbol           *x_loadname;
+    int                 x_loadstate;
+    int                 x_loadid;
+    int                 x_async;
+    int                 x_dynamic;
+    // with '-ahead', a thread renders the next block while Pd computes
+    // the current one, which is output a block late
+    t_sfont_thread      x_renderthread;
+    t_sfont_mutex       x_mutex;
+    t_sfont_cond        x_cond;
+    t_sample           *x_buf;          // the block rendered ahead, for each output
+    t_sample          **x_bufs;
+    int                 x_nblock;
+    int                 x_ahead;
+    int                 x_pending;      // the next block is being rendered
+    int                 x_quit;
 }t_sfont;
 
 static void sfont_float(t_sfont *x, t_float f);
@@ -80,12 +161,74 @@ static void sfont_verbose(t_sfont *x, t_floatarg f){
     x->x_verbosity = f != 0;
 }
 
+static void sfont_flush(t_sfont *x){
+    if(!x->x_tunen)
+        return;
+    int keys[128], n = 0;
+    double pitches[128];
+    for(int k = 0; k < 128; k++){
+        if(x->x_tuneset[k]){
+            keys[n] = k, pitches[n++] = x->x_tunepitch[k];
+            x->x_tuneset[k] = 0;
+        }
+    }
+    x->x_tunen = 0;
+    clock_unset(x->x_sysexclock);
+    fluid_synth_tune_notes(x->x_synth, x->x_tunebank, x->x_tuneprog, n, keys, pitches, x->x_tuneapply);
+}
+
+// a single note tuning change (realtime or not, with bank or not), as
+// FluidSynth would parse it, returns 0 if it's something else
+static int sfont_tunesysex(t_sfont *x, unsigned char *buf, int len){
+    if(len < 6 || (buf[0] != 0x7E && buf[0] != 0x7F) || buf[2] != 0x08
+    || (buf[1] != x->x_devid && buf[1] != 0x7F))
+        return(0);
+    for(int i = 0; i < len; i++) // not MIDI data, left to FluidSynth
+        if(buf[i] > 0x7F)
+            return(0);
+    unsigned char *p = buf + 4;
+    int bank = 0;
+    if(buf[3] == 0x07){
+        if(len < 7)
+            return(0);
+        bank = *p++;
+    }
+    else if(buf[3] != 0x02)
+        return(0);
+    int prog = *p++, n = *p++, apply = buf[0] == 0x7F;
+    if(p + 4 * n > buf + len)
+        return(0);
+    if(x->x_tunen && (bank != x->x_tunebank || prog != x->x_tuneprog || apply != x->x_tuneapply))
+        sfont_flush(x);
+    x->x_tunebank = bank, x->x_tuneprog = prog, x->x_tuneapply = apply;
+    for(int i = 0; i < n; i++, p += 4){
+        if(p[1] == 0x7F && p[2] == 0x7F && p[3] == 0x7F) // no change
+            continue;
+        if(!x->x_tuneset[p[0]])
+            x->x_tuneset[p[0]] = 1, x->x_tunen++;
+        x->x_tunepitch[p[0]] = p[1] * 100. + ((p[2] << 7) | p[3]) * 100. / 16384.;
+    }
+    if(x->x_tunen)
+        clock_delay(x->x_sysexclock, 0);
+    return(1);
+}
+
+static void sfont_poly(t_sfont *x, t_floatarg f){
+    int poly = f < 1 ? 1 : f > 65535 ? 65535 : (int)f;
+    if(fluid_synth_set_polyphony(x->x_synth, poly) != FLUID_OK)
+        pd_error(x, "[sfont~]: couldn't set polyphony to %d", poly);
+}
+
 static void sfont_panic(t_sfont *x){
+    sfont_flush(x);
     if(x->x_synth)
         fluid_synth_system_reset(x->x_synth);
+    for(int i = 0; i < x->x_ch; i++)
+        x->x_chtuning[i] = -1;
 }
 
 static void sfont_transp(t_sfont *x, t_symbol *s, int ac, t_atom *av){
+    sfont_flush(x);
     s = NULL;
     if(ac < 1 || ac > 2)
         return;
@@ -95,6 +238,7 @@ static void sfont_transp(t_sfont *x, t_symbol *s, int ac, t_atom *av){
 }
 
 static void sfont_pan(t_sfont *x, t_symbol *s, int ac, t_atom *av){
+    sfont_flush(x);
     s = NULL;
     float f1 = atom_getfloatarg(0, ac, av);
     int ch = atom_getintarg(1, ac, av);
@@ -103,6 +247,7 @@ static void sfont_pan(t_sfont *x, t_symbol *s, int ac, t_atom *av){
 }
 
 static void sfont_note(t_sfont *x, t_symbol *s, int ac, t_atom *av){
+    sfont_flush(x);
     s = NULL;
     if(ac == 1)
         sfont_float(x, atom_getfloatarg(0, ac, av));
@@ -121,6 +266,7 @@ static void sfont_note(t_sfont *x, t_symbol *s, int ac, t_atom *av){
 }
 
 static void sfont_program_change(t_sfont *x, t_symbol *s, int ac, t_atom *av){
+    sfont_flush(x);
     s = NULL;
     if(ac == 1 || ac == 2){
         int pgm = atom_getintarg(0, ac, av);
@@ -156,6 +302,7 @@ static void sfont_program_change(t_sfont *x, t_symbol *s, int ac, t_atom *av){
 }
 
 static void sfont_bank(t_sfont *x, t_symbol *s, int ac, t_atom *av){
+    sfont_flush(x);
     s = NULL;
     if(ac == 1 || ac == 2){
         int bank = atom_getintarg(0, ac, av);
@@ -191,6 +338,7 @@ static void sfont_bank(t_sfont *x, t_symbol *s, int ac, t_atom *av){
 }
 
 static void sfont_control_change(t_sfont *x, t_symbol *s, int ac, t_atom *av){
+    sfont_flush(x);
     s = NULL;
     if(ac == 2 || ac == 3){
         int val = atom_getintarg(0, ac, av);
@@ -201,6 +349,7 @@ static void sfont_control_change(t_sfont *x, t_symbol *s, int ac, t_atom *av){
 }
 
 static void sfont_pitch_bend(t_sfont *x, t_symbol *s, int ac, t_atom *av){
+    sfont_flush(x);
     s = NULL;
     if(ac == 1 || ac == 2){
         int val = atom_getintarg(0, ac, av);
@@ -225,17 +374,26 @@ static void sfont_pitch_bend(t_sfont *x, t_symbol *s, int ac, t_atom *av){
 }*/
 
 static void sfont_unsel_tuning(t_sfont *x,  t_symbol *s, int ac, t_atom *av){
+    sfont_flush(x);
     s = NULL;
     if(ac){
         int ch = atom_getfloatarg(0, ac, av);
         fluid_synth_deactivate_tuning(x->x_synth, ch-1, 1);
+        if(ch > 0 && ch <= x->x_ch)
+            x->x_chtuning[ch-1] = -1;
     }
-    else for(int i = 0; i < x->x_ch; i++)
+    else for(int i = 0; i < x->x_ch; i++){
         fluid_synth_deactivate_tuning(x->x_synth, i, 1);
+        x->x_chtuning[i] = -1;
+    }
 }
 
-static void sfont_sel_tuning(t_sfont *x, t_float bank, t_float pgm, t_float ch){
+static void sfont_sel_tuning(t_sfont *x, t_float bank, t_float pgm, t_float f){
+    int ch = (int)f;
+    sfont_flush(x);
     fluid_synth_activate_tuning(x->x_synth, ch-1, bank, pgm, 1);
+    if(ch > 0 && ch <= x->x_ch)
+        x->x_chtuning[ch-1] = -1; // 'bank' and 'pgm' may be out of range
     char scale_name[256];
     fluid_synth_tuning_dump(x->x_synth, bank, pgm, scale_name, 256, NULL);
     t_atom at[1];
@@ -243,14 +401,19 @@ static void sfont_sel_tuning(t_sfont *x, t_float bank, t_float pgm, t_float ch){
     outlet_anything(x->x_info_out, gensym("scale"), 1, at);
 }
 
+// replacing a tuning also retunes the channels that have it selected, so
+// it's only selected in channels that have another one
 static void set_key_tuning(t_sfont *x, double *pitches){
-    int ch = x->x_tune_ch, bank = x->x_tune_bank, pgm = x->x_tune_prog;
+    int bank = x->x_tune_bank, pgm = x->x_tune_prog, id = bank * 128 + pgm;
     const char* name = x->x_tune_name->s_name;
+    sfont_flush(x);
     fluid_synth_activate_key_tuning(x->x_synth, bank, pgm, name, pitches, 1);
-    if(ch > 0)
-        fluid_synth_activate_tuning(x->x_synth, ch-1, bank, pgm, 1);
-    else if(!ch) for(int i = 0; i < x->x_ch; i++)
-        fluid_synth_activate_tuning(x->x_synth, i, bank, pgm, 1);
+    for(int i = 0; i < x->x_ch; i++){
+        if(x->x_tune_mask[i] && x->x_chtuning[i] != id){
+            fluid_synth_activate_tuning(x->x_synth, i, bank, pgm, 1);
+            x->x_chtuning[i] = id;
+        }
+    }
 }
 
 static void sfont_set_tuning(t_sfont *x,  t_symbol *s, int ac, t_atom *av){
@@ -259,12 +422,21 @@ static void sfont_set_tuning(t_sfont *x,  t_symbol *s, int ac, t_atom *av){
         return;
     x->x_tune_bank = atom_getintarg(0, ac, av);
     x->x_tune_prog = atom_getintarg(1, ac, av);
-    x->x_tune_ch = atom_getintarg(2, ac, av);
-    if(ac == 4)
-        x->x_tune_name = atom_getsymbolarg(3, ac, av);
+    x->x_tune_bank = x->x_tune_bank < 0 ? 0 : x->x_tune_bank > 127 ? 127 : x->x_tune_bank;
+    x->x_tune_prog = x->x_tune_prog < 0 ? 0 : x->x_tune_prog > 127 ? 127 : x->x_tune_prog;
+    memset(x->x_tune_mask, 0, sizeof(x->x_tune_mask));
+    int i;
+    for(i = 2; i < ac && av[i].a_type == A_FLOAT; i++){ // channels, 0 is all
+        int ch = atom_getintarg(i, ac, av);
+        if(!ch)
+            memset(x->x_tune_mask, 1, x->x_ch);
+        else if(ch > 0 && ch <= x->x_ch)
+            x->x_tune_mask[ch-1] = 1;
+    }
+    if(i < ac)
+        x->x_tune_name = atom_getsymbolarg(i, ac, av);
     else
         x->x_tune_name = gensym("Custom-tuning");
-        
 }
 
 static void sfont_remap(t_sfont *x, t_symbol *s, int ac, t_atom *av){
@@ -331,6 +503,7 @@ static void sfont_base(t_sfont *x, t_float f){
 }*/
 
 static void sfont_aftertouch(t_sfont *x, t_symbol *s, int ac, t_atom *av){
+    sfont_flush(x);
     s = NULL;
     if(ac == 1 || ac == 2){
         int val = atom_getintarg(0, ac, av);
@@ -340,6 +513,7 @@ static void sfont_aftertouch(t_sfont *x, t_symbol *s, int ac, t_atom *av){
 }
 
 static void sfont_polytouch(t_sfont *x, t_symbol *s, int ac, t_atom *av){
+    sfont_flush(x);
     s = NULL;
     if(ac == 2 || ac == 3){
         int val = atom_getintarg(0, ac, av);
@@ -352,15 +526,21 @@ static void sfont_polytouch(t_sfont *x, t_symbol *s, int ac, t_atom *av){
 static void sfont_sysex(t_sfont *x, t_symbol *s, int ac, t_atom *av){
     s = NULL;
     if(ac > 0){
-        char buf[MAXSYSEXSIZE];
+        unsigned char buf[MAXSYSEXSIZE];
         int len = 0;
         while(len < MAXSYSEXSIZE && len < ac){
             buf[len] = atom_getintarg(len, ac, av);
             len++;
         }
+        if(sfont_tunesysex(x, buf, len))
+            return;
+        sfont_flush(x);
         // TODO: output fluidsynth's response to info outlet
         // in order to handle bulk dump requests
-        fluid_synth_sysex(x->x_synth, buf, len, NULL, NULL, NULL, 0);
+        fluid_synth_sysex(x->x_synth, (char *)buf, len, NULL, NULL, NULL, 0);
+        if(len > 2 && buf[2] == 0x08) // tuning messages may select tunings
+            for(int i = 0; i < x->x_ch; i++)
+                x->x_chtuning[i] = -1;
     }
 }
 
@@ -373,7 +553,8 @@ static void sfont_float(t_sfont *x, t_float f){ // raw midi input
                 x->x_count = 0;
             }
             else if(val == 0xF7){ // end of sysex
-                sfont_sysex(x, &s_list, x->x_count, x->x_at);
+                if(x->x_sysex > 0)
+                    sfont_sysex(x, &s_list, x->x_count, x->x_at);
                 x->x_sysex = x->x_count = 0;
             }
             else{
@@ -382,9 +563,14 @@ static void sfont_float(t_sfont *x, t_float f){ // raw midi input
                 x->x_ready = (x->x_type == 0xC0 || x->x_type == 0xD0); // ready if program or touch
             }
         }
-        else if(x->x_sysex){
-            SETFLOAT(&x->x_at[x->x_count], (t_float)val);
-            x->x_count++;
+        else if(x->x_sysex){ // -1 skips an overflowed message up to the F7
+            if(x->x_sysex > 0 && x->x_count < MAXSYSEXSIZE)
+                SETFLOAT(&x->x_at[x->x_count++], (t_float)val);
+            else if(x->x_sysex > 0){
+                pd_error(x, "[sfont~]: sysex message longer than %d bytes ignored", MAXSYSEXSIZE);
+                x->x_sysex = -1;
+                x->x_count = 0;
+            }
         }
         else{
             if(x->x_ready){
@@ -478,11 +664,86 @@ static void sfont_info(t_sfont *x){
     post("\n");
 }
 
+// the soundfont replaces the previous one, 'id' is negative if it failed
+static void sfont_loaded(t_sfont *x, int id, t_symbol *name){
+    t_atom at[1];
+    if(id < 0){
+        pd_error(x, "[sfont~]: couldn't load %s", name->s_name);
+        SETFLOAT(&at[0], 0);
+        outlet_anything(x->x_info_out, gensym("loaded"), 1, at);
+        return;
+    }
+    if(x->x_id >= 0)
+        fluid_synth_sfunload(x->x_synth, x->x_id, 0);
+    x->x_id = id;
+    fluid_synth_program_reset(x->x_synth);
+    x->x_sfont = fluid_synth_get_sfont_by_id(x->x_synth, id);
+    x->x_sfname = name;
+    if(x->x_verbosity)
+        sfont_info(x);
+    fluid_preset_t* preset = fluid_sfont_get_preset(x->x_sfont, x->x_bank = 0, x->x_pgm = 0);
+    if(preset){
+        const char* pname = fluid_preset_get_name(preset);
+        SETSYMBOL(&at[0], gensym(pname));
+        outlet_anything(x->x_info_out, gensym("pname"), 1, at);
+    }
+    SETFLOAT(&at[0], 1);
+    outlet_anything(x->x_info_out, gensym("loaded"), 1, at);
+}
+
+SFONT_THREAD(sfont_loadthread){
+    t_sfont *x = (t_sfont *)z;
+    int id = fluid_synth_sfload(x->x_loader, x->x_loadpath, 0);
+    sfont_mutex_lock(&x->x_mutex);
+    x->x_loadid = id;
+    x->x_loadstate = SFONT_LOADED;
+    sfont_mutex_unlock(&x->x_mutex);
+    SFONT_THREAD_RETURN;
+}
+
+// polls for the end of a background load, then the soundfont goes from
+// the loader to the synth
+static void sfont_loadtick(t_sfont *x){
+    sfont_mutex_lock(&x->x_mutex);
+    int state = x->x_loadstate;
+    sfont_mutex_unlock(&x->x_mutex);
+    if(state != SFONT_LOADED){
+        clock_delay(x->x_loadclock, SFONT_POLL);
+        return;
+    }
+    sfont_thread_join(x->x_loadthread);
+    x->x_loadstate = SFONT_IDLE;
+    int id = -1;
+    if(x->x_loadid >= 0){
+        fluid_sfont_t *sfont = fluid_synth_get_sfont_by_id(x->x_loader, x->x_loadid);
+        fluid_synth_remove_sfont(x->x_loader, sfont);
+        id = fluid_synth_add_sfont(x->x_synth, sfont);
+    }
+    sfont_loaded(x, id, x->x_loadname);
+}
+
+// the loader only reads files, its soundfonts are never played there
+static int sfont_newloader(t_sfont *x){
+    if(x->x_loader)
+        return(1);
+    if(!(x->x_loadsettings = new_fluid_settings()))
+        return(0);
+    fluid_settings_setint(x->x_loadsettings, "synth.ladspa.active", 0);
+    fluid_settings_setint(x->x_loadsettings, "synth.polyphony", 1);
+    fluid_settings_setint(x->x_loadsettings, "synth.dynamic-sample-loading", x->x_dynamic);
+    x->x_loader = new_fluid_synth(x->x_loadsettings);
+    return(x->x_loader != NULL);
+}
+
 static void fluid_do_load(t_sfont *x, t_symbol *name){
     const char* filename = name->s_name;
     const char* ext = strrchr(filename, '.');
-    char realdir[MAXPDSTRING], *realname = NULL;
+    char realdir[MAXPDSTRING], path[MAXPDSTRING], *realname = NULL;
     int fd;
+    if(x->x_loadstate != SFONT_IDLE){
+        pd_error(x, "[sfont~]: still loading %s", x->x_loadname->s_name);
+        return;
+    }
     if(ext && !strchr(ext, '/')){ // extension already supplied, no default extension
         ext = "";
         fd = canvas_open(x->x_canvas, filename, ext, realdir, &realname, MAXPDSTRING, 0);
@@ -504,24 +765,24 @@ static void fluid_do_load(t_sfont *x, t_symbol *name){
         }
     }
     sys_close(fd);
-    chdir(realdir);
-    int id = fluid_synth_sfload(x->x_synth, realname, 0);
-    if(id >= 0){
-        fluid_synth_program_reset(x->x_synth);
-        x->x_sfont = fluid_synth_get_sfont_by_id(x->x_synth, id);
-        x->x_sfname = name;
-        if(x->x_verbosity)
-            sfont_info(x);
-        fluid_preset_t* preset = fluid_sfont_get_preset(x->x_sfont, x->x_bank = 0, x->x_pgm = 0);
-        if(preset){
-            const char* pname = fluid_preset_get_name(preset);
-            t_atom at[1];
-            SETSYMBOL(&at[0], gensym(pname));
-            outlet_anything(x->x_info_out, gensym("pname"), 1, at);
-        }
+    snprintf(path, MAXPDSTRING, "%s/%s", realdir, realname);
+    if(!x->x_async){
+        sfont_loaded(x, fluid_synth_sfload(x->x_synth, path, 0), name);
+        return;
     }
-    else
-        post("[sfont~]: couldn't load %d", realname);
+    if(!sfont_newloader(x)){
+        pd_error(x, "[sfont~]: bug couldn't create loader synth");
+        return;
+    }
+    strcpy(x->x_loadpath, path);
+    x->x_loadname = name;
+    x->x_loadstate = SFONT_LOADING;
+    if(sfont_thread_create(&x->x_loadthread, sfont_loadthread, x)){
+        x->x_loadstate = SFONT_IDLE;
+        pd_error(x, "[sfont~]: couldn't start loading %s", filename);
+        return;
+    }
+    clock_delay(x->x_loadclock, SFONT_POLL);
 }
 
 static void sfont_readhook(t_pd *z, t_symbol *fn, int ac, t_atom *av){
@@ -541,24 +802,112 @@ static void sfont_open(t_sfont *x, t_symbol *s){
         panel_click_open(x->x_elsefilehandle);
 }
 
+// with more than one pair, MIDI channel 'ch' goes to the pair ch % npairs
+// and fluid_synth_process() adds to the outputs, so they're zeroed first
+static void sfont_render(t_sfont *x, t_sample **outs, int n){
+    if(x->x_npairs == 1){
+        fluid_synth_write_float(x->x_synth, n, outs[0], 0, 1, outs[1], 0, 1);
+        return;
+    }
+    int nout = 2 * x->x_npairs;
+    for(int j = 0; j < nout; j++)
+        memset(outs[j], 0, n * sizeof(t_sample));
+    for(int j = 0; j < x->x_nfx; j++) // effects of each group, then left and right
+        x->x_fx[j] = outs[(j / (2 * x->x_nfxchan) % x->x_npairs) * 2 + j % 2];
+    fluid_synth_process(x->x_synth, n, x->x_nfx, x->x_fx, nout, (float **)outs);
+}
+
 t_int *sfont_perform(t_int *w){
     t_sfont *x = (t_sfont *)(w[1]);
-    t_sample *left = (t_sample *)(w[2]);
-    t_sample *right = (t_sample *)(w[3]);
-    int n = (int)(w[4]);
-    fluid_synth_write_float(x->x_synth, n, left, 0, 1, right, 0, 1);
-    return(w+5);
+    sfont_render(x, x->x_outs, (int)(w[2]));
+    return(w+3);
+}
+
+SFONT_THREAD(sfont_renderthread){
+    t_sfont *x = (t_sfont *)z;
+    sfont_mutex_lock(&x->x_mutex);
+    while(1){
+        while(!x->x_pending && !x->x_quit)
+            sfont_cond_wait(&x->x_cond, &x->x_mutex);
+        if(x->x_quit)
+            break;
+        int n = x->x_nblock;
+        sfont_mutex_unlock(&x->x_mutex);
+        sfont_render(x, x->x_bufs, n);
+        sfont_mutex_lock(&x->x_mutex);
+        x->x_pending = 0;
+        sfont_cond_broadcast(&x->x_cond);
+    }
+    sfont_mutex_unlock(&x->x_mutex);
+    SFONT_THREAD_RETURN;
+}
+
+// output the block rendered ahead and start the next one, if the thread
+// is late this waits for it
+t_int *sfont_perform_ahead(t_int *w){
+    t_sfont *x = (t_sfont *)(w[1]);
+    int n = (int)(w[2]);
+    sfont_mutex_lock(&x->x_mutex);
+    while(x->x_pending)
+        sfont_cond_wait(&x->x_cond, &x->x_mutex);
+    for(int j = 0; j < 2 * x->x_npairs; j++)
+        memcpy(x->x_outs[j], x->x_bufs[j], n * sizeof(t_sample));
+    x->x_pending = 1;
+    sfont_cond_broadcast(&x->x_cond);
+    sfont_mutex_unlock(&x->x_mutex);
+    return(w+3);
 }
 
 static void sfont_dsp(t_sfont *x, t_signal **sp){
-    dsp_add(sfont_perform, 4, x, sp[0]->s_vec, sp[1]->s_vec, (t_int)sp[0]->s_n);
+    int n = sp[0]->s_n, nout = 2 * x->x_npairs;
+    for(int j = 0; j < nout; j++)
+        x->x_outs[j] = sp[j]->s_vec;
+    if(x->x_ahead){
+        sfont_mutex_lock(&x->x_mutex);
+        while(x->x_pending)
+            sfont_cond_wait(&x->x_cond, &x->x_mutex);
+        if(n != x->x_nblock){
+            x->x_buf = (t_sample *)resizebytes(x->x_buf,
+                nout * x->x_nblock * sizeof(t_sample), nout * n * sizeof(t_sample));
+            memset(x->x_buf, 0, nout * n * sizeof(t_sample));
+            for(int j = 0; j < nout; j++)
+                x->x_bufs[j] = x->x_buf + j * n;
+            x->x_nblock = n;
+        }
+        sfont_mutex_unlock(&x->x_mutex);
+        dsp_add(sfont_perform_ahead, 2, x, (t_int)n);
+    }
+    else
+        dsp_add(sfont_perform, 2, x, (t_int)n);
 }
 
 static void sfont_free(t_sfont *x){
+    if(x->x_ahead){
+        sfont_mutex_lock(&x->x_mutex);
+        x->x_quit = 1;
+        sfont_cond_broadcast(&x->x_cond);
+        sfont_mutex_unlock(&x->x_mutex);
+        sfont_thread_join(x->x_renderthread);
+        freebytes(x->x_buf, 2 * x->x_npairs * x->x_nblock * sizeof(t_sample));
+    }
+    freebytes(x->x_outs, 2 * x->x_npairs * sizeof(*x->x_outs));
+    freebytes(x->x_bufs, 2 * x->x_npairs * sizeof(*x->x_bufs));
+    freebytes(x->x_fx, x->x_nfx * sizeof(*x->x_fx));
+    if(x->x_loadstate != SFONT_IDLE) // can't be interrupted
+        sfont_thread_join(x->x_loadthread);
+    clock_free(x->x_loadclock);
+    clock_free(x->x_sysexclock);
     if(x->x_synth)
         delete_fluid_synth(x->x_synth);
     if(x->x_settings)
         delete_fluid_settings(x->x_settings);
+    // after the synth, its soundfonts use the loader's file callbacks
+    if(x->x_loader)
+        delete_fluid_synth(x->x_loader);
+    if(x->x_loadsettings)
+        delete_fluid_settings(x->x_loadsettings);
+    sfont_mutex_destroy(&x->x_mutex);
+    sfont_cond_destroy(&x->x_cond);
     if(x->x_elsefilehandle)
         elsefile_free(x->x_elsefilehandle);
 }
@@ -572,21 +921,25 @@ static void *sfont_new(t_symbol *s, int ac, t_atom *av){
     x->x_sfname = NULL;
     x->x_tune_name = gensym("custom-tuning");
     x->x_base = 60;
-    x->x_tune_ch = 1;
+    x->x_tune_mask[0] = 1;
+    for(int i = 0; i < 256; i++)
+        x->x_chtuning[i] = -1;
+    x->x_sysexclock = clock_new(x, (t_method)sfont_flush);
     x->x_tune_bank = x->x_tune_prog = 0;
+    x->x_id = -1;
+    x->x_loadclock = clock_new(x, (t_method)sfont_loadtick);
+    sfont_mutex_init(&x->x_mutex);
+    sfont_cond_init(&x->x_cond);
     x->x_canvas = canvas_getcurrent();
     x->x_sysex = x->x_ready = x->x_count = 0;
     x->x_data = x->x_channel = x->x_type = 0;
-    x->x_out_left = outlet_new(&x->x_obj, &s_signal);
-    x->x_out_right = outlet_new(&x->x_obj, &s_signal);
-    x->x_info_out = outlet_new((t_object *)x, gensym("list"));
     x->x_settings = new_fluid_settings();
     if(x->x_settings == NULL){
         pd_error(x, "[sfont~]: bug couldn't create synth settings\n");
         return(NULL);
     }
     x->x_ch = 16;
-    int arg = 0;
+    int arg = 0, poly = 0, cores = 1, npairs = 1;
     double g = 0.4;
     t_symbol *filename = NULL;
     while(ac){
@@ -623,6 +976,47 @@ static void *sfont_new(t_symbol *s, int ac, t_atom *av){
                 else
                     goto errstate;
             }
+            else if(sym == gensym("-poly") && !arg){
+                ac--, av++;
+                if(ac && av->a_type == A_FLOAT){
+                    poly = atom_getfloatarg(0, ac, av);
+                    poly = poly < 1 ? 1 : poly > 65535 ? 65535 : poly;
+                    ac--, av++;
+                }
+                else
+                    goto errstate;
+            }
+            else if(sym == gensym("-cores") && !arg){
+                ac--, av++;
+                if(ac && av->a_type == A_FLOAT){
+                    cores = atom_getfloatarg(0, ac, av);
+                    cores = cores < 1 ? 1 : cores > 256 ? 256 : cores;
+                    ac--, av++;
+                }
+                else
+                    goto errstate;
+            }
+            else if(sym == gensym("-out") && !arg){
+                ac--, av++;
+                if(ac && av->a_type == A_FLOAT){
+                    npairs = atom_getfloatarg(0, ac, av);
+                    ac--, av++;
+                }
+                else
+                    goto errstate;
+            }
+            else if(sym == gensym("-dyn") && !arg){
+                x->x_dynamic = 1;
+                ac--, av++;
+            }
+            else if(sym == gensym("-async") && !arg){
+                x->x_async = 1;
+                ac--, av++;
+            }
+            else if(sym == gensym("-ahead") && !arg){
+                x->x_ahead = 1;
+                ac--, av++;
+            }
             else if(!arg){
                 arg = 1;
                 filename = sym;
@@ -635,17 +1029,47 @@ static void *sfont_new(t_symbol *s, int ac, t_atom *av){
             goto errstate;
     }
     fluid_settings_setint(x->x_settings, "synth.ladspa.active", 0);
+    // with '-ahead' the render thread runs the synth while messages still
+    // come from Pd's thread, so keep FluidSynth's API locking on (its default)
+    fluid_settings_setint(x->x_settings, "synth.threadsafe-api", 1);
     fluid_settings_setint(x->x_settings, "synth.midi-channels", x->x_ch);
     fluid_settings_setnum(x->x_settings, "synth.gain", g);
     fluid_settings_setnum(x->x_settings, "synth.sample-rate", sys_getsr());
     fluid_settings_setnum(x->x_settings, "synth.sample-rate", sys_getsr());
-//  fluid_settings_setint(x->x_settings, "synth.polyphony", 256);
+    x->x_npairs = npairs < 1 ? 1 : npairs > x->x_ch ? x->x_ch : npairs > 128 ? 128 : npairs;
+    fluid_settings_setint(x->x_settings, "synth.audio-groups", x->x_npairs);
+    fluid_settings_setint(x->x_settings, "synth.audio-channels", x->x_npairs);
+#if FLUIDSYNTH_VERSION_MAJOR > 2 || (FLUIDSYNTH_VERSION_MAJOR == 2 && FLUIDSYNTH_VERSION_MINOR >= 2)
+    fluid_settings_setint(x->x_settings, "synth.effects-groups", x->x_npairs);
+#endif
+    fluid_settings_setint(x->x_settings, "synth.cpu-cores", cores);
+    fluid_settings_setint(x->x_settings, "synth.dynamic-sample-loading", x->x_dynamic);
+    if(poly)
+        fluid_settings_setint(x->x_settings, "synth.polyphony", poly);
 //    fluid_settings_setstr(x->x_settings, "synth.midi-bank-select", "gs");
     x->x_synth = new_fluid_synth(x->x_settings); // Create fluidsynth instance:
     if(x->x_synth == NULL){
         pd_error(x, "[sfont~]: bug couldn't create fluidsynth instance");
         return(NULL);
     }
+    fluid_settings_getint(x->x_settings, "synth.device-id", &x->x_devid);
+#if FLUIDSYNTH_VERSION_MAJOR > 2 || (FLUIDSYNTH_VERSION_MAJOR == 2 && FLUIDSYNTH_VERSION_MINOR >= 2)
+    int nfxgroups = fluid_synth_count_effects_groups(x->x_synth);
+#else
+    int nfxgroups = 1;
+#endif
+    x->x_nfxchan = fluid_synth_count_effects_channels(x->x_synth);
+    x->x_nfx = 2 * x->x_nfxchan * nfxgroups;
+    x->x_fx = (float **)getbytes(x->x_nfx * sizeof(*x->x_fx));
+    x->x_outs = (t_sample **)getbytes(2 * x->x_npairs * sizeof(*x->x_outs));
+    x->x_bufs = (t_sample **)getbytes(2 * x->x_npairs * sizeof(*x->x_bufs));
+    for(int j = 0; j < 2 * x->x_npairs; j++)
+        outlet_new(&x->x_obj, &s_signal);
+    x->x_info_out = outlet_new((t_object *)x, gensym("list"));
+    if(x->x_ahead && sfont_thread_create(&x->x_renderthread, sfont_renderthread, x)){
+        pd_error(x, "[sfont~]: couldn't start render thread, rendering in place");
+        x->x_ahead = 0;
+    }
     if(filename)
         fluid_do_load(x, filename);
     return(x);
@@ -671,6 +1095,7 @@ void sfont_tilde_setup(void){
     class_addmethod(sfont_class, (t_method)sfont_pitch_bend, gensym("bend"), A_GIMME, 0);
     class_addmethod(sfont_class, (t_method)sfont_sysex, gensym("sysex"), A_GIMME, 0);
     class_addmethod(sfont_class, (t_method)sfont_panic, gensym("panic"), 0);
+    class_addmethod(sfont_class, (t_method)sfont_poly, gensym("poly"), A_FLOAT, 0);
     class_addmethod(sfont_class, (t_method)sfont_transp, gensym("transp"), A_GIMME, 0);
     class_addmethod(sfont_class, (t_method)sfont_pan, gensym("pan"), A_GIMME, 0);
     class_addmethod(sfont_class, (t_method)sfont_scale, gensym("scale"), A_GIMME, 0);
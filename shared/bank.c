@@ -0,0 +1,163 @@
+// per band parameters for the compiled bank objects
+
+#include <m_pd.h>
+#include <string.h>
+#include "bank.h"
+
+void bank_init(t_bank *b, int n, t_float ramp){
+    b->b_n = n < 1 ? 1 : n;
+    b->b_ramp = (t_float *)getbytes(b->b_n * sizeof(t_float));
+    b->b_tmp = (t_float *)getbytes(b->b_n * sizeof(t_float));
+    b->b_sr = sys_getsr();
+    bank_rampall(b, ramp);
+}
+
+void bank_free(t_bank *b){
+    freebytes(b->b_ramp, b->b_n * sizeof(t_float));
+    freebytes(b->b_tmp, b->b_n * sizeof(t_float));
+}
+
+int bank_read(t_bank *b, void *owner, int ac, t_atom *av){
+    return(bank_getlist(owner, ac, av, b->b_tmp, b->b_n));
+}
+
+void bank_apply(t_bank *b, t_bank_param *p, int n, int jump){
+    t_float ms2samps = b->b_sr * 0.001;
+    for(int i = 0; i < n; i++)
+        bank_param_set(p, i, b->b_tmp[i], jump ? 0 : (int)(b->b_ramp[i] * ms2samps));
+}
+
+void bank_set(t_bank *b, void *owner, t_bank_param *p, int ac, t_atom *av, int jump){
+    bank_apply(b, p, bank_read(b, owner, ac, av), jump);
+}
+
+void bank_ramp(t_bank *b, void *owner, int ac, t_atom *av){
+    int n = bank_read(b, owner, ac, av);
+    for(int i = 0; i < n; i++)
+        b->b_ramp[i] = b->b_tmp[i] < 0 ? 0 : b->b_tmp[i];
+}
+
+void bank_rampall(t_bank *b, t_float ms){
+    for(int i = 0; i < b->b_n; i++)
+        b->b_ramp[i] = ms < 0 ? 0 : ms;
+}
+
+void bank_param_init(t_bank_param *p, int n, t_float f){
+    p->p_val = (t_float *)getbytes(n * sizeof(t_float));
+    p->p_target = (t_float *)getbytes(n * sizeof(t_float));
+    p->p_inc = (t_float *)getbytes(n * sizeof(t_float));
+    p->p_left = (int *)getbytes(n * sizeof(int));
+    for(int i = 0; i < n; i++){
+        p->p_val[i] = p->p_target[i] = f;
+        p->p_inc[i] = 0;
+        p->p_left[i] = 0;
+    }
+    p->p_ramping = 0;
+}
+
+void bank_param_free(t_bank_param *p, int n){
+    if(p->p_val){
+        freebytes(p->p_val, n * sizeof(t_float));
+        freebytes(p->p_target, n * sizeof(t_float));
+        freebytes(p->p_inc, n * sizeof(t_float));
+        freebytes(p->p_left, n * sizeof(int));
+    }
+    p->p_val = p->p_target = p->p_inc = NULL;
+    p->p_left = NULL;
+}
+
+void bank_param_set(t_bank_param *p, int i, t_float f, int ramp){
+    p->p_target[i] = f;
+    if(ramp > 0){
+        p->p_inc[i] = (f - p->p_val[i]) / ramp;
+        p->p_left[i] = ramp;
+        p->p_ramping = 1;
+    }
+    else{
+        p->p_val[i] = f;
+        p->p_left[i] = 0;
+    }
+}
+
+int bank_param_advance(t_bank_param *p, int n, int step){
+    if(!p->p_ramping)
+        return(0);
+    t_float *val = p->p_val, *target = p->p_target, *inc = p->p_inc;
+    int *left = p->p_left, ramping = 0;
+    for(int i = 0; i < n; i++){ // no branches, so it can be vectorized
+        int done = left[i] <= step;
+        val[i] = done ? target[i] : val[i] + inc[i] * step;
+        left[i] = done ? 0 : left[i] - step;
+        ramping += !done;
+    }
+    return(p->p_ramping = ramping);
+}
+
+static t_word *bank_getarray(void *owner, t_symbol *s, int *size){
+    t_garray *a = (t_garray *)pd_findbyclass(s, garray_class);
+    t_word *vec;
+    if(!a){
+        pd_error(owner, "[%s]: no array named '%s'", class_getname(*(t_pd *)owner), s->s_name);
+        return(NULL);
+    }
+    if(!garray_getfloatwords(a, size, &vec)){
+        pd_error(owner, "[%s]: bad template for array '%s'", class_getname(*(t_pd *)owner), s->s_name);
+        return(NULL);
+    }
+    return(vec);
+}
+
+int bank_getlist(void *owner, int ac, t_atom *av, t_float *vec, int n){
+    if(ac && av->a_type == A_SYMBOL){
+        int size;
+        t_word *w = bank_getarray(owner, atom_getsymbol(av), &size);
+        if(!w)
+            return(0);
+        if(size > n)
+            size = n;
+        for(int i = 0; i < size; i++)
+            vec[i] = w[i].w_float;
+        return(size);
+    }
+    if(ac > n)
+        ac = n;
+    for(int i = 0; i < ac; i++)
+        vec[i] = atom_getfloat(av + i);
+    return(ac);
+}
+
+int bank_listsize(void *owner, int ac, t_atom *av){
+    if(ac && av->a_type == A_SYMBOL){
+        int size;
+        return(bank_getarray(owner, atom_getsymbol(av), &size) ? size : 0);
+    }
+    return(ac);
+}
+
+int bank_getflags(void *owner, int *ac, t_atom **av, t_bank_flag *flags, int nflags){
+    int n = 0;
+    for(int i = 0; i < nflags; i++)
+        flags[i].f_ac = 0;
+    while(*ac && (*av)->a_type == A_SYMBOL){
+        const char *name = atom_getsymbol(*av)->s_name;
+        t_bank_flag *f = NULL;
+        for(int i = 0; i < nflags; i++)
+            if(!strcmp(name, flags[i].f_name))
+                f = &flags[i];
+        if(!f)
+            break;
+        (*ac)--, (*av)++;
+        f->f_av = *av;
+        if(*ac && (*av)->a_type == A_SYMBOL && atom_getsymbol(*av)->s_name[0] != '-')
+            f->f_ac = 1; // array name
+        else for(f->f_ac = 0; f->f_ac < *ac && (*av)[f->f_ac].a_type == A_FLOAT; )
+            f->f_ac++;
+        *ac -= f->f_ac, *av += f->f_ac;
+        if(f->f_size){
+            int size = bank_listsize(owner, f->f_ac, f->f_av);
+            if(size > n)
+                n = size;
+        }
+    }
+    return(n);
+}
@@ -0,0 +1,61 @@
+// per band parameters for the compiled bank objects ([oscbank~] and co.),
+// kept as arrays (one value per band) so a whole bank is updated in one loop
+
+#ifndef __BANK_H__
+#define __BANK_H__
+
+// what all banks have: the number of bands and a ramp time for each one
+typedef struct _bank{
+    int      b_n;           // number of bands
+    t_float *b_ramp;        // ramp time in ms
+    t_float *b_tmp;         // incoming lists
+    t_float  b_sr;
+}t_bank;
+
+// a parameter with a linear ramp for each band
+typedef struct _bank_param{
+    t_float *p_val;         // current values
+    t_float *p_target;      // values being ramped to
+    t_float *p_inc;         // increment per sample
+    int     *p_left;        // samples left in the ramp
+    int      p_ramping;     // number of bands still ramping
+}t_bank_param;
+
+void bank_param_init(t_bank_param *p, int n, t_float f);
+void bank_param_free(t_bank_param *p, int n);
+// set band 'i' to 'f' over 'ramp' samples (0 jumps there)
+void bank_param_set(t_bank_param *p, int i, t_float f, int ramp);
+// move all ramps 'step' samples ahead, returns if anything is still ramping
+int bank_param_advance(t_bank_param *p, int n, int step);
+
+void bank_init(t_bank *b, int n, t_float ramp);
+void bank_free(t_bank *b);
+// read a list or array into b_tmp, returns how many values were read
+int bank_read(t_bank *b, void *owner, int ac, t_atom *av);
+// set the first 'n' bands of 'p' from b_tmp, ramping over each band's
+// ramp time (or jumping if 'jump' is set)
+void bank_apply(t_bank *b, t_bank_param *p, int n, int jump);
+// bank_read() followed by bank_apply()
+void bank_set(t_bank *b, void *owner, t_bank_param *p, int ac, t_atom *av, int jump);
+void bank_ramp(t_bank *b, void *owner, int ac, t_atom *av);
+void bank_rampall(t_bank *b, t_float ms);
+
+// copy values for up to 'n' bands from a list of floats or from an array
+// whose name is the first atom, returns how many values were copied
+int bank_getlist(void *owner, int ac, t_atom *av, t_float *vec, int n);
+// number of values a list or array would give (used to size a bank from flags)
+int bank_listsize(void *owner, int ac, t_atom *av);
+
+// creation flags followed by a list of floats or an array name
+typedef struct _bank_flag{
+    const char *f_name;     // the flag, like "-amp"
+    int         f_size;     // if the list length sets the number of bands
+    int         f_ac;       // the list, f_ac is 0 if the flag wasn't given
+    t_atom     *f_av;
+}t_bank_flag;
+
+// consume the flags at the start of ac/av, returns the number of bands set
+// by them (0 if none), unknown flags are left for the caller
+int bank_getflags(void *owner, int *ac, t_atom **av, t_bank_flag *flags, int nflags);
+
+#endif
@@ -0,0 +1,52 @@
+// minimum phase band limited tables and table BLEP corrector
+
+#include <m_pd.h>
+#include <string.h>
+#include "blep.h"
+#include "blep_tables.h"
+
+void blep_clear(t_blep *x){
+    memset(x->b_ring, 0, sizeof(x->b_ring));
+    x->b_pos = 0;
+}
+
+void blep_step(t_blep *x, t_float offset, t_float height){
+    // the step residual (band limited minus ideal step) is -height * bls,
+    // read at 'offset' samples into the table and every sample after that
+    t_float pos = offset * BLEP_S;
+    int index = (int)pos;
+    t_float frac = pos - index;
+    if(index < 0)
+        index = 0, frac = 0;
+    for(int i = 0; i < BLEP_L; i++, index += BLEP_S){
+        if(index + 1 >= BLEP_N)
+            break;
+        t_float bls = blep_bls[index] + frac * (blep_bls[index+1] - blep_bls[index]);
+        x->b_ring[(x->b_pos + i) & (BLEP_L-1)] -= height * bls;
+    }
+}
+
+void blep_add(t_blep *x, t_float *out, int n){
+    int len = n < BLEP_L ? n : BLEP_L;
+    for(int i = 0; i < len; i++){
+        int j = (x->b_pos + i) & (BLEP_L-1);
+        out[i] += x->b_ring[j];
+        x->b_ring[j] = 0;
+    }
+    x->b_pos = (x->b_pos + len) & (BLEP_L-1);
+}
+
+void blep_step_block(t_blep *x, t_float *out, int n, int i, t_float offset, t_float height){
+    t_float pos = offset * BLEP_S;
+    int index = (int)pos;
+    t_float frac = pos - index;
+    if(index < 0)
+        index = 0, frac = 0;
+    for(int j = i; index + 1 < BLEP_N && j < i + BLEP_L; j++, index += BLEP_S){
+        t_float bls = blep_bls[index] + frac * (blep_bls[index+1] - blep_bls[index]);
+        if(j < n)
+            out[j] -= height * bls;
+        else // next block
+            x->b_ring[(x->b_pos + j - n) & (BLEP_L-1)] -= height * bls;
+    }
+}
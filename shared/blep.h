@@ -0,0 +1,45 @@
+// minimum phase band limited impulse/step tables and a table BLEP
+// corrector shared by the bl.* oscillators
+
+#ifndef __BLEP_H__
+#define __BLEP_H__
+
+// table sizes, keep in sync with tools/blep_tables.c
+#define BLEP_LLENGTH     6 // the loglength of a fractional delayed basic waveform
+#define BLEP_LOVERSAMPLE 6 // the log of the oversampling factor (nb of fract delayed waveforms)
+#define BLEP_LTABLE      (BLEP_LLENGTH+BLEP_LOVERSAMPLE)
+#define BLEP_N           (1<<BLEP_LTABLE)
+#define BLEP_S           (1<<BLEP_LOVERSAMPLE)
+#define BLEP_L           (1<<BLEP_LLENGTH)
+
+// precomputed tables (generated into blep_tables.h)
+extern const float blep_bli[BLEP_N]; // band limited impulse (scaled by BLEP_S)
+extern const float blep_bls[BLEP_N]; // band limited step (1 -> 0)
+extern const float blep_delay;       // group delay at DC (in samples)
+
+// table BLEP corrector: a ring of the pending corrections for the next
+// BLEP_L samples, discontinuities are added as they happen and
+// blep_next() is summed into the naive waveform
+typedef struct _blep{
+    t_float b_ring[BLEP_L];
+    int     b_pos;
+}t_blep;
+
+void blep_clear(t_blep *x);
+// add a step of 'height' that happened 'offset' (0-1) samples before the next output sample
+void blep_step(t_blep *x, t_float offset, t_float height);
+// block versions: blep_add() mixes the pending corrections into a block of
+// n samples (call it before any blep_step_block() for that block), then
+// blep_step_block() adds a step that happened 'offset' samples before
+// sample 'i', spilling what doesn't fit the block over into the ring
+void blep_add(t_blep *x, t_float *out, int n);
+void blep_step_block(t_blep *x, t_float *out, int n, int i, t_float offset, t_float height);
+// get (and consume) the correction for the current output sample
+static inline t_float blep_next(t_blep *x){
+    t_float y = x->b_ring[x->b_pos];
+    x->b_ring[x->b_pos] = 0;
+    x->b_pos = (x->b_pos + 1) & (BLEP_L-1);
+    return(y);
+}
+
+#endif
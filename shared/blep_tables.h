@@ -0,0 +1,1378 @@
+// generated by tools/blep_tables.c, do not edit
+
+// band limited impulse (scaled by BLEP_S)
+const float blep_bli[BLEP_N] = {
+    -0.00152974142, -0.00135177143, -0.00116213081, -0.000959180619, -0.000750232724, -0.000529865291,
+    -0.000282744922, -1.35331643e-05, 0.000274728772, 0.000580073433, 0.000903120982, 0.00124822014,
+    0.00161877064, 0.00201213713, 0.00243061168, 0.00287493584, 0.00334964205, 0.00385651027,
+    0.00439127082, 0.00495976188, 0.00556116899, 0.0062082495, 0.00690595925, 0.00763756535,
+    0.00840738652, 0.00921800647, 0.0100761129, 0.0109879857, 0.0119307818, 0.0129063476,
+    0.0139242378, 0.0149892357, 0.0161097177, 0.0172994713, 0.0185460883, 0.0198433819,
+    0.0211988162, 0.0226163485, 0.0241133339, 0.0256882418, 0.0273296001, 0.0290408298,
+    0.030822589, 0.0326854027, 0.0346349957, 0.0366657003, 0.0387819945, 0.0409845667,
+    0.043278413, 0.0456610717, 0.048113304, 0.050646076, 0.0532683395, 0.0559834237,
+    0.0587966575, 0.0617189726, 0.0647410474, 0.0678623455, 0.0710883156, 0.0744226742,
+    0.0778748321, 0.0814341442, 0.0850992284, 0.0888787569, 0.0927727779, 0.0967867674,
+    0.100912845, 0.105145571, 0.109493493, 0.113960035, 0.118551729, 0.123264911,
+    0.12808343, 0.133012301, 0.138058378, 0.143223372, 0.14851386, 0.153937273,
+    0.15948659, 0.165160369, 0.170960632, 0.176887368, 0.182940826, 0.189103501,
+    0.195378819, 0.201772232, 0.208283165, 0.21491122, 0.221644555, 0.228484056,
+    0.235433717, 0.242491886, 0.249659746, 0.256930543, 0.264294075, 0.271753876,
+    0.279310129, 0.286958817, 0.294700525, 0.302533244, 0.310453187, 0.318460802,
+    0.326549362, 0.334716387, 0.342949484, 0.351228938, 0.359564725, 0.367959731,
+    0.376406564, 0.384899706, 0.39342454, 0.401981438, 0.410569576, 0.419185283,
+    0.427823907, 0.436478722, 0.445141137, 0.45380628, 0.462471281, 0.471129037,
+    0.479771755, 0.488388326, 0.496978607, 0.505539788, 0.514061485, 0.522539247,
+    0.530955625, 0.539293721, 0.547559607, 0.55574694, 0.563848014, 0.571853551,
+    0.579756078, 0.587560706, 0.595258614, 0.602838325, 0.610291099, 0.617608738,
+    0.624785344, 0.631817777, 0.638699098, 0.645416829, 0.651959773, 0.658312955,
+    0.664480356, 0.670460388, 0.67624304, 0.681821832, 0.687178884, 0.69230518,
+    0.697202812, 0.701862972, 0.706280521, 0.710446225, 0.714357561, 0.71802124,
+    0.721425048, 0.724557179, 0.727412509, 0.729983884, 0.7322651, 0.734254941,
+    0.735947452, 0.737333335, 0.73840532, 0.73915176, 0.739580823, 0.739690358,
+    0.73947074, 0.738919032, 0.738030069, 0.736807452, 0.735246854, 0.733341823,
+    0.731087647, 0.728478269, 0.725522332, 0.722230514, 0.718592784, 0.714604911,
+    0.710264842, 0.705566983, 0.700511637, 0.695101938, 0.689335889, 0.683215478,
+    0.676738793, 0.669905552, 0.662729919, 0.655209258, 0.64734174, 0.639133545,
+    0.630588608, 0.621720326, 0.612526791, 0.603006348, 0.593162662, 0.58299996,
+    0.572530749, 0.561766399, 0.550708639, 0.53935957, 0.527725938, 0.515812522,
+    0.50362587, 0.491171526, 0.478455541, 0.465487725, 0.45227434, 0.438830904,
+    0.425173673, 0.411301583, 0.397222602, 0.382947197, 0.368490589, 0.353873075,
+    0.339092959, 0.324157105, 0.309077781, 0.293863723, 0.278527923, 0.263083725,
+    0.247540075, 0.231907566, 0.216201623, 0.200433136, 0.184613986, 0.168748915,
+    0.152847795, 0.136926882, 0.12099975, 0.105089693, 0.0892133264, 0.0733728881,
+    0.057580162, 0.041847494, 0.0261932533, 0.0106323565, -0.00483408715, -0.0201912348,
+    -0.0354245176, -0.0505222938, -0.0654739277, -0.0802692089, -0.0948958465, -0.109341621,
+    -0.123591382, -0.13762867, -0.151440484, -0.165026284, -0.178373568, -0.191466936,
+    -0.20429836, -0.216844803, -0.229099545, -0.241060076, -0.25271167, -0.264042281,
+    -0.275041323, -0.285703497, -0.296030359, -0.306009346, -0.31562761, -0.32487763,
+    -0.333754451, -0.342252801, -0.350365533, -0.358084192, -0.365397935, -0.372296855,
+    -0.378773603, -0.384833522, -0.390472506, -0.395684209, -0.400464218, -0.404805173,
+    -0.408711244, -0.412174558, -0.41519048, -0.41775944, -0.419877191, -0.421553674,
+    -0.422796773, -0.423597427, -0.423953083, -0.423865803, -0.423335028, -0.422367148,
+    -0.420963121, -0.419120804, -0.416844664, -0.414135722, -0.410994144, -0.407435698,
+    -0.40346178, -0.39907329, -0.394278323, -0.38908877, -0.3835157, -0.377558168,
+    -0.371222097, -0.364513613, -0.357440882, -0.350025828, -0.34227627, -0.334195084,
+    -0.325790959, -0.317074179, -0.308053548, -0.298743009, -0.289149008, -0.279281174,
+    -0.269154621, -0.258775691, -0.248160732, -0.237327469, -0.226281092, -0.215034202,
+    -0.203603609, -0.192008234, -0.180267836, -0.168383942, -0.156367943, -0.14423489,
+    -0.131999126, -0.119677004, -0.107282153, -0.0948286776, -0.0823290717, -0.0697996829,
+    -0.0572548473, -0.0447060545, -0.0321608827, -0.0196346464, -0.00714534249, 0.00529327965,
+    0.0176590741, 0.0299415008, 0.0421332459, 0.0542176391, 0.0661793569, 0.0779947452,
+    0.0896495275, 0.101145368, 0.112467804, 0.123601967, 0.134537318, 0.145262245,
+    0.155766443, 0.166037872, 0.176064165, 0.185831654, 0.195328499, 0.204545514,
+    0.213480733, 0.222123147, 0.230460877, 0.238485445, 0.246179358, 0.253539406,
+    0.260560274, 0.267230821, 0.273545557, 0.279495031, 0.285077649, 0.290294401,
+    0.295135705, 0.299593189, 0.303665994, 0.307357415, 0.310668119, 0.313590494,
+    0.316118667, 0.31824662, 0.319969628, 0.3212911, 0.322220475, 0.322754893,
+    0.322891392, 0.322628696, 0.321963056, 0.320905924, 0.319456913, 0.317618059,
+    0.315393724, 0.312784924, 0.309804097, 0.306458759, 0.302747625, 0.298674907,
+    0.294249417, 0.28948139, 0.284380702, 0.278949936, 0.273194754, 0.267125563,
+    0.26074479, 0.254060051, 0.247085752, 0.239827518, 0.232294949, 0.224502026,
+    0.216463345, 0.208194304, 0.199694389, 0.190972918, 0.182042004, 0.172916774,
+    0.163619921, 0.154162408, 0.144551255, 0.134797304, 0.124914389, 0.114918336,
+    0.10482315, 0.0946370422, 0.0843706283, 0.0740385363, 0.0636487183, 0.0532187954,
+    0.042765337, 0.03229837, 0.0218317733, 0.0113805114, 0.000964570343, -0.00940190108,
+    -0.0197161731, -0.0299632269, -0.0401288693, -0.0501983943, -0.0601550237, -0.0699934875,
+    -0.0797017429, -0.0892662208, -0.0986743961, -0.107915517, -0.116978985, -0.125860974,
+    -0.134548478, -0.143025581, -0.151285205, -0.159314105, -0.167106361, -0.174657492,
+    -0.181955207, -0.188986748, -0.195733681, -0.202190718, -0.208360413, -0.214235192,
+    -0.219807314, -0.22507015, -0.230018183, -0.234649817, -0.238956042, -0.242931409,
+    -0.246570948, -0.249871252, -0.252831705, -0.255454795, -0.257735151, -0.259668274,
+    -0.261251963, -0.262481652, -0.263364715, -0.26389906, -0.264081997, -0.263915559,
+    -0.263391313, -0.262517912, -0.26130541, -0.259750198, -0.257851994, -0.255622362,
+    -0.253069363, -0.250197695, -0.247009494, -0.243507581, -0.239694929, -0.235579758,
+    -0.231171387, -0.226478378, -0.221504697, -0.216255032, -0.210733867, -0.204952763,
+    -0.198927765, -0.192659379, -0.186156087, -0.179426634, -0.172473013, -0.165314873,
+    -0.157963972, -0.150425513, -0.14271053, -0.134833303, -0.12681096, -0.118655857,
+    -0.110371765, -0.101967176, -0.0934558655, -0.0848410579, -0.0761378988, -0.0673636974,
+    -0.0585262348, -0.0496386839, -0.0407163855, -0.0317667851, -0.0228044752, -0.0138355162,
+    -0.00487095316, 0.0040742811, 0.0129750921, 0.0218173449, 0.0305994781, 0.0393113439,
+    0.0479435974, 0.0564850732, 0.0649121079, 0.0732138694, 0.081387737, 0.0894228077,
+    0.097307675, 0.105039511, 0.112602809, 0.119987904, 0.127187915, 0.134191893,
+    0.140992572, 0.147575128, 0.15392937, 0.160055976, 0.165944005, 0.171583265,
+    0.176967017, 0.182087888, 0.186945275, 0.191532637, 0.19584173, 0.199864301,
+    0.203595715, 0.207035454, 0.210183686, 0.213035507, 0.215583005, 0.217827389,
+    0.219765971, 0.221401662, 0.22273343, 0.223757452, 0.224468041, 0.224854074,
+    0.224923346, 0.224684962, 0.224137886, 0.223282068, 0.222117424, 0.220645977,
+    0.218875783, 0.216806038, 0.214441117, 0.211786383, 0.208848196, 0.205632533,
+    0.202146802, 0.198391173, 0.194371774, 0.190096174, 0.185573302, 0.180816696,
+    0.175829749, 0.170615573, 0.165181675, 0.159526136, 0.15366509, 0.147611531,
+    0.141369979, 0.134948167, 0.128361018, 0.12162335, 0.114744377, 0.107729687,
+    0.100586354, 0.0933244348, 0.0859569146, 0.078498342, 0.0709588073, 0.0633466939,
+    0.0556698688, 0.0479354325, 0.0401576936, 0.0323535588, 0.0245256676, 0.0166868051,
+    0.00884751523, 0.00101266388, -0.00679813973, -0.0145765441, -0.0223169633, -0.0300065935,
+    -0.0376290832, -0.0451686021, -0.0526153847, -0.0599654198, -0.0672120961, -0.0743413326,
+    -0.0813448113, -0.0882119482, -0.0949334211, -0.101502133, -0.10791038, -0.114150999,
+    -0.120212494, -0.126085348, -0.131767984, -0.137251015, -0.142526025, -0.147582307,
+    -0.152411421, -0.157015211, -0.161387111, -0.165521491, -0.169410055, -0.173038062,
+    -0.176404994, -0.179513795, -0.182357713, -0.184931376, -0.187239435, -0.189276742,
+    -0.191042689, -0.192538667, -0.193759925, -0.194704963, -0.195368018, -0.195751013,
+    -0.195860622, -0.1956956, -0.195252736, -0.194527946, -0.193525377, -0.192253959,
+    -0.190714111, -0.188908876, -0.186838859, -0.184503017, -0.18190965, -0.179065751,
+    -0.175972627, -0.172635954, -0.169067871, -0.16527299, -0.161260428, -0.157034002,
+    -0.152596012, -0.147952692, -0.1431061, -0.138069758, -0.13285507, -0.127465554,
+    -0.12190543, -0.11617996, -0.110304116, -0.104291562, -0.0981471135, -0.091878539,
+    -0.0854955677, -0.0790070411, -0.072425695, -0.0657619403, -0.059022889, -0.0522173463,
+    -0.0453569602, -0.0384542342, -0.0315244642, -0.0245721729, -0.0176064245, -0.0106350546,
+    -0.00366096042, 0.00329831936, 0.0102329037, 0.0171366383, 0.0239992239, 0.0308102717,
+    0.0375541524, 0.0442211558, 0.0508079127, 0.0573069095, 0.0637033971, 0.0699858913,
+    0.0761453945, 0.0821758775, 0.0880726434, 0.0938285806, 0.0994359356, 0.104880825,
+    0.110153341, 0.115253093, 0.120173685, 0.12490998, 0.129460105, 0.133810735,
+    0.137959553, 0.141902226, 0.145634341, 0.149146146, 0.152427396, 0.155477798,
+    0.158297763, 0.160881842, 0.163223179, 0.165318683, 0.167166458, 0.168768201,
+    0.170124518, 0.171233456, 0.172096593, 0.172706015, 0.173061072, 0.173168454,
+    0.173025172, 0.172631722, 0.171989925, 0.171100269, 0.16997145, 0.168606574,
+    0.167004325, 0.165160328, 0.163072981, 0.160751417, 0.158203417, 0.155433461,
+    0.152443712, 0.149240454, 0.145828978, 0.142216019, 0.138406372, 0.134406331,
+    0.130225966, 0.125867068, 0.121340636, 0.116655424, 0.111812888, 0.106818157,
+    0.101675049, 0.0963963295, 0.0909974866, 0.0854826712, 0.0798574319, 0.0741272269,
+    0.0682962971, 0.0623785238, 0.0563854591, 0.0503220971, 0.0441963485, 0.0380231598,
+    0.0318121767, 0.0255762083, 0.0193227706, 0.0130585649, 0.00679326986, 0.000531896679,
+    -0.0057124826, -0.0119287523, -0.018110111, -0.0242529969, -0.0303517721, -0.0363876739,
+    -0.0423512789, -0.048238264, -0.0540386681, -0.059744876, -0.0653497285, -0.0708413057,
+    -0.0762158068, -0.0814686265, -0.0865870725, -0.0915609474, -0.0963801872, -0.101035295,
+    -0.105528151, -0.109855201, -0.114009316, -0.117988603, -0.121780492, -0.125381312,
+    -0.128790497, -0.132006861, -0.135026374, -0.137837882, -0.140438279, -0.142828662,
+    -0.145005891, -0.146962539, -0.148694381, -0.150201433, -0.151483343, -0.152541938,
+    -0.153377283, -0.153987597, -0.154365703, -0.154512738, -0.15443233, -0.154122566,
+    -0.15358932, -0.152835205, -0.151857657, -0.150665779, -0.149261543, -0.147644575,
+    -0.145817295, -0.143776808, -0.141530742, -0.139087363, -0.136447869, -0.133606571,
+    -0.130568872, -0.127343658, -0.123940553, -0.120367208, -0.116629566, -0.112731946,
+    -0.108673753, -0.10446311, -0.100111328, -0.0956231392, -0.0910076523, -0.0862706415,
+    -0.0814197481, -0.0764672712, -0.0714187419, -0.0662806811, -0.0610558317, -0.055748225,
+    -0.0503713658, -0.0449347581, -0.0394439762, -0.0339053439, -0.0283286503, -0.0227249474,
+    -0.0171049373, -0.0114742038, -0.0058403602, -0.000216549551, 0.00539351441, 0.0109777116,
+    0.0165267819, 0.0220383219, 0.0275061279, 0.0329235395, 0.0382755836, 0.043549153,
+    0.0487399226, 0.0538450612, 0.0588625483, 0.0637851763, 0.0686003302, 0.0733008119,
+    0.0778830862, 0.0823415747, 0.0866689391, 0.0908563889, 0.0948968393, 0.0987868736,
+    0.102520218, 0.106087461, 0.109488275, 0.112714924, 0.115764641, 0.118635459,
+    0.121328073, 0.123840332, 0.126158418, 0.128280998, 0.130210914, 0.131944787,
+    0.13348151, 0.134819314, 0.135953525, 0.136887069, 0.137621695, 0.138151961,
+    0.138475018, 0.13858793, 0.138489361, 0.138187182, 0.13768153, 0.136970772,
+    0.136056814, 0.134937211, 0.13361657, 0.132103249, 0.130405025, 0.128524591,
+    0.12645674, 0.124207471, 0.121781073, 0.119180375, 0.116407137, 0.113464062,
+    0.110359163, 0.107101441, 0.103696119, 0.100144962, 0.096452155, 0.092618689,
+    0.088653203, 0.0845659105, 0.0803607448, 0.0760470876, 0.0716312231, 0.0671194633,
+    0.0625253913, 0.0578543974, 0.053112998, 0.0483076124, 0.0434399341, 0.0385213227,
+    0.0335630745, 0.0285691754, 0.0235388702, 0.018479263, 0.0134042119, 0.00832340465,
+    0.00324525468, -0.00182374407, -0.00687621693, -0.0119114956, -0.0169183013, -0.0218872138,
+    -0.0268127611, -0.0316855708, -0.036499703, -0.0412466344, -0.0459154864, -0.0505026936,
+    -0.0550024124, -0.0594112054, -0.0637235275, -0.0679277038, -0.0720179837, -0.0759944486,
+    -0.0798566208, -0.0835966624, -0.0872035094, -0.0906698307, -0.0939921526, -0.0971657149,
+    -0.100184629, -0.103048198, -0.105749356, -0.108285444, -0.110655988, -0.112855541,
+    -0.11488423, -0.116731696, -0.11839362, -0.119872716, -0.121170427, -0.122286667,
+    -0.123219942, -0.123965062, -0.124521941, -0.124894446, -0.125085535, -0.125091754,
+    -0.124911014, -0.12454542, -0.123998496, -0.123266187, -0.122348094, -0.121246586,
+    -0.119961034, -0.118497823, -0.116864331, -0.115064808, -0.113103746, -0.110973399,
+    -0.108678232, -0.10622641, -0.103624333, -0.100876125, -0.0979832243, -0.0949501355,
+    -0.0917851217, -0.0884936276, -0.085079176, -0.0815474937, -0.0778995883, -0.0741405927,
+    -0.0702810081, -0.0663218279, -0.0622648093, -0.0581192977, -0.0538923182, -0.0495937207,
+    -0.0452313281, -0.0408152712, -0.0363494039, -0.0318341814, -0.0272823137, -0.0227030917,
+    -0.0181015332, -0.0134829161, -0.00885067631, -0.00421606055, 0.00040922321, 0.00501779706,
+    0.00961000349, 0.0141798427, 0.0187244371, 0.0232338815, 0.0276967943, 0.0321058566,
+    0.0364560882, 0.0407444105, 0.0449646164, 0.0491079769, 0.053168955, 0.0571342826,
+    0.0609992968, 0.0647629103, 0.0684150154, 0.0719523771, 0.075376549, 0.0786851771,
+    0.0818722085, 0.0849259774, 0.0878399154, 0.0906142295, 0.0932504125, 0.0957425435,
+    0.0980888818, 0.100281689, 0.102316254, 0.104195109, 0.105915676, 0.107477302,
+    0.108872976, 0.110095879, 0.111144275, 0.112018693, 0.112721674, 0.113252508,
+    0.113608727, 0.113790527, 0.113800607, 0.113645754, 0.11332494, 0.112832721,
+    0.11217147, 0.111344467, 0.110349939, 0.1091893, 0.107866788, 0.106382488,
+    0.104742581, 0.102950991, 0.101006736, 0.0989165761, 0.0966758077, 0.0942889579,
+    0.0917676367, 0.0891165641, 0.0863385064, 0.0834361047, 0.0804103695, 0.0772678742,
+    0.0740223633, 0.0706821837, 0.0672475573, 0.0637208747, 0.0601077473, 0.0564141622,
+    0.052642559, 0.0487976487, 0.0448851889, 0.0409122639, 0.0368888141, 0.0328204401,
+    0.0287130247, 0.024573121, 0.0203986611, 0.016200391, 0.0119887314, 0.00777161267,
+    0.00355485036, -0.000661390008, -0.0048695654, -0.00905980888, -0.0132254416, -0.017360356,
+    -0.0214570418, -0.0255138259, -0.0295227765, -0.0334739741, -0.0373698484, -0.0412080139,
+    -0.0449797154, -0.0486789737, -0.0522974812, -0.0558277202, -0.05926297, -0.0626014374,
+    -0.0658421333, -0.0689762672, -0.07199778, -0.0749009325, -0.0776857016, -0.0803507285,
+    -0.0828841038, -0.0852805936, -0.0875404519, -0.0896629314, -0.0916466834, -0.0934905592,
+    -0.0951865003, -0.0967307459, -0.0981281087, -0.0993770402, -0.100479777, -0.10143264,
+    -0.102229347, -0.102868236, -0.103344538, -0.103659222, -0.103815229, -0.103809915,
+    -0.103644397, -0.103323299, -0.102849354, -0.102222316, -0.101437657, -0.100496698,
+    -0.0994045912, -0.0981686433, -0.0967882062, -0.0952652429, -0.0936007694, -0.091797777,
+    -0.0898609735, -0.0877947704, -0.0856040666, -0.0832851871, -0.0808422241, -0.0782819237,
+    -0.0756046416, -0.0728167873, -0.0699212137, -0.0669186639, -0.0638164905, -0.0606266722,
+    -0.0573583054, -0.0540135754, -0.0505917252, -0.0470981443, -0.0435421979, -0.0399308215,
+    -0.0362672191, -0.0325568722, -0.0288049601, -0.025018431, -0.0212010835, -0.0173590787,
+    -0.0135017027, -0.00962860625, -0.00574866267, -0.00187162253, 0.00200033148, 0.00586202592,
+    0.00971132682, 0.0135417178, 0.0173431274, 0.0211040291, 0.0248178283, 0.0284819997,
+    0.0320947788, 0.0356494783, 0.0391370704, 0.0425566405, 0.0459063002, 0.0491810691,
+    0.0523741942, 0.0554782028, 0.0584891501, 0.0614031047, 0.0642170309, 0.0669333528,
+    0.0695439731, 0.0720422176, 0.0744228695, 0.0766840551, 0.0788276367, 0.0808474598,
+    0.0827381785, 0.0844953757, 0.0861162956, 0.0876013062, 0.0889488756, 0.0901537128,
+    0.0912143645, 0.0921377964, 0.092922736, 0.0935687519, 0.0940726336, 0.094430855,
+    0.094644856, 0.094714689, 0.0946415578, 0.0944279179, 0.0940696491, 0.0935657202,
+    0.0929166091, 0.0921285213, 0.0912059492, 0.0901438451, 0.0889433569, 0.0876091361,
+    0.0861444627, 0.0845503253, 0.0828298542, 0.0809831321, 0.0790142883, 0.0769342978,
+    0.0747479898, 0.0724591426, 0.0700670399, 0.0675718939, 0.0649790488, 0.0622905313,
+    0.0595138413, 0.0566530235, 0.0537109677, 0.0506908329, 0.0475982649, 0.0444420669,
+    0.0412263171, 0.0379488506, 0.034617691, 0.0312434602, 0.0278320932, 0.0243867634,
+    0.0209114542, 0.0174088779, 0.0138862979, 0.0103539412, 0.00681614411, 0.00328016018,
+    -0.000253345441, -0.00377801517, -0.00728787145, -0.0107813127, -0.0142531669, -0.0177009597,
+    -0.0211197749, -0.0245010236, -0.0278355304, -0.0311151171, -0.0343393198, -0.0375078154,
+    -0.0406140326, -0.0436469509, -0.0466011849, -0.0494760179, -0.0522696022, -0.0549768592,
+    -0.0575921826, -0.0601128063, -0.0625322853, -0.064845416, -0.0670557166, -0.0691571998,
+    -0.0711461995, -0.073024539, -0.074788542, -0.0764387115, -0.0779711109, -0.0793792984,
+    -0.0806575826, -0.081805377, -0.0828246643, -0.0837159392, -0.0844758641, -0.0850988068,
+    -0.0855880797, -0.0859472552, -0.0861754448, -0.0862697861, -0.0862304581, -0.0860616849,
+    -0.0857644404, -0.0853408337, -0.0847932607, -0.084116788, -0.0833110026, -0.0823786265,
+    -0.081325238, -0.0801594821, -0.0788783016, -0.0774811639, -0.075966772, -0.0743372869,
+    -0.0725971236, -0.0707492865, -0.0687942713, -0.0667365435, -0.0645841203, -0.0623404783,
+    -0.0600102519, -0.057593419, -0.0550919548, -0.0525160674, -0.0498675624, -0.0471502248,
+    -0.0443694015, -0.0415258365, -0.0386213815, -0.0356624666, -0.0326583627, -0.0296138058,
+    -0.0265281832, -0.0234053601, -0.0202513606, -0.0170729354, -0.0138737422, -0.010654675,
+    -0.00742117257, -0.00418091309, -0.000945591035, 0.00227859761, 0.00548687382, 0.00868134311,
+    0.011856886, 0.0150053297, 0.018124095, 0.0212059259, 0.0242471722, 0.0272460708,
+    0.0301993933, 0.033103134, 0.0359484659, 0.0387326681, 0.041456469, 0.0441126023,
+    0.0466917346, 0.0491917502, 0.0516118841, 0.0539498112, 0.0562038703, 0.0583671962,
+    0.0604315522, 0.0623958006, 0.0642570561, 0.0660153017, 0.0676676385, 0.069211269,
+    0.0706457117, 0.0719691883, 0.073184223, 0.0742862121, 0.0752730576, 0.0761428838,
+    0.0768914918, 0.0775228591, 0.0780404351, 0.0784379909, 0.0787086624, 0.078854186,
+    0.0788782519, 0.0787835729, 0.0785697678, 0.0782339992, 0.0777776282, 0.0772010753,
+    0.0765044275, 0.075692173, 0.0747629852, 0.0737192808, 0.0725667722, 0.0713079513,
+    0.0699489288, 0.0684887073, 0.0669263553, 0.0652628952, 0.0635023874, 0.0616504382,
+    0.0597098651, 0.0576814967, 0.0555618546, 0.0533569486, 0.0510755344, 0.0487210432,
+    0.0462943824, 0.0438012683, 0.0412492865, 0.0386389324, 0.0359752834, 0.0332617512,
+    0.0304992276, 0.0276951724, 0.0248566263, 0.0219908755, 0.0191064496, 0.0162005022,
+    0.0132736435, 0.010330539, 0.00737669145, 0.00441796253, 0.00145739643, -0.0015028137,
+    -0.00445888829, -0.00739987583, -0.0103196359, -0.0132144975, -0.0160848509, -0.0189259017,
+    -0.0217270417, -0.0244856036, -0.0271969743, -0.0298569614, -0.0324649664, -0.0350193332,
+    -0.0375158002, -0.0399456883, -0.042306228, -0.0445972867, -0.0468149939, -0.0489564553,
+    -0.0510178543, -0.0529977232, -0.0548971544, -0.0567126062, -0.0584373997, -0.0600659868,
+    -0.0615973007, -0.0630303796, -0.0643672718, -0.0656027012, -0.066729034, -0.0677472919,
+    -0.0686559797, -0.069457638, -0.0701538309, -0.0707440344, -0.071226121, -0.0715950919,
+    -0.0718533448, -0.0720037957, -0.0720449545, -0.0719732071, -0.0717895423, -0.071498228,
+    -0.0711030409, -0.0706028372, -0.0699938489, -0.069274908, -0.0684486122, -0.0675167161,
+    -0.0664847829, -0.0653523469, -0.0641181796, -0.0627864987, -0.0613600795, -0.0598439239,
+    -0.0582383923, -0.0565499716, -0.0547825974, -0.0529354528, -0.0510156071, -0.0490261517,
+    -0.0469637922, -0.0448274369, -0.0426249311, -0.0403639183, -0.0380502378, -0.0356847354,
+    -0.0332658308, -0.0307990863, -0.0282884382, -0.0257365169, -0.0231485521, -0.0205271598,
+    -0.017876444, -0.0152042571, -0.0125175514, -0.00982280834, -0.00711876681, -0.00440896482,
+    -0.0016960901, 0.00101398317, 0.00371249023, 0.0063960943, 0.00906506255, 0.0117200646,
+    0.0143552516, 0.0169616549, 0.0195359336, 0.0220761292, 0.0245782985, 0.0270345674,
+    0.0294445204, 0.0318037832, 0.0341108086, 0.0363625631, 0.0385501487, 0.0406704874,
+    0.0427196813, 0.0446929022, 0.0465931668, 0.0484200289, 0.0501660981, 0.0518269569,
+    0.0534021571, 0.0548928843, 0.0562988958, 0.0576220913, 0.0588544152, 0.0599912459,
+    0.0610346181, 0.061987208, 0.0628429047, 0.0635953996, 0.0642462996, 0.0647931653,
+    0.0652388406, 0.0655871107, 0.0658361462, 0.0659843407, 0.0660264639, 0.0659616428,
+    0.0657933759, 0.0655251298, 0.0651570109, 0.0646894617, 0.0641255782, 0.0634678238,
+    0.0627146457, 0.0618664456, 0.0609229775, 0.0598888938, 0.0587681385, 0.0575629391,
+    0.0562685916, 0.0548823758, 0.0534092273, 0.0518553105, 0.0502279119, 0.0485271639,
+    0.0467543825, 0.0449135398, 0.0430024862, 0.041030128, 0.0390043908, 0.0369257104,
+    0.0347925514, 0.0326092654, 0.0303819386, 0.0281174154, 0.0258198509, 0.0234876389,
+    0.0211236183, 0.0187320044, 0.0163151801, 0.0138786722, 0.0114245956, 0.00895389471,
+    0.00647348059, 0.00398722306, 0.00149860269, -0.00098957158, -0.0034684024, -0.00593370045,
+    -0.00838198352, -0.0108058841, -0.0132068476, -0.0155861395, -0.0179409748, -0.0202651034,
+    -0.0225480049, -0.0247844798, -0.0269784329, -0.0291332326, -0.0312407094, -0.0332971649,
+    -0.0352982921, -0.0372391882, -0.0391201565, -0.0409402893, -0.042695529, -0.0443808924,
+    -0.045992269, -0.0475294448, -0.048986931, -0.0503624887, -0.0516553301, -0.0528619703,
+    -0.0539836397, -0.0550220051, -0.055977975, -0.0568457738, -0.0576206078, -0.0583038235,
+    -0.0588976299, -0.0594020371, -0.0598115698, -0.0601276433, -0.0603506019, -0.0604831683,
+    -0.0605243403, -0.0604709009, -0.0603232267, -0.060079414, -0.0597405085, -0.0593121875,
+    -0.0587940199, -0.0581830081, -0.0574776248, -0.0566796339, -0.0557942725, -0.0548265479,
+    -0.0537810038, -0.0526555345, -0.0514509506, -0.0501715774, -0.0488213228, -0.0473981664,
+    -0.0458993719, -0.0443307405, -0.0426973081, -0.0410041476, -0.0392529603, -0.0374426887,
+    -0.0355766509, -0.0336536794, -0.0316797734, -0.0296615183, -0.0276032625, -0.025504981,
+    -0.0233688367, -0.0212015713, -0.0190080526, -0.0167914488, -0.0145559094, -0.0123038012,
+    -0.0100393479, -0.0077694582, -0.00549637481, -0.00321643423, -0.000930329026, 0.00135505583,
+    0.00363547364, 0.00590313389, 0.00815710531, 0.0103957439, 0.0126128779, 0.0148076069,
+    0.0169740909, 0.0191070244, 0.0212033356, 0.0232640287, 0.0252847708, 0.0272573292,
+    0.0291781561, 0.0310477712, 0.0328668194, 0.0346301668, 0.0363315261, 0.0379681408,
+    0.0395383558, 0.0410461207, 0.0424925834, 0.0438736844, 0.0451837445, 0.04641943,
+    0.0475798679, 0.0486610531, 0.0496619601, 0.0505840066, 0.051423243, 0.0521810734,
+    0.0528566166, 0.0534498779, 0.0539580868, 0.0543758263, 0.0547047446, 0.0549500783,
+    0.0551141386, 0.055191703, 0.0551836917, 0.0550898381, 0.0549123659, 0.0546550072,
+    0.054316647, 0.0538962358, 0.0533944377, 0.0528129388, 0.0521552895, 0.0514187238,
+    0.0506014649, 0.049702177, 0.0487213514, 0.0476653942, 0.0465402139, 0.0453498648,
+    0.0440923754, 0.0427657683, 0.0413734959, 0.0399220571, 0.0384163734, 0.0368535629,
+    0.0352365482, 0.0335703966, 0.0318578781, 0.0300998683, 0.0282983653, 0.026458999,
+    0.0245819924, 0.0226732534, 0.0207361369, 0.0187683242, 0.0167707573, 0.0147464738,
+    0.0127015643, 0.0106430249, 0.00857673899, 0.00650526737, 0.00442874411, 0.0023494789,
+    0.000275053532, -0.00178988363, -0.00384542878, -0.00589436929, -0.0079294296, -0.00994539138,
+    -0.0119371487, -0.0139048998, -0.0158486257, -0.017764682, -0.0196526813, -0.0215061692,
+    -0.0233202125, -0.0250926981, -0.0268248609, -0.0285163794, -0.0301622686, -0.0317574271,
+    -0.0332989442, -0.0347840986, -0.0362104194, -0.0375727545, -0.0388694888, -0.04010014,
+    -0.0412689232, -0.042376339, -0.0434179915, -0.0443881875, -0.0452850758, -0.0461123821,
+    -0.0468691572, -0.0475508992, -0.0481593751, -0.0486908776, -0.0491446309, -0.0495218213,
+    -0.0498248505, -0.0500519263, -0.0501970906, -0.0502614425, -0.0502466517, -0.0501554896,
+    -0.0499853246, -0.0497343507, -0.0494018642, -0.0489913932, -0.0485094534, -0.0479574912,
+    -0.0473345615, -0.046640114, -0.0458752367, -0.0450440852, -0.0441473378, -0.0431849037,
+    -0.0421588362, -0.0410692243, -0.0399182849, -0.0387061201, -0.0374373651, -0.0361129069,
+    -0.0347311413, -0.0332989101, -0.0318225859, -0.0303040346, -0.0287388456, -0.0271277532,
+    -0.0254741363, -0.0237854544, -0.0220686507, -0.0203247032, -0.0185567167, -0.0167660186,
+    -0.0149555826, -0.013129823, -0.0112872483, -0.00942765977, -0.00755312865, -0.00566808389,
+    -0.00377748187, -0.00188494092, 5.21602044e-06, 0.0018935164, 0.00377978851, 0.00565781672,
+    0.00752003437, 0.00936374537, 0.0111918859, 0.013000155, 0.0147825962, 0.0165365852,
+    0.0182593918, 0.019950048, 0.0216045401, 0.0232212834, 0.02479454, 0.0263256336,
+    0.0278163771, 0.0292651421, 0.0306719288, 0.0320302489, 0.0333331349, 0.0345793748,
+    0.0357696161, 0.0369036108, 0.0379804164, 0.0389944345, 0.0399398981, 0.0408180884,
+    0.04163325, 0.042380839, 0.043058838, 0.0436672421, 0.0442085123, 0.0446833185,
+    0.0450869294, 0.0454187251, 0.0456763998, 0.0458609256, 0.0459747667, 0.0460218994,
+    0.0460030706, 0.0459131334, 0.0457524133, 0.0455200563, 0.0452161732, 0.044840933,
+    0.0443924517, 0.0438703561, 0.0432777234, 0.0426204062, 0.0419004298, 0.0411158002,
+    0.0402636637, 0.03934657, 0.0383733223, 0.037345047, 0.0362603938, 0.0351230172,
+    0.0339309827, 0.0326856809, 0.0313915796, 0.0300530258, 0.0286727895, 0.0272507494,
+    0.0257895739, 0.0242909883, 0.0227594577, 0.0211921433, 0.0195877224, 0.0179526154,
+    0.0162934867, 0.0146165544, 0.0129243179, 0.0112174878, 0.00949539542, 0.00776400103,
+    0.00603110923, 0.00429654097, 0.00256052455, 0.000825928534, -0.000905402151, -0.00263082533,
+    -0.00434864266, -0.00605326585, -0.00774390405, -0.00942074005, -0.0110769225, -0.0127081161,
+    -0.0143141142, -0.0158979796, -0.0174594257, -0.0189936787, -0.0204937377, -0.021953526,
+    -0.0233743944, -0.0247524478, -0.0260874649, -0.0273764051, -0.0286163269, -0.0298085786,
+    -0.0309540178, -0.0320500359, -0.0330928212, -0.0340814104, -0.0350155039, -0.0358939393,
+    -0.036718912, -0.0374891687, -0.0381988003, -0.0388439357, -0.0394239835, -0.0399447107,
+    -0.0404050767, -0.0408013812, -0.0411316325, -0.0413969134, -0.0415982486, -0.0417325416,
+    -0.0417980189, -0.041792344, -0.041719191, -0.0415832298, -0.0413857218, -0.0411304428,
+    -0.0408129535, -0.0404324168, -0.0399917837, -0.0394929593, -0.038936154, -0.0383222698,
+    -0.0376488098, -0.0369122204, -0.03611801, -0.0352721136, -0.0343719891, -0.0334176035,
+    -0.0324124053, -0.03135997, -0.0302627712, -0.0291187029, -0.0279288097, -0.0266953211,
+    -0.0254239449, -0.0241184716, -0.0227831517, -0.0214207314, -0.0200268956, -0.0186056714,
+    -0.0171605598, -0.0156941827, -0.0142073816, -0.0127005508, -0.0111740525, -0.00963005263,
+    -0.00807593745, -0.00651457946, -0.00494453648, -0.00336672061, -0.00178728429, -0.00021498597,
+    0.00134999061, 0.00290990012, 0.0044634569, 0.00600943808, 0.00754359211, 0.00906156953,
+    0.0105583806, 0.0120311435, 0.0134811721, 0.0149071028, 0.0163077888, 0.0176801501,
+    0.0190264041, 0.0203471926, 0.0216356143, 0.0228882945, 0.0241017725, 0.0252764439,
+    0.0264116097, 0.0275071719, 0.0285553106, 0.0295507125, 0.0304958647, 0.0313914953,
+    0.0322363073, 0.0330289932, 0.0337663459, 0.0344486529, 0.03507435, 0.0356439702,
+    0.0361571932, 0.036610559, 0.0370012383, 0.0373297745, 0.0376028356, 0.0378226782,
+    0.037984689, 0.0380855588, 0.0381232998, 0.0381009378, 0.0380172906, 0.0378742136,
+    0.0376697684, 0.0374018679, 0.037074397, 0.0366897628, 0.0362476027, 0.0357469619,
+    0.0351943957, 0.0345923469, 0.0339402873, 0.0332407382, 0.0324919546, 0.0316906053,
+    0.0308396778, 0.0299437449, 0.0290095508, 0.028038249, 0.02702675, 0.0259721113,
+    0.0248787244, 0.0237510734, 0.022586965, 0.0213869907, 0.0201526144, 0.0188867646,
+    0.0175948472, 0.0162797711, 0.014944596, 0.0135872643, 0.0122125325, 0.0108250485,
+    0.0094279573, 0.00802375598, 0.00661172095, 0.00519152991, 0.00376189166, 0.00232896315,
+    0.000898805204, -0.000527981183, -0.00195245368, -0.00337089976, -0.00477771747, -0.00617200093,
+    -0.00755768547, -0.00893238371, -0.0102923674, -0.0116320223, -0.0129476734, -0.014236681,
+    -0.0154976469, -0.0167327721, -0.017936825, -0.0191070809, -0.0202413142, -0.021340704,
+    -0.0224062565, -0.0234374708, -0.0244340495, -0.0253907714, -0.0263068271, -0.0271859116,
+    -0.0280256961, -0.0288198973, -0.0295630654, -0.0302566801, -0.0309030731, -0.0315055415,
+    -0.0320614202, -0.0325653443, -0.033016583, -0.0334122777, -0.033749556, -0.0340329417,
+    -0.0342623114, -0.0344354972, -0.03455218, -0.0346165639, -0.0346289439, -0.0345864902,
+    -0.0344909458, -0.034341035, -0.0341402398, -0.0338893407, -0.0335869971, -0.0332277379,
+    -0.0328095737, -0.0323388001, -0.0318199675, -0.031253899, -0.0306388289, -0.029974792,
+    -0.0292644867, -0.0285085344, -0.0277100985, -0.0268693576, -0.0259871605, -0.0250646469,
+    -0.0241042189, -0.0231133403, -0.0220950138, -0.0210447673, -0.0199636915, -0.0188539408,
+    -0.0177202742, -0.0165643, -0.0153878628, -0.014186872, -0.0129613012, -0.0117168036,
+    -0.0104547263, -0.00917722671, -0.00788600989, -0.00658682641, -0.0052838059, -0.00397783715,
+    -0.0026694073, -0.0013576079, -4.41461046e-05, 0.00126936051, 0.00257733386, 0.00387163257,
+    0.00515270697, 0.0064235765, 0.00768362709, 0.00892753591, 0.0101509096, 0.0113563711,
+    0.0125446423, 0.0137136108, 0.0148603109, 0.0159811888, 0.0170740909, 0.0181373885,
+    0.0191735105, 0.0201754047, 0.0211384414, 0.0220615217, 0.0229432806, 0.0237857596,
+    0.024589361, 0.0253541208, 0.02607532, 0.0267506601, 0.0273802002, 0.0279656167,
+    0.0285071855, 0.02899933, 0.029442753, 0.029843986, 0.0302020889, 0.0305129386,
+    0.0307752933, 0.0309876726, 0.0311495058, 0.0312627462, 0.031328305, 0.0313396384,
+    0.0312969302, 0.0311997781, 0.0310508249, 0.0308560026, 0.0306162205, 0.0303318396,
+    0.0300006805, 0.029623428, 0.0292031196, 0.0287409004, 0.0282350652, 0.0276829068,
+    0.0270907611, 0.0264631806, 0.0258012695, 0.0251015732, 0.0243620092, 0.0235858925,
+    0.0227748809, 0.0219308317, 0.0210564468, 0.0201515253, 0.0192148912, 0.0182483497,
+    0.0172570344, 0.0162434432, 0.0152076849, 0.0141540674, 0.0130826304, 0.0119995235,
+    0.010906343, 0.00980058871, 0.00867919207, 0.00754188654, 0.00639397564, 0.0052409562,
+    0.00408549961, 0.00292433941, 0.00175915721, 0.000594814247, -0.000569477581, -0.00173231326,
+    -0.0028923987, -0.00404744163, -0.00519628119, -0.00633600315, -0.00745946058, -0.00856626745,
+    -0.00965953253, -0.0107360281, -0.0117910159, -0.0128199856, -0.0138223444, -0.0147995311,
+    -0.0157563211, -0.0166922873, -0.017600453, -0.018480148, -0.0193297401, -0.0201487656,
+    -0.0209336614, -0.0216819727, -0.0223935071, -0.0230699055, -0.0237121921, -0.0243154138,
+    -0.0248797502, -0.0254021847, -0.0258775583, -0.026310227, -0.0267040869, -0.0270568131,
+    -0.027363763, -0.0276222982, -0.0278354439, -0.0280070057, -0.028138423, -0.0282282776,
+    -0.0282762125, -0.0282829129, -0.0282473789, -0.0281712441, -0.0280496254, -0.0278795534,
+    -0.0276631663, -0.0274032945, -0.0271032058, -0.0267623261, -0.026382124, -0.0259590948,
+    -0.0254922547, -0.0249847536, -0.0244391396, -0.0238573233, -0.0232355008, -0.022577541,
+    -0.0218903093, -0.0211744466, -0.0204267696, -0.0196474562, -0.0188384708, -0.0180036257,
+    -0.0171476418, -0.0162699047, -0.015365384, -0.0144347626, -0.0134782269, -0.0124987044,
+    -0.0115031915, -0.0104914671, -0.009465947, -0.00842698162, -0.00737765119, -0.00632037664,
+    -0.00525833294, -0.00419168528, -0.00311813383, -0.00204376378, -0.0009740476, 9.14715177e-05,
+    0.00115611343, 0.0022186171, 0.00327339867, 0.00431879839, 0.00535360292, 0.00637808908,
+    0.00739375698, 0.0084008378, 0.00939752184, 0.0103775899, 0.01133925, 0.0122817037,
+    0.0132013832, 0.0140966041, 0.0149623425, 0.0157979539, 0.0166071844, 0.0173918876,
+    0.018152774, 0.0188829261, 0.019577302, 0.0202357958, 0.0208636791, 0.021459264,
+    0.0220190324, 0.0225450455, 0.0230359584, 0.0234919446, 0.0239111442, 0.0242933573,
+    0.0246370158, 0.0249391945, 0.0252012078, 0.0254235015, 0.0256044637, 0.0257408872,
+    0.0258296296, 0.0258738773, 0.0258782071, 0.0258437271, 0.0257701147, 0.0256538368,
+    0.025496283, 0.0252995956, 0.0250681674, 0.0247990156, 0.0244888136, 0.0241392457,
+    0.0237529867, 0.023332595, 0.0228754022, 0.022384684, 0.0218591026, 0.0212967588,
+    0.0207026931, 0.0200803171, 0.0194278247, 0.0187414772, 0.0180203612, 0.0172704433,
+    0.0164959856, 0.0157010788, 0.0148856702, 0.0140510024, 0.0131986796, 0.0123306394,
+    0.0114467951, 0.0105446708, 0.00962493976, 0.00869237839, 0.00775067554, 0.006801261,
+    0.00584067124, 0.00487107637, 0.00389256034, 0.00290737793, 0.00192138207, 0.000936062948,
+    -4.75897512e-05, -0.00103433862, -0.00202027474, -0.00299892584, -0.00396676247, -0.00492586123,
+    -0.0058757898, -0.00681193078, -0.00772958187, -0.00862720482, -0.00950600094, -0.0103687031,
+    -0.0112163054, -0.0120485082, -0.0128595249, -0.0136455756, -0.0144089063, -0.0151458739,
+    -0.0158571454, -0.0165423762, -0.0171987155, -0.017823784, -0.0184180303, -0.0189833985,
+    -0.0195136699, -0.0200068799, -0.0204657506, -0.0208933693, -0.0212877149, -0.0216427887,
+    -0.0219569671, -0.0222320608, -0.0224739577, -0.0226853148, -0.0228656576, -0.023013928,
+    -0.0231252985, -0.0232003066, -0.0232401304, -0.0232452935, -0.0232147938, -0.023145203,
+    -0.0230375784, -0.0228946137, -0.0227160354, -0.0225043839, -0.0222548436, -0.0219661338,
+    -0.0216429791, -0.021291322, -0.020909823, -0.0204958835, -0.0200503044, -0.0195728944,
+    -0.0190676688, -0.0185331437, -0.0179717929, -0.0173870885, -0.0167783277, -0.0161472639,
+    -0.0154950379, -0.0148193016, -0.0141163319, -0.013386014, -0.0126348306, -0.0118665505,
+    -0.0110840953, -0.010286884, -0.00947201411, -0.00864177129, -0.00780165465, -0.00695596305,
+    -0.00610275545, -0.00523967285, -0.00437126099, -0.00350112327, -0.00263059178, -0.00175759257,
+    -0.000885803819, -1.44984598e-05, 0.000855361042, 0.00171821361, 0.00257562644, 0.00342751275,
+    0.00427745539, 0.00512631217, 0.0059671675, 0.00679413341, 0.00760732702, 0.00840686792,
+    0.00918999325, 0.00995519167, 0.0107002707, 0.0114235432, 0.0121271384, 0.0128111322,
+    0.0134709997, 0.0141045464, 0.0147127872, 0.0153004469, 0.0158645721, 0.0164053937,
+    0.0169195422, 0.0174031749, 0.0178564192, 0.0182801942, 0.0186795602, 0.0190528205,
+    0.0193940431, 0.0197017307, 0.0199773613, 0.0202211447, 0.0204273997, 0.0205950654,
+    0.0207257131, 0.0208233859, 0.0208911354, 0.0209289737, 0.0209339503, 0.0209022563,
+    0.0208375667, 0.0207432648, 0.0206182862, 0.0204638264, 0.0202779512, 0.0200579025,
+    0.0198057811, 0.0195223416, 0.0192115936, 0.0188703118, 0.018497116, 0.0180942623,
+    0.0176664228, 0.0172137079, 0.0167309184, 0.0162177501, 0.0156767084, 0.0151127507,
+    0.0145264892, 0.0139200304, 0.0132967262, 0.0126548476, 0.0119974171, 0.0113259169,
+    0.0106396841, 0.00993733913, 0.00921972157, 0.0084917259, 0.00775450887, 0.00700736264,
+    0.00625203141, 0.00548251447, 0.00470098813, 0.00391710133, 0.00313589685, 0.00235363523,
+    0.00156670931, 0.000773927559, -2.17266284e-05, -0.000811686106, -0.00159526936, -0.0023711004,
+    -0.0031355999, -0.00389186322, -0.00463937246, -0.00537687103, -0.00610234678, -0.00681876444,
+    -0.0075249408, -0.00821757101, -0.00889765392, -0.0095639649, -0.0102160869, -0.010854536,
+    -0.0114734321, -0.0120690555, -0.0126419543, -0.0131936213, -0.0137263363, -0.0142363786,
+    -0.014717279, -0.0151683111, -0.0155966508, -0.0159988362, -0.0163740896, -0.016721693,
+    -0.0170366227, -0.0173203603, -0.0175765053, -0.0178107119, -0.0180231128, -0.018206997,
+    -0.018359699, -0.0184814084, -0.0185757781, -0.0186424625, -0.0186811456, -0.0186884849,
+    -0.0186634842, -0.01860784, -0.018521891, -0.0184041996, -0.0182563887, -0.0180829852,
+    -0.0178871048, -0.0176654151, -0.0174161782, -0.0171363183, -0.0168276532, -0.0164958633,
+    -0.0161408757, -0.0157674038, -0.015374895, -0.0149572689, -0.0145155735, -0.0140550382,
+    -0.0135771255, -0.0130745191, -0.0125476987, -0.0119979087, -0.0114282871, -0.0108428296,
+    -0.010243252, -0.00962541599, -0.00898848572, -0.0083397911, -0.00768170545, -0.00701483125,
+    -0.00634288333, -0.00566276318, -0.004973456, -0.00427820235, -0.00357674894, -0.00287442282,
+    -0.00217018362, -0.00146351171, -0.000756690056, -5.34511303e-05, 0.00064858585, 0.00135351009,
+    0.00205901811, 0.00275958354, 0.00345017346, 0.00413215091, 0.00480771585, 0.00547510262,
+    0.00613417343, 0.00677770275, 0.00740312404, 0.00801020638, 0.00860151306, 0.00917806722,
+    0.00973783075, 0.0102815478, 0.0108084572, 0.0113173313, 0.0118112135, 0.0122867975,
+    0.0127386217, 0.0131654872, 0.0135692754, 0.0139563126, 0.0143268203, 0.0146743103,
+    0.0149943203, 0.015290233, 0.0155587852, 0.01579717, 0.0160087265, 0.0161910415,
+    0.0163452621, 0.0164715957, 0.0165731606, 0.0166491598, 0.0166955785, 0.0167152759,
+    0.016709768, 0.0166818173, 0.016632306, 0.0165577638, 0.0164539834, 0.0163213623,
+    0.0161636202, 0.0159841493, 0.0157811399, 0.0155517034, 0.0152970296, 0.0150222437,
+    0.0147253283, 0.01440386, 0.0140567823, 0.0136849918, 0.0132933246, 0.0128829728,
+    0.0124595015, 0.0120215719, 0.0115642134, 0.0110902484, 0.0106023578, 0.0101042798,
+    0.00959627939, 0.00907516315, 0.00853777889, 0.00798650015, 0.00742422654, 0.00685112272,
+    0.00626810629, 0.00567442572, 0.00507302642, 0.0044682363, 0.0038572032, 0.00323800819,
+    0.00261165548, 0.00198244917, 0.00135311187, 0.000724129931, 0.00010048011, -0.000520859916,
+    -0.00114261024, -0.00176002142, -0.00236933859, -0.00296788626, -0.00356075257, -0.00414960258,
+    -0.00473278118, -0.00530767649, -0.00587439965, -0.00643393614, -0.00698747803, -0.00753400171,
+    -0.00806347888, -0.00857411484, -0.00906674475, -0.00954193444, -0.0100035288, -0.0104496075,
+    -0.0108774016, -0.011288004, -0.011676598, -0.0120434667, -0.0123913118, -0.0127180257,
+    -0.0130206825, -0.0133023793, -0.0135696428, -0.0138190499, -0.0140470619, -0.0142516142,
+    -0.0144341674, -0.0145971334, -0.0147405804, -0.0148622076, -0.014955813, -0.0150224114,
+    -0.0150612008, -0.015074592, -0.0150654425, -0.0150306877, -0.0149728039, -0.0148925756,
+    -0.0147894876, -0.0146654987, -0.0145185023, -0.0143461954, -0.014149561, -0.0139323134,
+    -0.0137003075, -0.013451887, -0.0131796768, -0.0128835366, -0.0125699314, -0.0122385483,
+    -0.0118884746, -0.0115203918, -0.011129864, -0.0107194901, -0.0102901043, -0.00984369317,
+    -0.00938123427, -0.00890211356, -0.00840973141, -0.00790545655, -0.0073940955, -0.00687472032,
+    -0.00634318906, -0.0058000411, -0.00524652906, -0.00468573813, -0.00412296751, -0.00355679026,
+    -0.00298220461, -0.00240208302, -0.00182132911, -0.00123722065, -0.000648903135, -5.70134178e-05,
+    0.000535582775, 0.00112508678, 0.00171303341, 0.0022961761, 0.00287516901, 0.00345254627,
+    0.00402091561, 0.00457571638, 0.00511310862, 0.00563638476, 0.00614850404, 0.00665183074,
+    0.00714349858, 0.00762034516, 0.00808276655, 0.00853215976, 0.00896972523, 0.00939044894,
+    0.00979054915, 0.0101726141, 0.0105401699, 0.0108930754, 0.0112271466, 0.0115415714,
+    0.0118366909, 0.0121075708, 0.0123586946, 0.0125912938, 0.0128008019, 0.0129864094,
+    0.0131461417, 0.0132830597, 0.0134007759, 0.0134982765, 0.0135752468, 0.0136340382,
+    0.0136771381, 0.0137026378, 0.0137092457, 0.0136889091, 0.0136436815, 0.0135781206,
+    0.0134952029, 0.013396622, 0.0132764356, 0.0131329817, 0.0129670488, 0.0127775332,
+    0.0125674701, 0.0123389612, 0.012090086, 0.0118183744, 0.0115255627, 0.011218347,
+    0.010895688, 0.0105546221, 0.0101954831, 0.00982217765, 0.00943928375, 0.0090467218,
+    0.00864128702, 0.00821909354, 0.00778235343, 0.00732919177, 0.00686321354, 0.00638690908,
+    0.0058958957, 0.0053963614, 0.00489109352, 0.00437818153, 0.00385922577, 0.00333440598,
+    0.00280262782, 0.00226544436, 0.00172815364, 0.00119499754, 0.000662661795, 0.000127437568,
+    -0.000408227896, -0.000936880709, -0.00145682294, -0.00196988176, -0.00247964416, -0.00298815868,
+    -0.00349324735, -0.0039954245, -0.00449123284, -0.00497891579, -0.00546043841, -0.00593021696,
+    -0.00638759926, -0.00682914314, -0.00725666968, -0.00767336952, -0.0080774959, -0.00846709653,
+    -0.00883881064, -0.00918982033, -0.00952275198, -0.00984388405, -0.0101485405, -0.0104322927,
+    -0.0106973424, -0.0109459738, -0.0111778542, -0.0113916557, -0.0115852861, -0.0117623679,
+    -0.0119218418, -0.0120655896, -0.0121923729, -0.0122964159, -0.0123749325, -0.01242498,
+    -0.0124520013, -0.0124601529, -0.0124475868, -0.0124147558, -0.0123604813, -0.0122847188,
+    -0.0121902668, -0.0120802872, -0.0119485115, -0.0117939698, -0.0116223295, -0.0114359437,
+    -0.011235938, -0.0110178314, -0.0107818821, -0.0105298893, -0.0102620515, -0.00998132899,
+    -0.00968696861, -0.00937546645, -0.00904635927, -0.00869626567, -0.00833194684, -0.00795786438,
+    -0.00757226266, -0.00717475166, -0.00676888139, -0.00635714811, -0.00594000534, -0.00551716911,
+    -0.00508420728, -0.00464440177, -0.00420184747, -0.00375729073, -0.00331019051, -0.00285395734,
+    -0.0023922471, -0.00192813999, -0.00146286187, -0.000998816585, -0.00053510603, -6.9611264e-05,
+    0.000399151134, 0.000870098965, 0.00133702254, 0.00180029909, 0.00226221773, 0.00271989855,
+    0.00316786199, 0.00360201426, 0.00402438094, 0.00443906016, 0.00484932272, 0.00525243403,
+    0.00564793983, 0.0060308837, 0.00640134415, 0.00676482404, 0.00711556971, 0.00745408655,
+    0.00778197365, 0.00809689515, 0.0083991272, 0.0086880252, 0.00896355788, 0.00922261403,
+    0.00946361314, 0.00968946794, 0.00990286505, 0.0100991872, 0.0102716589, 0.010418956,
+    0.0105462987, 0.0106593758, 0.0107573304, 0.0108374841, 0.0109031675, 0.0109516375,
+    0.0109842898, 0.0110053735, 0.0110086549, 0.0109926973, 0.0109579211, 0.0109057662,
+    0.0108374834, 0.01075159, 0.0106480915, 0.0105221945, 0.0103761183, 0.0102142269,
+    0.0100400241, 0.00984952525, 0.00963934624, 0.00940903755, 0.00916220234, 0.00890243725,
+    0.00862788242, 0.00834099567, 0.00804695812, 0.00774450393, 0.00743455871, 0.00711400039,
+    0.0067775109, 0.00642715527, 0.00606147058, 0.00568675892, 0.00530640936, 0.00491541575,
+    0.00451317679, 0.00410097199, 0.00368091486, 0.00325829612, 0.0028373219, 0.00241134605,
+    0.00197960923, 0.00154773087, 0.00111725369, 0.000689315335, 0.000259779195, -0.000169671769,
+    -0.000593594718, -0.00101022659, -0.00141944579, -0.00182372285, -0.00222323774, -0.00262192365,
+    -0.00302139234, -0.00341258017, -0.00379481417, -0.00417165198, -0.00453875268, -0.00489503129,
+    -0.00523966332, -0.00557109609, -0.00589116664, -0.00620377475, -0.00650400011, -0.00678832418,
+    -0.00705590977, -0.00730823313, -0.00755342262, -0.00778605596, -0.00800394705, -0.00820675331,
+    -0.00839221348, -0.00856291145, -0.00872135364, -0.00886879646, -0.00900631228, -0.00913129132,
+    -0.00924328489, -0.00934308883, -0.00942932417, -0.00949485616, -0.00953642989, -0.00956049508,
+    -0.00957225798, -0.00957022779, -0.00955222227, -0.00951609638, -0.00945910913, -0.00938725466,
+    -0.00930745006, -0.00921265697, -0.00910533451, -0.0089830121, -0.00884408384, -0.00869299293,
+    -0.00852869616, -0.00835301025, -0.00816810278, -0.00797119074, -0.00776258697, -0.00754606908,
+    -0.00731739657, -0.00707052578, -0.00680867561, -0.0065355124, -0.00625320603, -0.00596092415,
+    -0.00565761725, -0.00534673401, -0.00503233895, -0.00471820622, -0.00440359373, -0.00408297707,
+    -0.00375672413, -0.00342348226, -0.00308837163, -0.00275379452, -0.00241506137, -0.00207310369,
+    -0.0017245098, -0.00137171955, -0.00102097188, -0.00067494489, -0.000327865392, 2.4627213e-05,
+    0.000383748257, 0.000744447353, 0.00110057464, 0.00145551974, 0.00180613065, 0.00214586584,
+    0.00247929815, 0.00280634933, 0.00312856463, 0.00344751057, 0.00376051662, 0.00406456058,
+    0.00435757837, 0.00464205305, 0.00492391356, 0.00520143805, 0.00547557262, 0.00573944356,
+    0.00598881731, 0.0062249262, 0.00645342294, 0.00667291841, 0.00688125272, 0.00707509814,
+    0.00725275838, 0.00742125662, 0.00757769267, 0.00771575837, 0.00783603006, 0.00793841644,
+    0.00802597632, 0.00809957779, 0.00816429291, 0.00822055309, 0.00826228568, 0.00829249768,
+    0.0083143371, 0.00832417663, 0.00832163732, 0.00830511228, 0.00827295592, 0.00822783375,
+    0.00817163501, 0.00810184005, 0.00801653846, 0.00791640161, 0.0078052948, 0.00768996613,
+    0.00756122601, 0.00741620666, 0.00725419093, 0.00707781338, 0.00689354324, 0.00670147683,
+    0.00650317089, 0.00630028024, 0.0060877722, 0.00586606853, 0.00563786868, 0.00540288439,
+    0.00515618617, 0.00489739899, 0.00463033334, 0.00435838291, 0.00407847018, 0.0037885431,
+    0.00348864227, 0.00318065617, 0.00287084469, 0.00256345495, 0.00225143516, 0.00193660539,
+    0.00161732078, 0.00129528553, 0.00097422724, 0.000651447978, 0.000330391048, 1.20360608e-05,
+    -0.000303362404, -0.00061296739, -0.000915620528, -0.00121569116, -0.00151911769, -0.00182510265,
+    -0.00212782279, -0.00242302986, -0.00271493536, -0.0030054637, -0.00329175181, -0.00357297422,
+    -0.00384384277, -0.00410493953, -0.00435829776, -0.00460188721, -0.00483731623, -0.00506297956,
+    -0.00527828946, -0.00548968477, -0.00569273156, -0.00588552059, -0.0060660832, -0.00623374955,
+    -0.00638826855, -0.0065359791, -0.006682203, -0.00682218357, -0.00694971496, -0.00706496474,
+    -0.00717411283, -0.0072738792, -0.00736138934, -0.00743559169, -0.00749118239, -0.00753211185,
+    -0.00755939447, -0.00757094445, -0.00756979296, -0.00755356784, -0.00752426713, -0.00748786466,
+    -0.00744247324, -0.00738737503, -0.00731919067, -0.00723530821, -0.00713773252, -0.00703137552,
+    -0.00691737698, -0.00679424368, -0.00666082549, -0.00651606685, -0.00636503412, -0.00620103062,
+    -0.00601869447, -0.00581910416, -0.0056073058, -0.00538942126, -0.00516355393, -0.00493058475,
+    -0.0046895667, -0.00443713665, -0.00418066774, -0.00392348613, -0.00366496541, -0.0034048886,
+    -0.00313806577, -0.00286360069, -0.0025867411, -0.00230625546, -0.00202084562, -0.0017318403,
+    -0.00143718827, -0.00114053112, -0.000849208481, -0.000554958631, -0.000254054072, 5.04282619e-05,
+    0.000356130643, 0.000658889135, 0.000961634319, 0.00125888629, 0.00155133967, 0.00184065513,
+    0.00212406176, 0.00240023196, 0.00267082576, 0.00293754985, 0.00320098293, 0.00345830197,
+    0.00370695842, 0.00395180087, 0.00419688666, 0.00443970206, 0.00467572713, 0.00489805997,
+    0.00510630993, 0.00530790317, 0.00550444246, 0.00569632406, 0.00587792905, 0.00604598556,
+    0.00620490841, 0.0063494781, 0.00648175292, 0.00660280451, 0.00670870713, 0.00679915174,
+    0.00687623807, 0.00694274927, 0.00699877977, 0.00704188051, 0.00707085791, 0.00709258815,
+    0.00710823508, 0.00711328132, 0.00710595355, 0.00708174046, 0.00704306787, 0.00699175809,
+    0.0069255479, 0.00684653822, 0.00675214868, 0.00664514405, 0.00653125322, 0.00640638278,
+    0.00626708973, 0.00611186429, 0.00594085808, 0.00575773468, 0.00556786481, 0.00537841308,
+    0.0051840801, 0.00497925663, 0.00476554349, 0.00455068677, 0.00433180679, 0.00410806538,
+    0.00387713617, 0.00363458145, 0.00338720528, 0.00313315286, 0.00287038467, 0.00260456971,
+    0.00233468066, 0.00206306499, 0.00179512153, 0.00152673544, 0.00125501239, 0.000979250765,
+    0.000702204755, 0.000425840503, 0.000153799706, -0.000112171702, -0.000375601482, -0.000639075933,
+    -0.000899350509, -0.00115193955, -0.0014027914, -0.00165555069, -0.00190949609, -0.00216144862,
+    -0.00240617712, -0.00265075135, -0.00289410892, -0.00313712596, -0.0033808267, -0.00361559275,
+    -0.00383845387, -0.00405016243, -0.00425106368, -0.00444680782, -0.00463803344, -0.00481902984,
+    -0.00499185472, -0.00515688545, -0.00531231877, -0.00546015143, -0.00559705092, -0.00571841514,
+    -0.00583380285, -0.0059458345, -0.00605050849, -0.00614395167, -0.00622517534, -0.00629936607,
+    -0.00636384795, -0.00641823406, -0.00646045034, -0.0064857039, -0.00649535214, -0.00648787307,
+    -0.00646821062, -0.00643873321, -0.00639572435, -0.00633890903, -0.00627576686, -0.00620651646,
+    -0.00612901582, -0.00604194614, -0.00593854699, -0.00582191236, -0.00570036469, -0.00557398152,
+    -0.00544279583, -0.00530122092, -0.00514689557, -0.00498526326, -0.00481202424, -0.00462858955,
+    -0.0044365136, -0.00423465468, -0.00402396574, -0.00380444971, -0.00357844942, -0.00334472514,
+    -0.00310233408, -0.00285350224, -0.00260721193, -0.00236546659, -0.00212339532, -0.00187578072,
+    -0.00161917552, -0.00135953348, -0.00109799406, -0.000835065414, -0.000572632565, -0.000305926134,
+    -3.96204087e-05, 0.000221400714, 0.000483865925, 0.000747594695, 0.00101341725, 0.00128092432,
+    0.00154594688, 0.00180586711, 0.00205831297, 0.00230456704, 0.00254767169, 0.0027852759,
+    0.00300984707, 0.00322194161, 0.00342690036, 0.00362563174, 0.00381905389, 0.00400153542,
+    0.00418017553, 0.00435466996, 0.00452303053, 0.00468687793, 0.00483937295, 0.00497769363,
+    0.00510737522, 0.00523054997, 0.00534795935, 0.00545714995, 0.00555425621, 0.00563712401,
+    0.0057051774, 0.00576390921, 0.00581556443, 0.00585472441, 0.00587714463, 0.00588729302,
+    0.00588736392, 0.00587983105, 0.0058630621, 0.00583372676, 0.00580156329, 0.00576487566,
+    0.00572056513, 0.00566922609, 0.00560348442, 0.00552447922, 0.00543459157, 0.00533623337,
+    0.00523004138, 0.0051134009, 0.0049848099, 0.00484732224, 0.00470145587, 0.00454797224,
+    0.00438760446, 0.0042151241, 0.00403116898, 0.00384428749, 0.00365622934, 0.00346563021,
+    0.00326735956, 0.00306127924, 0.0028562548, 0.00265111268, 0.00244614386, 0.00223877373,
+    0.00202377717, 0.0018026855, 0.00157225893, 0.00133701471, 0.0011007549, 0.000860720411,
+    0.000617075489, 0.000376588631, 0.000138735473, -9.95878755e-05, -0.000337733758, -0.000579385533,
+    -0.000819857442, -0.00105220994, -0.00127766361, -0.00149967618, -0.00172299358, -0.00194364228,
+    -0.00215556515, -0.00236182824, -0.00256287107, -0.00276311022, -0.00296250387, -0.00315825071,
+    -0.00335518376, -0.00354737972, -0.00373279215, -0.00391587091, -0.00409235882, -0.00425193992,
+    -0.00439890733, -0.00453802248, -0.00466966084, -0.00479739467, -0.00491384786, -0.00501614319,
+    -0.00510707151, -0.00518757686, -0.00526208338, -0.00532588176, -0.00537730507, -0.00541997516,
+    -0.00545436718, -0.00548021816, -0.0054957931, -0.0054999332, -0.00549423647, -0.0054764098,
+    -0.00545065067, -0.00541731131, -0.00536993506, -0.00530317392, -0.005218142, -0.00511985909,
+    -0.00501377346, -0.00489852568, -0.00476794544, -0.00463152671, -0.00448833001, -0.00433644511,
+    -0.00418136219, -0.00401553474, -0.00384098539, -0.00366448885, -0.00348619186, -0.00330421157,
+    -0.00311635309, -0.00292006015, -0.00271769063, -0.00251312106, -0.00230866408, -0.00210369027,
+    -0.00189382129, -0.00167500185, -0.00144884467, -0.00122180326, -0.000996648809, -0.000769385797,
+    -0.000540227595, -0.000322112486, -0.00011079722, 9.43652246e-05, 0.000295485955, 0.000499877746,
+    0.000704772252, 0.00090709136, 0.00110530431, 0.0012966171, 0.00148639121, 0.00167516782,
+    0.00186262267, 0.00204741423, 0.00222846765, 0.00240284626, 0.00257532172, 0.0027423478,
+    0.00290156815, 0.00305403667, 0.00320056504, 0.00334569796, 0.0034854032, 0.00360558086,
+    0.00370949468, 0.00380257572, 0.00388887997, 0.00397172944, 0.00404754619, 0.00411740643,
+    0.00417684773, 0.00422855936, 0.00427689508, 0.00432080651, 0.00435618247, 0.0043804488,
+    0.00439503639, 0.00440275007, 0.00440744771, 0.00440457338, 0.00439315089, 0.004372166,
+    0.00434223067, 0.00431000033, 0.00426886137, 0.0042152902, 0.00415547501, 0.00408951006,
+    0.00401991697, 0.00394635707, 0.00386658877, 0.00378890379, 0.00370964384, 0.00362779699,
+    0.00354647601, 0.00345893363, 0.00335708767, 0.00325037018, 0.00314319548, 0.00303421455,
+    0.0029247665, 0.00280433471, 0.0026654147, 0.00251730101, 0.00236632775, 0.00221603389,
+    0.00206093689, 0.00190372302, 0.00174043604, 0.00157205407, 0.00140245682, 0.00122762717,
+    0.00105022106, 0.00087914711, 0.000709230367, 0.000541705096, 0.000377709122, 0.000209489778,
+    3.27383386e-05, -0.000149200739, -0.000332285173, -0.000513044465, -0.000695033157, -0.000881578316,
+    -0.00106033829, -0.00123284434, -0.00140055751, -0.00156006346, -0.00172044881, -0.00187878425,
+    -0.00202825207, -0.00216873934, -0.00230167258, -0.00243102229, -0.00255734889, -0.00267871033,
+    -0.0027913058, -0.00289578296, -0.00299430962, -0.0030909983, -0.00318886812, -0.00328857995,
+    -0.00338206617, -0.00346735531, -0.00355277781, -0.00363640754, -0.0037058718, -0.00376648223,
+    -0.00381835804, -0.00386235752, -0.00390399861, -0.00393588611, -0.00395814137, -0.00397144014,
+    -0.00397717638, -0.00398108289, -0.00398134943, -0.00397473693, -0.00395966262, -0.00393643651,
+    -0.00390438912, -0.00386880087, -0.00382828391, -0.00378185541, -0.00372992699, -0.00367333517,
+    -0.00361609221, -0.00355062879, -0.00346687963, -0.00336975782, -0.00326383892, -0.00315524036,
+    -0.00304344677, -0.00292322958, -0.00279789245, -0.00266456457, -0.00252664962, -0.00239144593,
+    -0.00225515926, -0.00211630673, -0.00197424611, -0.0018293572, -0.0016832388, -0.00153934285,
+    -0.00139031641, -0.00123667305, -0.00108095566, -0.000923941863, -0.000771642534, -0.000615794692,
+    -0.000451087959, -0.000281996681, -0.000111291436, 5.84984573e-05, 0.000230210965, 0.000403219428,
+    0.00056987584, 0.000732387934, 0.000889111408, 0.0010391893, 0.00118730481, 0.00133513165,
+    0.0014804739, 0.00162119803, 0.00175701427, 0.00189285856, 0.00203631013, 0.0021809756,
+    0.00232085299, 0.00245337367, 0.00257489509, 0.00269713016, 0.00282156, 0.00294538261,
+    0.00306421107, 0.00317467445, 0.00328076141, 0.00337801208, 0.00346244177, 0.00353913273,
+    0.00360697513, 0.00366534027, 0.00372024449, 0.00377262958, 0.00382012375, 0.00385941348,
+    0.00388874941, 0.00391502999, 0.00394175056, 0.00396091153, 0.00397275029, 0.00397693878,
+    0.00397206238, 0.00396402248, 0.00394333246, 0.00391011835, 0.00386635639, 0.00381456353,
+    0.00376214048, 0.00370379303, 0.00363155665, 0.0035444805, 0.00344551165, 0.00333768876,
+    0.00322890993, 0.00312163447, 0.00301182129, 0.00289453411, 0.00277070373, 0.00264801213,
+    0.00252496283, 0.00239515272, 0.00226021559, 0.00211812479, 0.00197180683, 0.00182220859,
+    0.00166084009, 0.0014935672, 0.00132219806, 0.00114899006, 0.000979906547, 0.000810050824,
+    0.000636200967, 0.000458029747, 0.000278011792, 9.82978622e-05, -7.87459989e-05, -0.000253035797,
+    -0.000423628702, -0.000591610423, -0.000755999031, -0.000909171287, -0.00106311771, -0.00122611952,
+    -0.00139120656, -0.00155563127, -0.00171413609, -0.00186949939, -0.00202967901, -0.00218898096,
+    -0.00234613109, -0.00249742223, -0.00263691843, -0.0027673734, -0.00289198422, -0.00301198275,
+    -0.00312482562, -0.00323110485, -0.00333086206, -0.00342525855, -0.00351224347, -0.00359050378,
+    -0.00365814608, -0.00371213152, -0.00376595923, -0.00382117871, -0.0038736947, -0.00391930026,
+    -0.00395404592, -0.00398549899, -0.0040130932, -0.00402924461, -0.00403769474, -0.00403585538,
+    -0.0040214677, -0.00399942211, -0.00396740161, -0.00392553006, -0.00387376771, -0.00381130558,
+    -0.003743821, -0.00368027832, -0.00361112819, -0.00353201619, -0.00344382508, -0.00334541642,
+    -0.0032461124, -0.00314753419, -0.00304553653, -0.00293559032, -0.00281877926, -0.00270343685,
+    -0.0025798246, -0.00244611354, -0.00230518648, -0.00215461915, -0.00199722293, -0.00183752622,
+    -0.00167174467, -0.00150090699, -0.00132465155, -0.00114302459, -0.000968857931, -0.000804184879,
+    -0.000638001895, -0.000470543669, -0.000300015459, -0.000125357696, 4.55258337e-05, 0.000218205478,
+    0.000391291299, 0.000563310224, 0.000732047092, 0.000893142587, 0.00105621212, 0.00122499858,
+    0.00139830139, 0.00157202145, 0.0017427783, 0.00190813582, 0.00206774393, 0.00222316716,
+    0.00237591224, 0.00252293129, 0.0026544538, 0.00277520217, 0.00289132632, 0.00300393935,
+    0.00311317315, 0.00321248836, 0.00330543558, 0.00340292233, 0.00349562656, 0.00358387428,
+    0.00366532405, 0.00373333736, 0.00379686904, 0.00386000632, 0.00392029963, 0.00397374454,
+    0.00401857969, 0.00405291717, 0.00407689111, 0.00409144381, 0.00409751795, 0.00409445008,
+    0.00407517298, 0.00404907418, 0.00402013811, 0.0039834303, 0.00393815784, 0.00388212576,
+    0.00382658641, 0.00377697757, 0.00372480745, 0.0036672621, 0.00359907869, 0.00351695135,
+    0.00342678962, 0.0033299978, 0.0032288917, 0.00312052942, 0.00300358743, 0.00288083282,
+    0.00275185731, 0.00261321629, 0.00246601465, 0.00230867975, 0.00213946336, 0.00197399918,
+    0.00181090039, 0.00164423758, 0.00147227433, 0.00129249559, 0.001116997, 0.000946458117,
+    0.000772897089, 0.000596362959, 0.00041461274, 0.000226933738, 3.45342912e-05, -0.000162915851,
+    -0.000363523167, -0.00056773772, -0.000772844693, -0.000970978208, -0.00116157019, -0.00135169756,
+    -0.00154311836, -0.0017365784, -0.00192874523, -0.00210803036, -0.00227913811, -0.0024430275,
+    -0.0026031597, -0.00275865312, -0.0028991928, -0.00303361046, -0.00316542243, -0.00329170592,
+    -0.00341416313, -0.00353068055, -0.00364332586, -0.00375593591, -0.00386542285, -0.00396945206,
+    -0.00406704381, -0.00414407672, -0.004202357, -0.00425455567, -0.00430165226, -0.00434227602,
+    -0.00437342289, -0.00438980479, -0.00439701337, -0.00439505554, -0.00438599755, -0.00436534998,
+    -0.00432844868, -0.00428953943, -0.00424863426, -0.00420456318, -0.00415416479, -0.00409424928,
+    -0.00402829053, -0.00395786438, -0.00388151112, -0.00380076249, -0.00371270983, -0.00360457465,
+    -0.00348218033, -0.00335274884, -0.00321454943, -0.00306962974, -0.00291443112, -0.00275727135,
+    -0.00260455096, -0.00244747186, -0.00228451856, -0.00211175173, -0.0019287734, -0.0017502947,
+    -0.00157611303, -0.00140401704, -0.00122895522, -0.00104792275, -0.000863623648, -0.000678755197,
+    -0.00049348507, -0.000307217761, -0.000116311965, 8.73069145e-05, 0.000294679641, 0.000501623912,
+    0.000709243649, 0.000917218811, 0.0011286621, 0.00132738414, 0.00151137527, 0.00169154137,
+    0.00186735665, 0.00204252177, 0.00221767215, 0.00238462195, 0.00254455651, 0.00269934359,
+    0.00285136654, 0.00299891977, 0.00313937817, 0.00327458253, 0.00340700815, 0.00353751029,
+    0.00366595416, 0.00379033058, 0.00390045777, 0.00400175104, 0.00409623095, 0.00418797262,
+    0.00427646628, 0.00434064301, 0.00438364371, 0.00441622714, 0.00443873382, 0.00445590684,
+    0.00446652631, 0.00447134427, 0.00447201088, 0.00446561906, 0.00445313088, 0.00443483822,
+    0.00440185179, 0.0043566435, 0.00430643509, 0.0042504081, 0.00418941972, 0.00411964327,
+    0.00403275469, 0.00393625219, 0.00383213615, 0.00372124144, 0.00359964189, 0.00345455076,
+    0.00329811177, 0.00313488941, 0.00296642416, 0.0027923362, 0.00261230685, 0.00243723916,
+    0.00226803042, 0.00209952723, 0.00193086345, 0.00175774152, 0.00156749791, 0.00136990996,
+    0.00117567205, 0.000982835878, 0.000790786812, 0.0005901944, 0.000380022268, 0.000171166769,
+    -3.73372568e-05, -0.000242533286, -0.000450008815, -0.000663840936, -0.00086940443, -0.00106759887,
+    -0.00125973965, -0.00144875122, -0.00163729636, -0.00181089573, -0.00197079608, -0.00212067467,
+    -0.00226127565, -0.00239639396, -0.0025455313, -0.00269799733, -0.00284395788, -0.00298507378,
+    -0.00311923519, -0.00325012319, -0.00337023536, -0.00347618976, -0.00357631107, -0.00367105754,
+    -0.00376551831, -0.00384991772, -0.00390986209, -0.00395466613, -0.0039876698, -0.00401637324,
+    -0.00404126496, -0.00404297264, -0.00402322035, -0.00398921698, -0.00394444088, -0.0038976797,
+    -0.00386342792, -0.00382233486, -0.00377023897, -0.00371312236, -0.00365241968, -0.00359811586,
+    -0.00353545118, -0.00345672234, -0.00337234766, -0.00328171945, -0.0031904217, -0.0030955248,
+    -0.00299484595, -0.00289185338, -0.00278700137, -0.00268310398, -0.00257725982, -0.00246979212,
+    -0.00236501881, -0.0022656508, -0.00217075917, -0.00207885499, -0.0019789275, -0.00187934152,
+    -0.00179223842, -0.00171269711, -0.00164498553, -0.00157526461
+};
+
+// band limited step (1 -> 0)
+const float blep_bls[BLEP_N] = {
+    1.0000239, 1.00004502, 1.00006318, 1.00007817, 1.00008989, 1.00009817,
+    1.00010259, 1.0001028, 1.00009851, 1.00008944, 1.00007533, 1.00005583,
+    1.00003054, 0.999999096, 0.999961118, 0.999916197, 0.999863859, 0.999803601,
+    0.999734987, 0.999657491, 0.999570598, 0.999473594, 0.999365688, 0.999246351,
+    0.999114986, 0.998970954, 0.998813515, 0.998641828, 0.998455409, 0.998253748,
+    0.998036181, 0.997801975, 0.99755026, 0.997279956, 0.996990173, 0.996680121,
+    0.996348889, 0.995995509, 0.995618738, 0.995217359, 0.994790334, 0.994336571,
+    0.993854968, 0.993344259, 0.992803087, 0.992230185, 0.991624217, 0.990983833,
+    0.990307608, 0.989594153, 0.988842383, 0.988051038, 0.98721872, 0.986343979,
+    0.985425281, 0.984460923, 0.983449344, 0.982388995, 0.98127824, 0.980115385,
+    0.978898591, 0.977626183, 0.976296507, 0.974907777, 0.973458202, 0.971945909,
+    0.970369145, 0.968726246, 0.96701541, 0.965234785, 0.963382414, 0.9614564,
+    0.959455096, 0.957376779, 0.955219617, 0.952981751, 0.950661222, 0.948255952,
+    0.945763974, 0.943183344, 0.940512084, 0.937748219, 0.934889768, 0.931935026,
+    0.928882232, 0.925729541, 0.922475116, 0.919117129, 0.915653932, 0.912083869,
+    0.908405217, 0.904616282, 0.900715348, 0.896700808, 0.892571213, 0.888325059,
+    0.883960838, 0.879477107, 0.874872411, 0.870145329, 0.865294498, 0.860318548,
+    0.855216214, 0.849986271, 0.844627685, 0.839139733, 0.833521534, 0.827772163,
+    0.821890811, 0.815876753, 0.809729494, 0.803448534, 0.797033385, 0.790483615,
+    0.783798866, 0.776978886, 0.770023556, 0.762932833, 0.755706719, 0.748345328,
+    0.740848894, 0.733217826, 0.725452536, 0.717553477, 0.709521266, 0.70135659,
+    0.693060408, 0.684633944, 0.676078325, 0.667394779, 0.658584654, 0.649649442,
+    0.640590754, 0.631410118, 0.622109202, 0.612689853, 0.603154055, 0.593503918,
+    0.583741647, 0.573869494, 0.563889821, 0.553805183, 0.543618311, 0.533332172,
+    0.522949666, 0.512473722, 0.501907425, 0.491253959, 0.480516789, 0.46969952,
+    0.458805726, 0.447839117, 0.436803484, 0.425702762, 0.414540925, 0.403321843,
+    0.392049577, 0.380728371, 0.36936255, 0.357956552, 0.34651491, 0.335042177,
+    0.323542998, 0.312022164, 0.300484581, 0.288935335, 0.277379385, 0.265821723,
+    0.254267492, 0.242721883, 0.231190163, 0.219677546, 0.208189314, 0.196730848,
+    0.185307604, 0.173925131, 0.162588844, 0.151303993, 0.14007598, 0.128910279,
+    0.11781239, 0.106787906, 0.095842412, 0.0849814442, 0.074210571, 0.0635353291,
+    0.0529612855, 0.0424940112, 0.0321388562, 0.0219012116, 0.0117864969, 0.00180003528,
+    -0.00805291173, -0.0177672918, -0.0273380229, -0.0367599971, -0.0460281637, -0.0551375381,
+    -0.064083331, -0.072860931, -0.0814657535, -0.0898932468, -0.0981389646, -0.106198535,
+    -0.114067689, -0.121742245, -0.129218112, -0.136491358, -0.143558145, -0.150414877,
+    -0.157058216, -0.163484803, -0.169691407, -0.175674956, -0.181432622, -0.186961889,
+    -0.192260216, -0.197325171, -0.202154511, -0.206746132, -0.211098131, -0.215208814,
+    -0.219076628, -0.222700183, -0.226078334, -0.229210101, -0.232094695, -0.234731397,
+    -0.237119644, -0.239259126, -0.241149747, -0.242791774, -0.244185732, -0.245332183,
+    -0.246231873, -0.24688574, -0.24729501, -0.247461141, -0.247385608, -0.24707012,
+    -0.246516612, -0.245727201, -0.244704171, -0.243449964, -0.241967217, -0.240258754,
+    -0.238327639, -0.236177191, -0.233810933, -0.231232398, -0.22844531, -0.22545364,
+    -0.222261478, -0.218873278, -0.215293597, -0.211527034, -0.207578414, -0.203452753,
+    -0.199155232, -0.194691115, -0.190065641, -0.185284245, -0.180352564, -0.175276351,
+    -0.170061437, -0.164713737, -0.159239276, -0.15364421, -0.147934868, -0.142117729,
+    -0.136199392, -0.130186368, -0.124085235, -0.117902669, -0.111645416, -0.105320335,
+    -0.0989342218, -0.0924939943, -0.0860066431, -0.0794791518, -0.0729185707, -0.0663317945,
+    -0.059725595, -0.0531068852, -0.0464826182, -0.0398597151, -0.0332451052, -0.0266456186,
+    -0.0200680698, -0.0135193072, -0.00700610934, -0.000535238688, 0.00588654481, 0.0122527276,
+    0.0185568179, 0.0247923381, 0.0309529369, 0.0370324489, 0.0430248817, 0.0489242281,
+    0.0547245733, 0.0604200985, 0.0660051123, 0.0714742659, 0.0768223326, 0.0820441308,
+    0.0871346145, 0.0920888986, 0.0969022352, 0.101570095, 0.106088048, 0.110451816,
+    0.114657357, 0.118700727, 0.122578239, 0.126286481, 0.129822123, 0.133182032,
+    0.136363338, 0.139363467, 0.142180152, 0.144811151, 0.1472544, 0.14950807,
+    0.151570557, 0.15344051, 0.155116794, 0.156598492, 0.157884883, 0.158975503,
+    0.15987011, 0.160568643, 0.161071156, 0.161377948, 0.161489594, 0.161406886,
+    0.161130963, 0.160663127, 0.160004795, 0.159157645, 0.158123592, 0.156904924,
+    0.15550415, 0.153923754, 0.152166445, 0.150235164, 0.148133018, 0.145863296,
+    0.143429445, 0.140835103, 0.138084101, 0.135180481, 0.132128473, 0.12893245,
+    0.125596813, 0.122126139, 0.118525188, 0.114798853, 0.1109523, 0.106990747,
+    0.102919493, 0.0987440112, 0.0944698619, 0.090102752, 0.0856484138, 0.0811125637,
+    0.0765010684, 0.0718199248, 0.0670751436, 0.062272684, 0.0574184946, 0.0525186432,
+    0.047579289, 0.0426066856, 0.0376071601, 0.0325869867, 0.0275522918, 0.0225092466,
+    0.0174640686, 0.0124229952, 0.00739232246, 0.0023781674, -0.00261334686, -0.00757612903,
+    -0.012504156, -0.0173914204, -0.0222321094, -0.0270205275, -0.0317509592, -0.0364177546,
+    -0.0410154017, -0.0455385484, -0.0499819969, -0.0543405897, -0.0586092577, -0.0627830946,
+    -0.066857232, -0.0708269202, -0.0746876351, -0.0784349401, -0.0820645487, -0.0855723928,
+    -0.0889546326, -0.0922076686, -0.0953278934, -0.0983118453, -0.101156252, -0.103858076,
+    -0.106414637, -0.108823425, -0.111082038, -0.113188246, -0.115140034, -0.116935633,
+    -0.118573494, -0.120052198, -0.121370489, -0.122527341, -0.123521853, -0.124353396,
+    -0.125021605, -0.125526267, -0.125867388, -0.126045209, -0.12606028, -0.125913375,
+    -0.12560531, -0.125137135, -0.124510121, -0.123725771, -0.122785849, -0.121692201,
+    -0.120446861, -0.119052076, -0.117510289, -0.115824109, -0.113996312, -0.112029735,
+    -0.109927415, -0.10769264, -0.105328809, -0.102839526, -0.100228489, -0.0974994654,
+    -0.0946564153, -0.0917034974, -0.0886451586, -0.0854859286, -0.0822302972, -0.0788828723,
+    -0.075448383, -0.0719316619, -0.0683376278, -0.0646712244, -0.0609375363, -0.057141733,
+    -0.053289062, -0.0493848236, -0.0454343282, -0.0414428471, -0.0374157353, -0.0333584185,
+    -0.0292763566, -0.0251750808, -0.0210600071, -0.0169365843, -0.0128103031, -0.0086866225,
+    -0.00457113324, -0.000469290859, 0.00361360618, 0.00767220302, 0.0117011404, 0.0156952398,
+    0.0196494486, 0.0235587876, 0.027418311, 0.0312231169, 0.0349683502, 0.0386492839,
+    0.0422613368, 0.0458000615, 0.0492610724, 0.0526400572, 0.0559327739, 0.0591351608,
+    0.0622434071, 0.0652537099, 0.0681623988, 0.07096594, 0.0736608308, 0.0762438757,
+    0.0787120628, 0.0810624614, 0.0832923134, 0.0853990838, 0.0873805051, 0.0892345028,
+    0.0909590616, 0.0925522988, 0.0940125467, 0.0953381882, 0.0965278429, 0.0975804006,
+    0.0984948731, 0.0992704775, 0.099906671, 0.100403027, 0.100759347, 0.100975527,
+    0.101051636, 0.100987975, 0.100785239, 0.100444343, 0.0999662262, 0.0993519865,
+    0.0986028678, 0.0977202885, 0.0967060368, 0.0955620701, 0.0942903867, 0.0928931553,
+    0.0913727229, 0.0897314806, 0.0879720617, 0.0860972507, 0.0841099395, 0.0820131912,
+    0.0798101822, 0.0775043209, 0.0750991744, 0.0725982998, 0.0700054247, 0.0673244362,
+    0.0645593266, 0.0617142033, 0.0587931834, 0.0558004859, 0.0527404589, 0.0496175792,
+    0.0464363962, 0.0432014672, 0.0399173471, 0.0365886673, 0.0332201828, 0.0298166299,
+    0.0263827866, 0.0229233856, 0.0194431758, 0.0159469656, 0.0124396524, 0.00892630753,
+    0.00541188025, 0.00190117772, -0.00160097675, -0.00508975906, -0.00856034382, -0.0120079372,
+    -0.0154278713, -0.0188154657, -0.0221661081, -0.0254752704, -0.0287385234, -0.0319515318,
+    -0.0351100755, -0.0382099376, -0.0412469966, -0.0442172493, -0.0471168322, -0.049942093,
+    -0.0526894329, -0.0553553012, -0.0579362649, -0.0604288607, -0.0628298778, -0.0651363079,
+    -0.0673452139, -0.069453779, -0.0714594199, -0.0733597847, -0.0751526656, -0.076835942,
+    -0.0784076038, -0.079865798, -0.0812088748, -0.0824354114, -0.0835441428, -0.0845339349,
+    -0.0854037766, -0.0861527677, -0.0867802317, -0.087285756, -0.0876689696, -0.0879297009,
+    -0.0880679434, -0.0880837662, -0.0879775453, -0.0877497868, -0.0874010842, -0.0869322312,
+    -0.0863442768, -0.0856385174, -0.084816402, -0.0838794423, -0.0828292533, -0.08166767,
+    -0.0803966573, -0.0790183456, -0.0775350109, -0.0759490401, -0.0742629404, -0.072479331,
+    -0.0706010108, -0.0686309273, -0.0665720525, -0.0644275054, -0.0622005363, -0.0598945627,
+    -0.0575131343, -0.0550597716, -0.052538098, -0.0499518247, -0.0473047926, -0.0446010728,
+    -0.0418447448, -0.0390398418, -0.0361905025, -0.0333009498, -0.0303753336, -0.0274178845,
+    -0.0244328425, -0.0214244258, -0.018396927, -0.0153546619, -0.0123020366, -0.00924342706,
+    -0.00618310484, -0.0031253611, -7.45371033e-05, 0.00296496205, 0.00598879607, 0.00899276418,
+    0.0119726722, 0.0149243734, 0.0178437305, 0.0207265902, 0.0235689284, 0.0263668308,
+    0.0291164031, 0.0318138399, 0.0344555254, 0.0370379158, 0.03955761, 0.0420112663,
+    0.044395579, 0.0467073398, 0.0489433726, 0.0511007126, 0.053176573, 0.0551682223,
+    0.0570729947, 0.0588883065, 0.0606118083, 0.062241364, 0.0637749127, 0.0652105148,
+    0.0665463831, 0.0677808681, 0.0689125196, 0.0699400499, 0.0708622825, 0.0716781786,
+    0.0723868811, 0.0729877285, 0.0734802982, 0.0738642384, 0.0741393388, 0.0743055116,
+    0.0743627141, 0.0743111778, 0.0741512887, 0.0738835287, 0.0735085408, 0.0730271304,
+    0.0724403467, 0.0717493912, 0.0709555175, 0.0700600971, 0.0690647315, 0.0679712019,
+    0.0667814301, 0.0654974321, 0.064121297, 0.0626552254, 0.0611015389, 0.0594627761,
+    0.0577416301, 0.0559408005, 0.0540630867, 0.0521113682, 0.0500885541, 0.0479977614,
+    0.0458421433, 0.0436249211, 0.0413493845, 0.039018976, 0.0366372979, 0.0342079573,
+    0.0317345547, 0.029220776, 0.0266704138, 0.0240873094, 0.0214753335, 0.0188383303,
+    0.0161801347, 0.013504612, 0.0108156027, 0.00811707123, 0.00541299198, 0.00270723488,
+    3.71657232e-06, -0.00269365409, -0.00538099666, -0.00805443837, -0.0107102423, -0.01334472,
+    -0.0159541626, -0.0185347927, -0.021082808, -0.0235945489, -0.0260664773, -0.0284951251,
+    -0.0308770581, -0.0332089402, -0.035487518, -0.0377096433, -0.0398722429, -0.0419723418,
+    -0.0440071225, -0.0459737955, -0.0478697429, -0.0496924839, -0.0514395603, -0.053108594,
+    -0.0546972666, -0.0562034592, -0.057625295, -0.0589609617, -0.0602087341, -0.061366972,
+    -0.0624341016, -0.0634087661, -0.0642897889, -0.0650760716, -0.0657666396, -0.0663607515,
+    -0.0668578167, -0.067257445, -0.0675593633, -0.0677634033, -0.0678695482, -0.0678778591,
+    -0.0677886015, -0.0676022148, -0.0673192443, -0.0669402912, -0.0664660448, -0.0658974874,
+    -0.0652357486, -0.0644820258, -0.0636376716, -0.0627041579, -0.0616830684, -0.060576173,
+    -0.059385301, -0.0581123537, -0.0567594307, -0.0553287909, -0.0538228505, -0.052244174,
+    -0.0505952966, -0.0488788091, -0.0470974136, -0.0452538416, -0.0433510215, -0.0413919385,
+    -0.0393795869, -0.0373169797, -0.0352071926, -0.0330534757, -0.0308591276, -0.0286274298,
+    -0.0263617127, -0.0240654231, -0.0217420734, -0.019395176, -0.0170282487, -0.0146447809,
+    -0.0122482609, -0.00984220467, -0.00743024057, -0.00501597904, -0.0026029739, -0.000194808799,
+    0.00220502433, 0.00459307442, 0.00696585031, 0.0093200031, 0.0116522147, 0.0139591612,
+    0.0162375564, 0.018484069, 0.0206954869, 0.0228687269, 0.0250007249, 0.0270883276,
+    0.0291284662, 0.0311182108, 0.033054782, 0.0349355196, 0.0367578566, 0.0385192932,
+    0.0402173206, 0.0418495567, 0.0434137962, 0.0449079078, 0.0463299023, 0.0476778811,
+    0.0489500647, 0.0501448658, 0.0512607836, 0.0522964193, 0.0532504166, 0.0541214827,
+    0.0549085352, 0.0556106408, 0.056226953, 0.056756724, 0.0571993591, 0.0575544364,
+    0.0578217011, 0.0580009855, 0.0580922411, 0.0580956247, 0.0580113511, 0.0578398243,
+    0.0575815933, 0.0572372446, 0.0568074613, 0.056293031, 0.055694975, 0.0550145195,
+    0.0542529582, 0.0534116291, 0.0524919018, 0.0514952584, 0.0504233783, 0.0492780531,
+    0.0480611299, 0.0467745428, 0.0454203406, 0.0440007095, 0.0425179464, 0.0409744015,
+    0.0393725231, 0.0377149065, 0.0360041522, 0.0342429815, 0.032434159, 0.03058048,
+    0.0286847288, 0.0267497237, 0.0247784984, 0.0227741078, 0.0207395622, 0.0186779249,
+    0.0165922763, 0.0144857246, 0.0123614507, 0.0102225903, 0.00807225129, 0.0059136269,
+    0.00374995474, 0.00158451834, -0.000579377923, -0.00273855265, -0.00488982655, -0.00702999486,
+    -0.00915588259, -0.0112642765, -0.0133520354, -0.0154161487, -0.0174537272, -0.0194619239,
+    -0.0214378105, -0.0233785522, -0.0252813815, -0.0271435748, -0.0289624363, -0.0307353123,
+    -0.0324596742, -0.0341331342, -0.0357533861, -0.0373181511, -0.0388252161, -0.0402723831,
+    -0.0416575894, -0.0429789317, -0.0442345684, -0.0454228041, -0.046542042, -0.0475907836,
+    -0.0485677428, -0.0494717178, -0.0503016084, -0.0510564148, -0.0517351638, -0.0523370595,
+    -0.0528614825, -0.0533078759, -0.0536756707, -0.0539644092, -0.05417385, -0.0543039032,
+    -0.0543546103, -0.0543261143, -0.0542186734, -0.0540325563, -0.0537682078, -0.0534262201,
+    -0.0530072707, -0.0525121837, -0.0519418758, -0.0512973972, -0.0505799677, -0.0497908631,
+    -0.0489314504, -0.0480031503, -0.0470074702, -0.0459460998, -0.0448208188, -0.0436334056,
+    -0.0423856459, -0.041079448, -0.0397168932, -0.0383001771, -0.0368315497, -0.0353133354,
+    -0.0337479506, -0.0321378225, -0.0304854888, -0.0287935288, -0.0270645289, -0.0253011611,
+    -0.023506095, -0.0216821623, -0.019832262, -0.0179592508, -0.0160659629, -0.0141552337,
+    -0.0122299221, -0.010292968, -0.00834731267, -0.00639583694, -0.00444137546, -0.00248681681,
+    -0.000535082204, 0.00141093998, 0.00334841648, 0.00527445065, 0.00718613962, 0.00908061752,
+    0.0109550087, 0.0128065372, 0.0146325423, 0.01643043, 0.018197676, 0.0199316353,
+    0.0216297327, 0.0232895204, 0.0249086506, 0.02648484, 0.0280158279, 0.0294994238,
+    0.0309335663, 0.0323162792, 0.0336456414, 0.0349198209, 0.036137002, 0.0372954488,
+    0.0383935895, 0.0394298681, 0.0404027557, 0.0413108698, 0.0421529372, 0.0429278391,
+    0.0436345786, 0.0442723172, 0.0448402767, 0.0453376858, 0.0457639719, 0.0461187077,
+    0.0464015442, 0.0466122147, 0.0467505065, 0.0468163825, 0.0468099884, 0.0467315853,
+    0.046581429, 0.046359869, 0.0460672996, 0.0457042702, 0.0452715078, 0.0447698538,
+    0.0442002274, 0.043563596, 0.0428610239, 0.0420937117, 0.0412629468, 0.0403702237,
+    0.0394171096, 0.0384051892, 0.0373362046, 0.0362119487, 0.0350341901, 0.0338047342,
+    0.0325254809, 0.0311985125, 0.0298260139, 0.0284101665, 0.0269531288, 0.0254571516,
+    0.0239245128, 0.0223576114, 0.0207589199, 0.0191308714, 0.0174759389, 0.0157966061,
+    0.0140954658, 0.0123752177, 0.0106385884, 0.00888829636, 0.00712702021, 0.00535744977,
+    0.00358231342, 0.00180433643, 2.62019537e-05, -0.00174951296, -0.00352021515, -0.00528322641,
+    -0.00703590563, -0.00877566292, -0.0104998807, -0.0122059635, -0.0138913821, -0.0155536085,
+    -0.0171902113, -0.0187988205, -0.0203770508, -0.0219226223, -0.0234331818, -0.0249064467,
+    -0.0263403161, -0.0277327624, -0.0290818015, -0.0303854907, -0.0316419027, -0.0328492132,
+    -0.0340058127, -0.0351102218, -0.0361609649, -0.0371566035, -0.0380957871, -0.0389772584,
+    -0.0397997984, -0.0405622616, -0.0412635927, -0.0419028468, -0.0424792345, -0.0429920539,
+    -0.0434406949, -0.0438246499, -0.044143379, -0.0443965101, -0.0445838341, -0.0447052655,
+    -0.04476081, -0.0447504758, -0.0446743889, -0.0445328294, -0.0443261818, -0.0440549263,
+    -0.04371966, -0.0433210065, -0.0428597131, -0.0423366822, -0.0417527783, -0.0411089031,
+    -0.0404060951, -0.0396454861, -0.038828338, -0.0379560298, -0.0370300459, -0.0360518985,
+    -0.0350231151, -0.033945361, -0.0328203957, -0.0316500686, -0.0304362295, -0.0291807494,
+    -0.0278856852, -0.026553176, -0.0251853564, -0.0237843731, -0.0223523937, -0.0208916037,
+    -0.0194043146, -0.0178928967, -0.016359645, -0.0148068788, -0.0132368822, -0.0116519972,
+    -0.0100546637, -0.00844734752, -0.00683258911, -0.00521291376, -0.00359080082, -0.00196877089,
+    -0.000349327183, 0.00126509937, 0.00287212052, 0.00446934421, 0.0060543076, 0.00762456851,
+    0.00917776525, 0.0107116503, 0.012223966, 0.0137124854, 0.0151749975, 0.0166093377,
+    0.0180134154, 0.0193852087, 0.0207227723, 0.0220241033, 0.0232872631, 0.0245104181,
+    0.0256917407, 0.026829503, 0.0279220219, 0.028967626, 0.0299647587, 0.0309120505,
+    0.031808274, 0.0326522361, 0.0334427318, 0.0341786403, 0.0348589872, 0.0354829062,
+    0.0360495815, 0.0365582827, 0.0370083602, 0.0373992732, 0.0377305401, 0.0380017757,
+    0.0382127398, 0.0383631868, 0.0384530096, 0.0384822537, 0.0384509985, 0.0383594044,
+    0.0382076649, 0.0379960756, 0.0377250892, 0.0373953387, 0.0370075602, 0.0365625289,
+    0.036061048, 0.0355040249, 0.0348925082, 0.0342275607, 0.0335102747, 0.0327418205,
+    0.0319234737, 0.0310566268, 0.0301427339, 0.0291833103, 0.0281799192, 0.0271340856,
+    0.026047461, 0.0249218014, 0.023758944, 0.0225607557, 0.0213290738, 0.0200658323,
+    0.0187730483, 0.017452808, 0.0161072409, 0.0147384705, 0.0133486443, 0.0119399925,
+    0.0105147681, 0.00907511502, 0.00762319727, 0.00616118552, 0.00469130062, 0.00321581851,
+    0.00173699264, 0.000257075619, -0.00122169872, -0.00269713494, -0.00416697321, -0.00562893758,
+    -0.0070807596, -0.00852026775, -0.0099453607, -0.0113538583, -0.0127435982, -0.014112491,
+    -0.0154584982, -0.016779597, -0.0180738135, -0.019339175, -0.0205737732, -0.0217758716,
+    -0.022943809, -0.0240759831, -0.0251707806, -0.0262265914, -0.027241889, -0.0282151786,
+    -0.0291450824, -0.0300302859, -0.0308695197, -0.031661564, -0.0324052869, -0.0330996942,
+    -0.0337438554, -0.0343368062, -0.0348777076, -0.0353658867, -0.0358007631, -0.0361818063,
+    -0.0365085478, -0.0367805615, -0.0369975349, -0.0371593152, -0.0372658175, -0.03731707,
+    -0.0373131114, -0.03725408, -0.037140207, -0.036971749, -0.0367490432, -0.0364724657,
+    -0.0361424692, -0.0357596407, -0.0353247106, -0.0348385369, -0.034301985, -0.0337159254,
+    -0.0330813311, -0.0323993475, -0.031671204, -0.0308981412, -0.0300814287, -0.0292224153,
+    -0.0283225374, -0.0273832748, -0.0264062079, -0.0253929982, -0.0243452527, -0.0232646714,
+    -0.0221530121, -0.0210120036, -0.0198434327, -0.0186490778, -0.0174307792, -0.0161904776,
+    -0.0149302029, -0.0136519939, -0.0123578585, -0.011049797, -0.0097298616, -0.00840019274,
+    -0.007062879, -0.00571995313, -0.00437346181, -0.0030254964, -0.00167814549, -0.000333431667,
+    0.00100663771, 0.00234008824, 0.00366498294, 0.00497930775, 0.00628104217, 0.00756820821,
+    0.00883891505, 0.010091407, 0.0113238804, 0.0125345236, 0.0137215044, 0.0148830245,
+    0.0160173546, 0.0171228122, 0.0181977227, 0.0192404812, 0.020249608, 0.021223678,
+    0.0221613382, 0.0230612354, 0.0239220472, 0.0247426107, 0.0255217914, 0.0262585136,
+    0.0269517855, 0.0276006267, 0.0282040858, 0.0287613119, 0.0292715988, 0.0297343145,
+    0.0301488174, 0.0305145261, 0.0308309536, 0.0310977182, 0.0313144955, 0.0314809748,
+    0.0315969306, 0.0316622574, 0.0316770322, 0.0316414291, 0.0315556967, 0.0314200507,
+    0.0312347869, 0.0310003286, 0.0307171396, 0.030385797, 0.030006935, 0.0295812151,
+    0.0291093496, 0.0285921131, 0.0280304183, 0.0274252204, 0.0267774631, 0.0260882037,
+    0.0253586453, 0.0245900242, 0.0237835885, 0.0229406227, 0.0220624373, 0.0211504498,
+    0.0202062068, 0.0192312724, 0.0182272559, 0.0171957668, 0.01613846, 0.0150570339,
+    0.0139531947, 0.0128286761, 0.0116851726, 0.0105244505, 0.00934830902, 0.00815857646,
+    0.0069571469, 0.00574585223, 0.00452647043, 0.00330087683, 0.00207105398, 0.00083895732,
+    -0.000393515366, -0.00162450869, -0.00285216132, -0.00407456755, -0.00528984299, -0.00649610979,
+    -0.00769149147, -0.00887418168, -0.0100423533, -0.0111942171, -0.0123280729, -0.0134422596,
+    -0.0145352117, -0.0156053477, -0.016651072, -0.0176708047, -0.0186630295, -0.0196263176,
+    -0.0205592843, -0.0214605577, -0.0223287116, -0.023162414, -0.0239604692, -0.0247217355,
+    -0.0254450852, -0.02612948, -0.0267740001, -0.0273777335, -0.0279398473, -0.0284595621,
+    -0.0289361126, -0.0293688496, -0.0297572344, -0.0301008418, -0.0303993801, -0.030652513,
+    -0.0308599136, -0.0310213283, -0.0311365891, -0.0312056198, -0.0312283916, -0.0312049101,
+    -0.03113524, -0.0310196169, -0.0308583726, -0.0306518961, -0.0304005703, -0.0301048531,
+    -0.0297653681, -0.0293827805, -0.0289578278, -0.0284913128, -0.0279840477, -0.0274368706,
+    -0.0268506862, -0.0262265348, -0.0255655, -0.0248686674, -0.0241371831, -0.0233722385,
+    -0.0225750846, -0.0217469951, -0.0208892271, -0.0200030926, -0.0190900082, -0.0181514772,
+    -0.0171890194, -0.0162041697, -0.0151984311, -0.0141733889, -0.0131307477, -0.0120721963,
+    -0.0109994466, -0.009914171, -0.00881801739, -0.00771264186, -0.00659973372, -0.00548106041,
+    -0.00435835189, -0.00323329259, -0.00210759017, -0.000983008811, 0.000138702788, 0.0012558626,
+    0.00236684761, 0.00347001695, 0.00456367084, 0.00564609127, 0.00671560084, 0.00777054953,
+    0.00880937426, 0.00983050468, 0.0108323512, 0.0118133903, 0.0127721415, 0.0137072028,
+    0.0146171777, 0.015500771, 0.0163567491, 0.0171838656, 0.0179809844, 0.018747018,
+    0.0194808273, 0.020181256, 0.0208472705, 0.0214779568, 0.0220724917, 0.0226300657,
+    0.0231498443, 0.02363108, 0.0240730869, 0.02447522, 0.0248369161, 0.025157653,
+    0.0254369724, 0.0256745389, 0.0258701257, 0.026023607, 0.0261348378, 0.0262037278,
+    0.0262302293, 0.0262143858, 0.0261563781, 0.0260564391, 0.0259147975, 0.0257316715,
+    0.0255073707, 0.0252423449, 0.0249370959, 0.0245921564, 0.0242081205, 0.0237857053,
+    0.0233256347, 0.0228287006, 0.0222957192, 0.0217275542, 0.0211252081, 0.0204897317,
+    0.0198222367, 0.0191239101, 0.0183958919, 0.0176393289, 0.0168554836, 0.0160456874,
+    0.0152112787, 0.0143535774, 0.0134739072, 0.012573562, 0.0116539618, 0.0107165985,
+    0.00976293264, 0.00879438252, 0.00781246213, 0.00681878401, 0.00581493558, 0.00480254237,
+    0.00378318549, 0.00275838689, 0.0017296971, 0.000698691778, -0.000332971721, -0.00136362239,
+    -0.00239164389, -0.00341547404, -0.00443355234, -0.00544432518, -0.00644628733, -0.00743797208,
+    -0.00841788842, -0.00938455164, -0.0103364732, -0.0112722371, -0.0121904893, -0.0130899102,
+    -0.013969107, -0.0148266441, -0.0156611633, -0.0164714025, -0.0172562136, -0.0180144505,
+    -0.0187449878, -0.0194467618, -0.0201186757, -0.0207597714, -0.021369215, -0.0219461793,
+    -0.0224898129, -0.0229993326, -0.0234740504, -0.023913385, -0.0243168202, -0.0246838146,
+    -0.0250138711, -0.0253065587, -0.0255614834, -0.0257783376, -0.0259568469, -0.0260967515,
+    -0.0261978997, -0.0262602, -0.0262836157, -0.0262681536, -0.0262139599, -0.0261212458,
+    -0.0259902773, -0.0258214353, -0.0256150784, -0.0253715449, -0.0250912172, -0.024774575,
+    -0.0244222624, -0.0240350049, -0.0236134669, -0.0231582601, -0.022670124, -0.0221498558,
+    -0.02159832, -0.0210164577, -0.0204052052, -0.0197655132, -0.0190983956, -0.0184049441,
+    -0.0176863149, -0.0169436674, -0.0161782466, -0.0153913327, -0.0145842181, -0.0137582499,
+    -0.0129147555, -0.0120550367, -0.0111803808, -0.0102921656, -0.00939184359, -0.00848084635,
+    -0.00756057088, -0.00663241405, -0.00569785827, -0.00475836385, -0.00381538569, -0.00287033619,
+    -0.00192464337, -0.000979785545, -3.72351283e-05, 0.000901505715, 0.00183495116, 0.00276170409,
+    0.00368036065, 0.00458947015, 0.00548755804, 0.00637317732, 0.00724496283, 0.00810162764,
+    0.00894195582, 0.00976469855, 0.0105686197, 0.0113525505, 0.0121153837, 0.0128559801,
+    0.0135731578, 0.0142658256, 0.014932971, 0.0155736608, 0.0161869883, 0.0167720303,
+    0.0173279155, 0.0178537542, 0.0183487507, 0.0188122119, 0.0192435129, 0.0196420282,
+    0.0200071663, 0.0203384409, 0.0206354417, 0.0208978081, 0.0211252442, 0.021317491,
+    0.0214743559, 0.0215957536, 0.0216816345, 0.0217318913, 0.0217464277, 0.0217252549,
+    0.0216684506, 0.0215762142, 0.0214487594, 0.0212863259, 0.0210892497, 0.0208578808,
+    0.0205926607, 0.0202941134, 0.0199628113, 0.0195993108, 0.0192042363, 0.0187783405,
+    0.0183224318, 0.0178373104, 0.0173237664, 0.01678267, 0.0162149899, 0.0156217377,
+    0.0150039509, 0.0143626053, 0.0136986587, 0.0130131323, 0.0123071363, 0.0115818327,
+    0.0108383973, 0.0100780683, 0.00930210022, 0.00851172511, 0.00770823694, 0.00689290767,
+    0.00606702304, 0.00523186869, 0.00438877359, 0.0035391513, 0.00268438967, 0.00182579469,
+    0.000964636277, 0.000102265918, -0.000759979265, -0.00162075799, -0.0024787637, -0.00333274819,
+    -0.0041814458, -0.00502357448, -0.00585786257, -0.00668306474, -0.00749799114, -0.0083014087,
+    -0.00909205659, -0.0098686531, -0.0106299242, -0.011374696, -0.0121018868, -0.0128104785,
+    -0.0134994218, -0.014167637, -0.0148140978, -0.01543788, -0.0160381358, -0.0166139727,
+    -0.0171645438, -0.0176890813, -0.0181868606, -0.018657171, -0.019099333, -0.0195127549,
+    -0.0198968485, -0.0202511181, -0.0205751202, -0.0208683753, -0.0211304184, -0.021360832,
+    -0.021559294, -0.0217255912, -0.0218596028, -0.0219612476, -0.0220304467, -0.0220671573,
+    -0.022071455, -0.0220434881, -0.0219834033, -0.0218913037, -0.0217674064, -0.0216120097,
+    -0.0214254917, -0.0212082277, -0.0209605929, -0.0206830197, -0.0203759466, -0.0200399127,
+    -0.0196755344, -0.019283461, -0.0188643225, -0.0184187541, -0.0179474686, -0.0174512588,
+    -0.0169309628, -0.0163874613, -0.0158216735, -0.0152345992, -0.0146272634, -0.0140006987,
+    -0.0133558718, -0.0126937415, -0.0120153354, -0.01132177, -0.0106141907, -0.0098936847,
+    -0.00916135411, -0.00841837131, -0.00766588108, -0.00690508611, -0.00613720126, -0.0053634228,
+    -0.00458490951, -0.00380284816, -0.00301851862, -0.00223318358, -0.00144807965, -0.000664400124,
+    0.000116620573, 0.000893719803, 0.00166562393, 0.00243111445, 0.00318907466, 0.00393841046,
+    0.00467801298, 0.00540676476, 0.00612356534, 0.00682737917, 0.00751718132, 0.00819194544,
+    0.00885067726, 0.00949238389, 0.0101161071, 0.0107208902, 0.011305849, 0.0118701132,
+    0.0124127873, 0.0129330828, 0.0134303107, 0.0139038112, 0.0143528557, 0.0147767268,
+    0.0151747602, 0.0155464079, 0.0158912306, 0.0162088041, 0.0164987528, 0.0167607218,
+    0.0169944028, 0.0171995563, 0.0173759195, 0.0175232267, 0.0176412444, 0.0177298082,
+    0.0177888313, 0.0178182835, 0.017818202, 0.0177886158, 0.0177295566, 0.0176411532,
+    0.0175236527, 0.0173773442, 0.017202471, 0.0169993436, 0.0167683655, 0.0165099813,
+    0.0162246783, 0.0159129588, 0.0155753879, 0.0152125554, 0.0148251407, 0.0144138026,
+    0.0139791718, 0.0135219039, 0.013042655, 0.0125421824, 0.0120213521, 0.0114810494,
+    0.0109221492, 0.0103455302, 0.00975208624, 0.0091427982, 0.00851873729, 0.00788095466,
+    0.00723043513, 0.00656823452, 0.00589544018, 0.00521313952, 0.00452238151, 0.00382420466,
+    0.00311972139, 0.00241005381, 0.00169636006, 0.000979783103, 0.000261427374, -0.000457664805,
+    -0.00117646278, -0.00189385549, -0.00260873695, -0.00331998783, -0.00402649054, -0.00472713012,
+    -0.00542076217, -0.00610623649, -0.00678245091, -0.00744839476, -0.00810308898, -0.00874552335,
+    -0.0093746431, -0.00998943326, -0.0105890164, -0.0111725328, -0.0117391014, -0.0122878986,
+    -0.0128180702, -0.0133287839, -0.0138192774, -0.0142888559, -0.0147368682, -0.0151626612,
+    -0.0155656233, -0.01594517, -0.0163007865, -0.0166319137, -0.0169379719, -0.0172184815,
+    -0.0174730673, -0.0177014509, -0.0179033934, -0.0180786666, -0.0182270322, -0.0183483447,
+    -0.0184425808, -0.0185097142, -0.0185497224, -0.0185626276, -0.0185484807, -0.018507374,
+    -0.0184394265, -0.0183448442, -0.0182238457, -0.0180766466, -0.0179035697, -0.0177050054,
+    -0.0174813474, -0.0172329414, -0.0169601379, -0.0166633617, -0.016343147, -0.0160001232,
+    -0.0156348983, -0.0152481413, -0.0148405246, -0.0144127683, -0.0139656382, -0.0134998792,
+    -0.0130162226, -0.0125154408, -0.0119983655, -0.0114658435, -0.0109187262, -0.0103578834,
+    -0.0097841504, -0.00919838214, -0.00860152589, -0.00799458939, -0.00737858965, -0.00675445354,
+    -0.00612312422, -0.00548560264, -0.00484292088, -0.00419609411, -0.00354612147, -0.00289405051,
+    -0.00224095647, -0.00158795109, -0.000936088731, -0.000286350765, 0.000360301138, 0.00100296431,
+    0.0016406667, 0.00227242322, 0.00289729484, 0.00351437233, 0.00412274973, 0.0047215352,
+    0.00530979785, 0.0058865513, 0.0064508952, 0.00700202198, 0.00753908431, 0.00806123436,
+    0.00856767819, 0.00905767772, 0.00953053352, 0.00998551326, 0.0104219009, 0.0108390153,
+    0.0112362644, 0.0116131156, 0.0119691023, 0.0123038012, 0.0126167215, 0.0129074351,
+    0.0131755688, 0.0134207904, 0.0136427808, 0.0138412269, 0.0140158215, 0.014166291,
+    0.0142924776, 0.0143942679, 0.0144715262, 0.0145241312, 0.0145520576, 0.0145554167,
+    0.0145343231, 0.0144888559, 0.0144191144, 0.0143252169, 0.0142073483, 0.0140657613,
+    0.0139007866, 0.0137128, 0.0135021567, 0.0132692332, 0.013014424, 0.0127381716,
+    0.0124408841, 0.0121229592, 0.0117849027, 0.0114272731, 0.0110506829, 0.0106557385,
+    0.0102430571, 0.00981325752, 0.00936708079, 0.00890535091, 0.00842885302, 0.00793836091,
+    0.00743466861, 0.00691859059, 0.00639099143, 0.00585273123, 0.00530469451, 0.00474775748,
+    0.00418280134, 0.00361076135, 0.003032617, 0.00244933928, 0.00186179497, 0.00127081563,
+    0.00067730486, 8.22180041e-05, -0.000513458555, -0.00110878571, -0.00170280587, -0.00229459046,
+    -0.00288318059, -0.00346758478, -0.00404687223, -0.00462014978, -0.00518651857, -0.00574506485,
+    -0.00629497728, -0.0068354827, -0.00736579969, -0.00788518623, -0.00839287302, -0.00888803872,
+    -0.00936990869, -0.0098377797, -0.0102910539, -0.0107291516, -0.0111514445, -0.0115572588,
+    -0.0119459889, -0.0123170994, -0.0126700207, -0.0130041924, -0.013319077, -0.0136141827,
+    -0.0138891022, -0.0141434736, -0.014376983, -0.014589284, -0.0147801048, -0.0149492462,
+    -0.015096558, -0.0152219292, -0.0153252373, -0.015406355, -0.0154651345, -0.0155015246,
+    -0.0155155684, -0.0155073187, -0.0154768116, -0.0154241413, -0.0153494895, -0.015253052,
+    -0.0151349631, -0.0149953946, -0.0148345764, -0.014652826, -0.0144505186, -0.0142280705,
+    -0.0139859198, -0.0137244702, -0.0134442073, -0.0131456592, -0.0128293886, -0.0124959401,
+    -0.0121458424, -0.0117796319, -0.0113978499, -0.0110011191, -0.0105900749, -0.010165295,
+    -0.00972739353, -0.00927708264, -0.00881515974, -0.00834239911, -0.0078595386, -0.00736726451,
+    -0.00686630482, -0.00635747131, -0.0058415872, -0.00531952037, -0.00479218355, -0.00426041884,
+    -0.00372507022, -0.00318701558, -0.00264713777, -0.00210625396, -0.00156517671, -0.0010247628,
+    -0.000485841772, 5.07368993e-05, 0.000584178147, 0.00111369909, 0.00163849592, 0.00215767933,
+    0.00267032892, 0.00317562267, 0.00367280966, 0.00416115183, 0.00463988354, 0.00510823966,
+    0.00556549726, 0.00601094311, 0.0064439134, 0.00686374711, 0.0072697965, 0.00766143161,
+    0.00803806003, 0.00839920597, 0.00874444056, 0.00907326505, 0.00938519773, 0.00967979055,
+    0.00995666984, 0.010215487, 0.0104559224, 0.0106775923, 0.0108801126, 0.0110631876,
+    0.0112265427, 0.0113699369, 0.0114931558, 0.011596075, 0.0116786344, 0.0117407881,
+    0.0117824976, 0.0118037103, 0.0118044, 0.0117845663, 0.0117442954, 0.0116838012,
+    0.0116032901, 0.0115029218, 0.0113828651, 0.0112433723, 0.0110847644, 0.0109073211,
+    0.010711311, 0.0104970359, 0.0102648435, 0.0100151374, 0.00974835477, 0.00946495807,
+    0.00916537197, 0.00885013127, 0.00851984313, 0.00817513185, 0.00781664309, 0.00744499059,
+    0.00706078183, 0.00666462369, 0.00625719682, 0.00583921775, 0.00541140213, 0.00497443936,
+    0.00452901459, 0.00407590006, 0.00361585705, 0.00314954476, 0.00267763713, 0.00220087246,
+    0.0017200085, 0.00123582612, 0.00074911509, 0.000260634681, -0.000228870085, -0.000718551935,
+    -0.00120756647, -0.001695063, -0.00218023214, -0.00266235718, -0.00314073563, -0.00361467062,
+    -0.00408343126, -0.00454629732, -0.00500259606, -0.00545167263, -0.00589284552, -0.00632539094,
+    -0.00674868408, -0.00716217128, -0.00756531612, -0.0079575282, -0.00833818459, -0.00870671416,
+    -0.00906257168, -0.00940524092, -0.0097342479, -0.0100491155, -0.0103493482, -0.0106344786,
+    -0.0109041198, -0.0111579236, -0.0113955437, -0.011616701, -0.0118211171, -0.0120086096,
+    -0.0121790212, -0.0123321554, -0.0124677678, -0.0125856098, -0.0126855156, -0.0127674056,
+    -0.0128312415, -0.0128769343, -0.0129044212, -0.0129137151, -0.012904817, -0.0128777496,
+    -0.0128325559, -0.0127693146, -0.0126881227, -0.0125891227, -0.0124725686, -0.0123387207,
+    -0.0121877905, -0.0120200401, -0.0118358054, -0.0116354932, -0.011419519, -0.0111882764,
+    -0.0109420838, -0.0106812669, -0.0104062598, -0.0101175075, -0.00981548028, -0.00950065581,
+    -0.00917356735, -0.00883478653, -0.00848488798, -0.00812442071, -0.00775391771, -0.00737398937,
+    -0.00698524327, -0.00658833414, -0.00618399729, -0.00577289999, -0.00535564863, -0.00493288593,
+    -0.00450532713, -0.00407372872, -0.00363879991, -0.00320119045, -0.00276152759, -0.00232046075,
+    -0.00187864493, -0.00143672442, -0.000995359122, -0.000555183433, -0.000116908037, 0.000318709984,
+    0.000750946958, 0.00117912343, 0.00160261102, 0.00202077237, 0.00243299306, 0.00283860391,
+    0.00323692039, 0.00362730717, 0.00400916872, 0.0043819394, 0.0047449941, 0.00509776818,
+    0.00543980426, 0.00577065499, 0.00608982326, 0.00639681477, 0.00669116587, 0.00697247252,
+    0.00724040443, 0.00749462169, 0.00773470581, 0.00796024898, 0.00817084628, 0.00836613853,
+    0.0085458759, 0.00870980507, 0.00885771049, 0.00898938208, 0.00910465788, 0.00920341377,
+    0.00928557522, 0.0093510703, 0.00939979114, 0.00943172495, 0.00944694445, 0.0094455152,
+    0.00942745093, 0.00939278504, 0.00934163818, 0.00927415696, 0.00919050691, 0.00909084927,
+    0.00897532182, 0.00884405873, 0.00869722245, 0.00853507261, 0.00835789683, 0.00816599521,
+    0.00795972359, 0.00773946416, 0.00750567755, 0.00725883452, 0.00699934727, 0.00672759902,
+    0.00644396193, 0.00614891621, 0.00584302087, 0.00552683656, 0.00520084157, 0.00486554057,
+    0.00452149319, 0.00416922685, 0.00380929, 0.00344222837, 0.00306861674, 0.00268903303,
+    0.00230407966, 0.00191440474, 0.00152063587, 0.00112339366, 0.000723323916, 0.000321122553,
+    -8.24654096e-05, -0.000486744742, -0.000891091729, -0.00129489996, -0.00169755801, -0.00209839921,
+    -0.00249677863, -0.00289208481, -0.00328377492, -0.00367125954, -0.00405389726, -0.00443107297,
+    -0.00480221339, -0.00516678518, -0.00552421334, -0.00587397403, -0.00621552251, -0.00654828437,
+    -0.00687176395, -0.0071855189, -0.00748907866, -0.00778191424, -0.00806348238, -0.00833333306,
+    -0.00859108284, -0.00883641219, -0.00906900079, -0.0092885477, -0.00949477707, -0.00968744331,
+    -0.00986629949, -0.01003106, -0.0101814497, -0.0103172681, -0.0104383724, -0.0105446421,
+    -0.0106359026, -0.0107120131, -0.0107728344, -0.0108182622, -0.0108482838, -0.0108629097,
+    -0.0108621662, -0.0108460046, -0.0108144378, -0.0107675796, -0.0107055989, -0.0106286324,
+    -0.0105368231, -0.0104303867, -0.010309612, -0.0101748119, -0.0100262807, -0.00986426968,
+    -0.00968901491, -0.00950075697, -0.00929982689, -0.00908661478, -0.00886147561, -0.00862482133,
+    -0.00837705344, -0.00811857881, -0.00784984888, -0.00757135225, -0.00728357053, -0.00698695493,
+    -0.00668205384, -0.00636944634, -0.00604966898, -0.00572321009, -0.00539058954, -0.00505242097,
+    -0.00470934336, -0.00436196741, -0.00401081182, -0.00365635378, -0.00329907788, -0.00293948525,
+    -0.00257815246, -0.00221564767, -0.00185252064, -0.00148931293, -0.00112658177, -0.000764937977,
+    -0.000404975815, -4.72474764e-05, 0.000307690577, 0.000659321576, 0.00100705351, 0.00135027435,
+    0.0016884459, 0.0020211228, 0.00234783879, 0.00266808697, 0.00298137297, 0.00328719945,
+    0.00358513177, 0.00387471214, 0.00415552141, 0.00442719466, 0.00468935603, 0.00494165703,
+    0.005183767, 0.00541531859, 0.00563588627, 0.00584504274, 0.00604246197, 0.00622787682,
+    0.00640106581, 0.00656179838, 0.0067097986, 0.00684482627, 0.00696672713, 0.00707541405,
+    0.0071707696, 0.00725263949, 0.00732094044, 0.0073756455, 0.00741674849, 0.00744421088,
+    0.00745805156, 0.0074582781, 0.00744491308, 0.007418066, 0.00737782183, 0.00732426695,
+    0.00725743171, 0.00717733308, 0.00708409609, 0.00697793775, 0.00685907327, 0.00672771596,
+    0.00658412231, 0.00642857244, 0.00626138071, 0.00608288785, 0.00589340131, 0.00569322737,
+    0.005482743, 0.00526235946, 0.00503247216, 0.00479340268, 0.00454551874, 0.00428918447,
+    0.00402481662, 0.00375289201, 0.00347388546, 0.00318825743, 0.0028963893, 0.00259868898,
+    0.00229565706, 0.00198781751, 0.00167567124, 0.00135971586, 0.00104053774, 0.000718739841,
+    0.000394900574, 6.95351685e-05, -0.000256888822, -0.000583904035, -0.000910997009, -0.00123759476,
+    -0.00156318174, -0.00188729526, -0.00220945598, -0.00252920327, -0.00284604625, -0.00315945098,
+    -0.00346891631, -0.0037739529, -0.00407413405, -0.00436898267, -0.00465800011, -0.00494072295,
+    -0.00521676081, -0.00548572499, -0.00574714559, -0.00600054794, -0.00624549651, -0.00648163324,
+    -0.00670860963, -0.00692611011, -0.00713387145, -0.00733160345, -0.00751906309, -0.00769603054,
+    -0.0078622756, -0.00801754653, -0.00816160468, -0.00829428789, -0.0084154521, -0.00852494214,
+    -0.00862263013, -0.00870829442, -0.00878174736, -0.00884295206, -0.00889195045, -0.008928726,
+    -0.00895320584, -0.00896529845, -0.00896495898, -0.00895227638, -0.0089273503, -0.00889030185,
+    -0.0088413081, -0.00878049774, -0.00870800755, -0.00862399394, -0.00852864477, -0.00842210157,
+    -0.00830452437, -0.00817612483, -0.00803709898, -0.00788766203, -0.00772803567, -0.00755843355,
+    -0.00737916117, -0.00719058218, -0.00699305164, -0.00678690131, -0.00657242731, -0.00634998389,
+    -0.00612002641, -0.00588302154, -0.00563932387, -0.00538934206, -0.00513349691, -0.00487222046,
+    -0.00460602323, -0.0043353926, -0.0040607597, -0.00378246733, -0.00350085619, -0.00321637186,
+    -0.00292950157, -0.00264072956, -0.00235048303, -0.00205919455, -0.00176730165, -0.00147529408,
+    -0.00118367714, -0.000892929636, -0.00060352509, -0.000315959471, -3.07033979e-05, 0.000251843246,
+    0.000531329259, 0.00080735137, 0.00107947915, 0.00134723413, 0.00161016621, 0.00186791407,
+    0.00212011526, 0.00236648094, 0.00260671367, 0.002840421, 0.00306722684, 0.00328683681,
+    0.00349897939, 0.00370326876, 0.00389932655, 0.00408679387, 0.00426536086, 0.00443478007,
+    0.00459483088, 0.00474522801, 0.00488567309, 0.00501598233, 0.00513600898, 0.00524561572,
+    0.00534472327, 0.00543320394, 0.00551091419, 0.0055777611, 0.00563364781, 0.00567856066,
+    0.00571246978, 0.00573533715, 0.00574716044, 0.00574799561, 0.00573786146, 0.00571671286,
+    0.0056845407, 0.00564142221, 0.00558751325, 0.00552294839, 0.00544782783, 0.00536227935,
+    0.00526643289, 0.00516053129, 0.00504485747, 0.004919698, 0.00478529936, 0.00464189206,
+    0.00448973845, 0.00432908927, 0.00416020712, 0.00398337382, 0.00379882361, 0.0036068424,
+    0.00340780144, 0.0032020907, 0.00299007077, 0.00277200339, 0.00254814682, 0.00231886072,
+    0.00208457446, 0.00184566457, 0.00160255855, 0.00135572777, 0.00110559142, 0.000852606396,
+    0.000597211675, 0.000339842992, 8.08873574e-05, -0.000179255764, -0.000440124178, -0.000701300364,
+    -0.00096239049, -0.00122304388, -0.00148292367, -0.00174163873, -0.00199873222, -0.0022537535,
+    -0.00250631007, -0.0027560624, -0.00300264271, -0.00324563808, -0.00348465417, -0.00371937672,
+    -0.00394945998, -0.00417452029, -0.00439415751, -0.00460798551, -0.00481569371, -0.00501699016,
+    -0.00521166987, -0.00539950693, -0.00558019776, -0.0057534829, -0.00591914474, -0.00607702411,
+    -0.00622696597, -0.0063687654, -0.00650216819, -0.00662695726, -0.0067429608, -0.00685000959,
+    -0.00694794875, -0.00703661165, -0.00711587769, -0.00718569388, -0.00724596268, -0.00729655656,
+    -0.00733736368, -0.00736833945, -0.00738948182, -0.00740079635, -0.00740236635, -0.00739422791,
+    -0.00737637463, -0.00734887429, -0.00731185338, -0.00726548016, -0.0072098434, -0.00714500586,
+    -0.00707105615, -0.00698812371, -0.00689633621, -0.00679580596, -0.00668662661, -0.00656890784,
+    -0.00644291598, -0.00630894544, -0.00616727755, -0.00601818482, -0.00586187969, -0.00569860457,
+    -0.00552864517, -0.00535227011, -0.00516982327, -0.0049816441, -0.00478802985, -0.0045893107,
+    -0.00438586253, -0.00417801286, -0.00396598719, -0.00375006454, -0.00353057919, -0.00330789772,
+    -0.00308236386, -0.00285428365, -0.00262396208, -0.00239174008, -0.00215805551, -0.00192333033,
+    -0.00168799906, -0.00145245857, -0.00121706103, -0.000982206531, -0.00074825647, -0.000515559977,
+    -0.000284474234, -5.5325817e-05, 0.000171525782, 0.000395685086, 0.000616771976, 0.000834464374,
+    0.00104853168, 0.00125871741, 0.00146464986, 0.00166595512, 0.0018623603, 0.00205358762,
+    0.00223934503, 0.00241935116, 0.00259325528, 0.00276074731, 0.00292153019, 0.0030753379,
+    0.00322191968, 0.00336101521, 0.00349241726, 0.00361594002, 0.00373147276, 0.00383889027,
+    0.0039380026, 0.00402862824, 0.00411060526, 0.00418381991, 0.00424824128, 0.00430381613,
+    0.00435041308, 0.00438794562, 0.00441640389, 0.00443573546, 0.00444587457, 0.00444676541,
+    0.00443839693, 0.00442081745, 0.0043940513, 0.00435817355, 0.00431324903, 0.004259303,
+    0.00419647619, 0.00412498062, 0.0040450883, 0.00395701979, 0.00386094941, 0.00375701456,
+    0.00364539739, 0.0035263295, 0.00340003627, 0.00326672128, 0.00312656932, 0.00297984355,
+    0.00282686622, 0.00266791913, 0.00250322897, 0.00233302467, 0.0021576005, 0.00197726345,
+    0.00179231516, 0.00160313436, 0.00141002976, 0.00121329079, 0.00101327826, 0.000810365615,
+    0.00060495715, 0.000397409343, 0.000188022219, -2.28883516e-05, -0.000235001584, -0.00044803343,
+    -0.000661738712, -0.000875842429, -0.00109004939, -0.0013039386, -0.00151712112, -0.00172927926,
+    -0.0019401418, -0.00214946402, -0.00235690832, -0.00256211116, -0.0027647213, -0.00296437026,
+    -0.00316073698, -0.00335353324, -0.00354244084, -0.00372710294, -0.00390718986, -0.00408247653,
+    -0.00425272165, -0.00441763762, -0.00457694204, -0.00473041357, -0.00487790238, -0.00501925741,
+    -0.00515427752, -0.00528270085, -0.00540430013, -0.00551881875, -0.00562605646, -0.00572585191,
+    -0.00581797528, -0.00590229343, -0.00597871677, -0.00604712585, -0.00610742626, -0.00615952635,
+    -0.00620331741, -0.00623871498, -0.00626571738, -0.00628438921, -0.0062947433, -0.00629673452,
+    -0.00629035596, -0.00627571719, -0.00625295434, -0.00622217493, -0.00618343049, -0.00613674051,
+    -0.00608215852, -0.00601973002, -0.0059495545, -0.00587175894, -0.00578643959, -0.00569377995,
+    -0.00559397372, -0.00548726835, -0.00537388289, -0.00525398649, -0.00512777562, -0.00499547723,
+    -0.00485737082, -0.00471377988, -0.00456498688, -0.00441117619, -0.00425260524, -0.00408960067,
+    -0.00392245469, -0.00375142385, -0.00357676988, -0.00339877526, -0.00321775517, -0.00303396817,
+    -0.00284768939, -0.00265916455, -0.00246865873, -0.00227652723, -0.00208316891, -0.0018890286,
+    -0.00169446607, -0.00149977618, -0.00130528264, -0.00111130208, -0.000918169562, -0.00072622083,
+    -0.000535747911, -0.000346993423, -0.000160297931, 2.39828473e-05, 0.000205581745, 0.000384268366,
+    0.000559829897, 0.000731983514, 0.000900450421, 0.00106497994, 0.00122532449, 0.00138128276,
+    0.00153264164, 0.00167913331, 0.00182048267, 0.00195636182, 0.00208654849, 0.00221089012,
+    0.00232920673, 0.00244131222, 0.00254707599, 0.00264640643, 0.00273921902, 0.00282542478,
+    0.00290486552, 0.0029774343, 0.00304308817, 0.00310179583, 0.00315351756, 0.00319811064,
+    0.00323548951, 0.00326561669, 0.00328847391, 0.00330408042, 0.00331244145, 0.00331352913,
+    0.00330729239, 0.00329369709, 0.00327280612, 0.00324467644, 0.00320932929, 0.00316683088,
+    0.00311733303, 0.00306105156, 0.00299817061, 0.00292881029, 0.00285303962, 0.00277097034,
+    0.00268272128, 0.00258848873, 0.00248846772, 0.00238276735, 0.00227158657, 0.00215511647,
+    0.00203352313, 0.00190700914, 0.00177577278, 0.00164002239, 0.00149996679, 0.00135586345,
+    0.0012079945, 0.00105659656, 0.000901864292, 0.000744064492, 0.000583569821, 0.000420773634,
+    0.000255987717, 8.94349702e-05, -7.86483167e-05, -0.000247984005, -0.000418345998, -0.000589465334,
+    -0.000761094863, -0.000933053824, -0.00110506406, -0.00127682495, -0.00144804247, -0.00161844507,
+    -0.00178778074, -0.00195577434, -0.00212215077, -0.00228656006, -0.0024486869, -0.0026082842,
+    -0.00276515958, -0.00291905841, -0.00306967319, -0.0032166894, -0.00335984882, -0.0034989494,
+    -0.00363376006, -0.00376408812, -0.00388982184, -0.00401082971, -0.00412699469, -0.00423815095,
+    -0.00434404956, -0.00444447386, -0.00453918433, -0.00462803994, -0.00471095259, -0.00478775596,
+    -0.00485827435, -0.00492235203, -0.00497986633, -0.00503077721, -0.00507511036, -0.00511278764,
+    -0.00514371904, -0.00516790233, -0.00518535942, -0.00519612997, -0.00520018902, -0.0051975379,
+    -0.00518826298, -0.00517247819, -0.00515029935, -0.00512180368, -0.00508706559, -0.00504609804,
+    -0.00499888878, -0.00494556722, -0.00488627325, -0.00482109118, -0.00475017317, -0.00467368831,
+    -0.00459181857, -0.00450477019, -0.00441272071, -0.00431578673, -0.00421416173, -0.00410809417,
+    -0.00399784558, -0.00388365443, -0.00376563221, -0.00364397508, -0.00351891341, -0.00339068289,
+    -0.00325955455, -0.00312575906, -0.00298948791, -0.00285091297, -0.00271018934, -0.00256751291,
+    -0.00242308658, -0.00227710082, -0.00212976763, -0.0019814105, -0.00183240379, -0.00168302105,
+    -0.00153345452, -0.00138391971, -0.00123466624, -0.00108597723, -0.00093817865, -0.000791502796,
+    -0.000646073889, -0.000502126124, -0.000359855272, -0.000219495708, -8.13068984e-05, 5.45211162e-05,
+    0.000187781994, 0.000318297779, 0.000445924385, 0.00057047424, 0.000691764662, 0.000809671991,
+    0.000924006312, 0.00103448328, 0.00114086883, 0.00124298622, 0.00134069256, 0.001433832,
+    0.00152223227, 0.00160577499, 0.00168440528, 0.00175812726, 0.00182693341, 0.00189072993,
+    0.00194942874, 0.00200292065, 0.00205117646, 0.0020942045, 0.00213193983, 0.00216433208,
+    0.00219127754, 0.00221271066, 0.00222866334, 0.00223920936, 0.00224433226, 0.00224394746,
+    0.00223795139, 0.0022263194, 0.00220912292, 0.00218638042, 0.00215815963, 0.00212463048,
+    0.00208589145, 0.00204204224, 0.00199315841, 0.00193929106, 0.00188053299, 0.00181702423,
+    0.00174893707, 0.00167640499, 0.00159946884, 0.00151819637, 0.00143264055, 0.00134296174,
+    0.00124938647, 0.001152122, 0.00105128727, 0.000947022917, 0.000839503343, 0.000728954935,
+    0.000615630585, 0.000499673451, 0.000381272003, 0.000260713278, 0.000138275309, 1.42375517e-05,
+    -0.000111168328, -0.000237724231, -0.000365291308, -0.00049373745, -0.000622835664, -0.00075240594,
+    -0.000882317457, -0.00101238272, -0.0011424083, -0.00127217568, -0.00140144062, -0.00153000052,
+    -0.00165768232, -0.00178427357, -0.00190953198, -0.00203322575, -0.00215518349, -0.00227533921,
+    -0.00239348336, -0.00250936159, -0.00262270833, -0.00273329916, -0.00284101077, -0.00294572135,
+    -0.00304733339, -0.00314577527, -0.00324089671, -0.00333255403, -0.00342064573, -0.0035050658,
+    -0.00358563121, -0.00366215307, -0.00373450203, -0.00380260176, -0.00386632786, -0.00392552384,
+    -0.00398003388, -0.00402973163, -0.00407458858, -0.00411464256, -0.00414982124, -0.0041800807,
+    -0.00420535133, -0.00422559017, -0.00424081247, -0.00425099134, -0.0042561537, -0.00425634177,
+    -0.00425160173, -0.00424202411, -0.00422771754, -0.00420872237, -0.00418498616, -0.00415646893,
+    -0.0041232217, -0.00408536185, -0.00404294099, -0.00399598062, -0.003944547, -0.00388871927,
+    -0.00382865923, -0.00376451955, -0.00369642115, -0.00362451666, -0.00354893359, -0.00346982454,
+    -0.00338735127, -0.00330157494, -0.00321262601, -0.00312066475, -0.0030258822, -0.00292847987,
+    -0.00282866317, -0.0027265385, -0.00262212907, -0.00251553246, -0.00240694316, -0.00229655309,
+    -0.00218445757, -0.00207080321, -0.0019557815, -0.00183960038, -0.00172255066, -0.00160486141,
+    -0.00148674587, -0.00136844986, -0.00125017185, -0.00113214735, -0.00101458068, -0.000897582791,
+    -0.000781294147, -0.000665866412, -0.000551504058, -0.000438452367, -0.000326925297, -0.000217060054,
+    -0.000108976039, -2.8159813e-06, 0.000101259417, 0.000203072962, 0.00030252662, 0.000399417723,
+    0.000493459824, 0.000584383327, 0.00067199748, 0.000756207187, 0.000836887717, 0.000913928104,
+    0.000987202584, 0.00105653284, 0.00112185578, 0.00118316025, 0.00124042533, 0.00129362672,
+    0.00134265899, 0.00138740276, 0.00142782059, 0.00146385583, 0.00149543154, 0.00152249154,
+    0.00154494761, 0.00156276841, 0.00157603729, 0.00158470852, 0.00158867812, 0.00158789017,
+    0.00158232563, 0.00157203049, 0.00155700495, 0.00153733486, 0.00151309517, 0.00148433494,
+    0.00145114647, 0.00141364285, 0.00137191119, 0.00132601198, 0.00127599662, 0.00122196065,
+    0.00116403943, 0.00110229254, 0.00103671618, 0.000967345839, 0.000894287603, 0.000817755416,
+    0.000737969323, 0.000655033336, 0.000569026423, 0.000480021359, 0.000388178718, 0.000293710194,
+    0.0001967585, 9.75479044e-05, -3.72948489e-06, -0.000106898305, -0.000211721854, -0.0003179586,
+    -0.00042539982, -0.000533880277, -0.000643236211, -0.000753265594, -0.000863747749, -0.000974569439,
+    -0.00108563561, -0.00119678063, -0.00130781116, -0.00141846335, -0.00152851129, -0.00163775751,
+    -0.00174596919, -0.00185294635, -0.00195844868, -0.00206227905, -0.00216432988, -0.00226442961,
+    -0.00236235289, -0.00245785077, -0.00255067668, -0.00264064128, -0.00272763917, -0.00281167687,
+    -0.00289267813, -0.00297047901, -0.00304494063, -0.00311604511, -0.00318372959, -0.00324791811,
+    -0.00330849836, -0.0033652887, -0.00341821378, -0.0034671693, -0.00351201906, -0.00355271546,
+    -0.00358919484, -0.00362143023, -0.00364947901, -0.00367333425, -0.00369294382, -0.00370824461,
+    -0.00371921656, -0.00372587032, -0.00372827344, -0.00372652076, -0.00372065198, -0.00371066642,
+    -0.00369661407, -0.00367861501, -0.0036566964, -0.00363082842, -0.00360099254, -0.00356721991,
+    -0.00352962339, -0.0034882054, -0.00344298495, -0.00339396735, -0.00334114194, -0.0032846483,
+    -0.00322467246, -0.00316138867, -0.0030949658, -0.00302548443, -0.00295301516, -0.00287771782,
+    -0.00279972009, -0.00271914375, -0.00263613877, -0.0025508239, -0.00246336998, -0.00237401975,
+    -0.00228286658, -0.00218996291, -0.00209542372, -0.00199942447, -0.00190215611, -0.00180372851,
+    -0.00170429339, -0.00160400848, -0.00150306394, -0.00140172482, -0.00130023494, -0.00119886193,
+    -0.00109779614, -0.00099719093, -0.000897257737, -0.000798212283, -0.000700153426, -0.000603176607,
+    -0.000507410734, -0.000413005326, -0.000320215529, -0.000229248149, -0.00014017995, -5.3086489e-05,
+    3.19571959e-05, 0.000114788773, 0.000195209016, 0.000273103754, 0.000348291633, 0.000420613345,
+    0.00048993387, 0.000556100349, 0.000618974814, 0.000678419341, 0.000734332613, 0.000786593943,
+    0.000835067913, 0.000879653886, 0.000920391572, 0.000957351988, 0.000990530039, 0.00101983911,
+    0.00104513873, 0.00106638144, 0.0010835376, 0.0010965855, 0.00110553288, 0.00111031298,
+    0.00111093204, 0.00110747266, 0.00109991225, 0.00108823109, 0.00107239644, 0.001052382,
+    0.00102822658, 0.00100000991, 0.000967848765, 0.000931839905, 0.000892032535, 0.000848512599,
+    0.000801483738, 0.000751140901, 0.000697595583, 0.000640945087, 0.00058127237, 0.000518748379,
+    0.000453433136, 0.000385391418, 0.000314719066, 0.000241486598, 0.000165871396, 8.80949331e-05,
+    8.29219526e-06, -7.3435148e-05, -0.000156997013, -0.000242264981, -0.000329050234, -0.000417130297,
+    -0.000506273694, -0.000596334775, -0.000687202969, -0.000778683038, -0.000870513423, -0.000962502376,
+    -0.00105449244, -0.0011463648, -0.00123797514, -0.00132912712, -0.00141977655, -0.00150985273,
+    -0.00159923656, -0.00168781822, -0.00177537266, -0.00186169265, -0.00194660815, -0.00202998679,
+    -0.00211170619, -0.00219160308, -0.00226949073, -0.00234523014, -0.00241869039, -0.00248975246,
+    -0.00255830878, -0.00262417009, -0.00268715711, -0.0027472241, -0.00280435268, -0.00285850315,
+    -0.00290955565, -0.00295738813, -0.00300201712, -0.00304344075, -0.00308166175, -0.00311664259,
+    -0.00314826411, -0.00317643107, -0.00320099761, -0.00322188847, -0.00323908776, -0.00325253652,
+    -0.00326217832, -0.00326806252, -0.00327023026, -0.0032686742, -0.00326339711, -0.00325434421,
+    -0.00324153394, -0.00322509316, -0.00320512967, -0.00318169723, -0.00315477545, -0.00312440604,
+    -0.00309072534, -0.00305382177, -0.00301377691, -0.00297060331, -0.00292431419, -0.00287496652,
+    -0.00282254178, -0.00276711397, -0.00270878909, -0.00264760361, -0.0025836605, -0.00251722394,
+    -0.00244849101, -0.00237758441, -0.00230462096, -0.00222966167, -0.0021528828, -0.00207450556,
+    -0.00199470757, -0.00191365168, -0.00183143163, -0.00174821472, -0.00166419433, -0.00157950722,
+    -0.00149428273, -0.00140865432, -0.00132278256, -0.0012368461, -0.00115099866, -0.00106542975,
+    -0.000980263335, -0.000895617846, -0.000811712611, -0.000728850518, -0.00064731705, -0.000567319251,
+    -0.000488979041, -0.000412439577, -0.00033794043, -0.000265572825, -0.000195442668, -0.000127685714,
+    -6.23519294e-05, 3.90800814e-07, 6.04061975e-05, 0.000117663836, 0.000172135584, 0.000223763889,
+    0.000272456906, 0.000318082846, 0.000360546762, 0.000399814279, 0.000435887155, 0.000468757316,
+    0.000498348273, 0.000524520177, 0.000547158375, 0.000566249051, 0.000581821689, 0.000593843342,
+    0.000602284398, 0.000607317406, 0.000609048612, 0.000607574155, 0.000602957187, 0.000595146598,
+    0.000584134531, 0.000569961229, 0.000552690849, 0.000532431207, 0.000509206344, 0.000483031847,
+    0.000453928367, 0.00042193752, 0.000387117713, 0.00034957324, 0.000309333838, 0.000266484654,
+    0.000221147652, 0.000173428329, 0.0001234195, 7.11429692e-05, 1.66835443e-05, -3.96536567e-05,
+    -9.7614511e-05, -0.000157029757, -0.000217793506, -0.000279851779, -0.000343094688, -0.000407429163,
+    -0.000472692409, -0.000538763649, -0.000605590135, -0.000673102736, -0.000741168087, -0.0008096126,
+    -0.000878285044, -0.000947078013, -0.00101594438, -0.00108476584, -0.00115340883, -0.00122172392,
+    -0.00128957127, -0.00135691503, -0.00142361599, -0.0014894799, -0.00155440919, -0.00161830779,
+    -0.00168111899, -0.00174278082, -0.00180319627, -0.00186239789, -0.00192036108, -0.0019770454,
+    -0.00203245909, -0.00208650493, -0.00213895943, -0.00218974646, -0.00223885889, -0.00228626849,
+    -0.00233196797, -0.0023757857, -0.0024174328, -0.00245676563, -0.0024937395, -0.00252836503,
+    -0.00256056717, -0.00259031284, -0.00261750715, -0.0026420705, -0.00266398389, -0.00268316556,
+    -0.00269957527, -0.00271331194, -0.00272439366, -0.00273285781, -0.00273875951, -0.00274203279,
+    -0.00274254433, -0.00274021306, -0.00273502111, -0.00272700479, -0.0027161449, -0.00270237023,
+    -0.00268580245, -0.00266653926, -0.00264465554, -0.00262027955, -0.00259339754, -0.00256404154,
+    -0.0025323501, -0.00249846355, -0.00246249991, -0.00242451519, -0.00238455661, -0.00234270176,
+    -0.00229908761, -0.002253841, -0.00220705491, -0.00215875806, -0.002108932, -0.00205754794,
+    -0.00200470315, -0.00195052573, -0.00189501357, -0.00183819471, -0.00178029046, -0.00172143918,
+    -0.00166177733, -0.00160142799, -0.00154042802, -0.0014789298, -0.00141708384, -0.00135503008,
+    -0.0012928867, -0.00123068228, -0.0011684737, -0.00110636843, -0.00104449871, -0.000982991886,
+    -0.000921985806, -0.000861535792, -0.000801718856, -0.000742627365, -0.000684347256, -0.000626951394,
+    -0.000570449953, -0.000514971378, -0.000460801384, -0.000408148918, -0.000357151435, -0.000307850804,
+    -0.000260296949, -0.000214621487, -0.000170904417, -0.000129270596, -8.97916954e-05, -5.24253528e-05,
+    -1.71884893e-05, 1.58788034e-05, 4.67263989e-05, 7.53101051e-05, 0.000101610711, 0.000125662944,
+    0.000147386637, 0.000166709654, 0.000183599586, 0.000198036177, 0.000210093092, 0.000219714884,
+    0.000226763134, 0.000231169332, 0.00023290826, 0.000231994222, 0.000228397176, 0.000222096872,
+    0.000213192562, 0.000201749001, 0.000187856635, 0.000171619302, 0.000153067664, 0.000132206232,
+    0.000109073828, 8.37426085e-05, 5.62892605e-05, 2.67133455e-05, -5.10400032e-06, -3.91817441e-05,
+    -7.54450721e-05, -0.000113779036, -0.000154011771, -0.00019615443, -0.000240241305, -0.000286262909,
+    -0.000334141206, -0.000383745495, -0.000435007392, -0.000487788831, -0.000541889483, -0.000597188432,
+    -0.000653547419, -0.00071081836, -0.000768947181, -0.000827894518, -0.000887583951, -0.000947887287,
+    -0.001008649, -0.00106982134, -0.00113141119, -0.00119330043, -0.00125537466, -0.00131751433,
+    -0.0013795778, -0.00144151565, -0.00150313022, -0.00156422582, -0.00162463764, -0.0016842402,
+    -0.00174302364, -0.00180089541, -0.00185763848, -0.00191302099, -0.00196685711, -0.00201900849,
+    -0.00206946021, -0.00211823575, -0.00216529546, -0.00221052255, -0.0022538148, -0.00229518999,
+    -0.00233464253, -0.00237206679, -0.00240738266, -0.00244047836, -0.00247128784, -0.00249975985,
+    -0.00252571048, -0.00254904747, -0.00256970681, -0.00258765978, -0.00260297082, -0.00261562786,
+    -0.0026255685, -0.00263272522, -0.00263706915, -0.00263860506, -0.00263737465, -0.00263342097,
+    -0.00262680177, -0.00261755786, -0.00260574537, -0.00259153957, -0.00257492836, -0.00255577024,
+    -0.00253403264, -0.0025097259, -0.00248294252, -0.00245373159, -0.00242201786, -0.00238781503,
+    -0.00235115673, -0.00231213451, -0.00227093266, -0.00222769245, -0.0021825052, -0.00213544297,
+    -0.00208661757, -0.00203613155, -0.00198408683, -0.00193056717, -0.00187568836, -0.00181958674,
+    -0.00176242821, -0.00170442615, -0.00164558304, -0.00158587712, -0.00152535064, -0.00146411158,
+    -0.00140232961, -0.00134005619, -0.00127735161, -0.00121439466, -0.00115130568, -0.00108824544,
+    -0.00102541001, -0.000962919037, -0.000900928387, -0.00083959198, -0.000779064359, -0.000719512709,
+    -0.000661015506, -0.000603511157, -0.000547087279, -0.000491899527, -0.00043808976, -0.000385817628,
+    -0.000335097122, -0.0002859169, -0.000238330392, -0.000192461793, -0.000148418367, -0.000106177167,
+    -6.58674074e-05, -2.76468834e-05, 8.37165538e-06, 4.20375795e-05, 7.32441878e-05, 0.000101955535,
+    0.000128076545, 0.000151528217, 0.000172225898, 0.000190085657, 0.000205224062, 0.000217789451,
+    0.00022775823, 0.000235110475, 0.000239798217, 0.000241756931, 0.00024104559, 0.000237636129,
+    0.000231522203, 0.00022272048, 0.000211282244, 0.000197326892, 0.000180823577, 0.000161682974,
+    0.000139834515, 0.00011527168, 8.80407692e-05, 5.8226147e-05, 2.5917648e-05, -8.81933891e-06,
+    -4.59429677e-05, -8.53637691e-05, -0.00012683961, -0.000170202144, -0.000215379117, -0.00026231567,
+    -0.000310959, -0.000361154131, -0.000412801562, -0.000465972223, -0.000520591388, -0.000576589424,
+    -0.000633860112, -0.000692193509, -0.000751519587, -0.000811832186, -0.000873086868, -0.000935176626,
+    -0.000997966934, -0.00106129376, -0.00112499519, -0.001188924, -0.00125294772, -0.0013169235,
+    -0.00138059808, -0.00144386486, -0.00150667952, -0.00156892062, -0.00163045433, -0.00169111255,
+    -0.00175090296, -0.00180991824, -0.00186811835, -0.00192541932, -0.00198165493, -0.00203660729,
+    -0.00209015088, -0.00214218209, -0.00219263353, -0.0022413918, -0.00228832285, -0.00233333587,
+    -0.00237633364, -0.00241716514, -0.00245569662, -0.00249176974, -0.00252519886, -0.00255604259,
+    -0.00258433791, -0.00261002912, -0.00263303341, -0.00265322865, -0.00267068173, -0.00268547014,
+    -0.00269754666, -0.00270686483, -0.00271334315, -0.00271688899, -0.00271742859, -0.00271488303,
+    -0.00270920298, -0.00270033208, -0.00268825638, -0.00267308485, -0.00265493531, -0.00263381504,
+    -0.00260970381, -0.00258256978, -0.00255243313, -0.00251949516, -0.00248388362, -0.00244571132,
+    -0.00240503695, -0.00236193299, -0.00231663311, -0.00226923294, -0.00221977322, -0.00216834031,
+    -0.00211499401, -0.00205982713, -0.00200290016, -0.00194421367, -0.00188381643, -0.00182179374,
+    -0.00175824619, -0.00169349499, -0.00162783316, -0.00156135573, -0.00149414241, -0.00142629435,
+    -0.00135795961, -0.00128936891, -0.00122066558, -0.00115199284, -0.00108346163, -0.00101525303,
+    -0.000947621021, -0.000880596968, -0.000814212058, -0.000748515758, -0.000683606933, -0.000619634288,
+    -0.000556692249, -0.000494850618, -0.000434202007, -0.000374815093, -0.000316804001, -0.000260482522,
+    -0.000206073455, -0.000153686754, -0.000103459419, -5.54964546e-05, -9.95846832e-06, 3.31238965e-05,
+    7.38200051e-05, 0.000112061753, 0.000147757356, 0.000180753476, 0.000210890561, 0.000238238915,
+    0.000262865681, 0.000284803448, 0.000304005873, 0.000320379666, 0.000333873786, 0.000344479335,
+    0.00035219004, 0.000356990317, 0.000358807692, 0.000357443521, 0.000352839152, 0.000345001278,
+    0.000333919346, 0.000319587802, 0.000301952457, 0.00028121208, 0.000257596841, 0.000231166507,
+    0.00020198906, 0.000170074657, 0.00013542353, 9.81638117e-05, 5.84051162e-05, 1.62278727e-05,
+    -2.83247295e-05, -7.5182851e-05, -0.000124235635, -0.000175400987, -0.000228635489, -0.000283909088,
+    -0.000341189621, -0.000400413537, -0.000461358189, -0.000523885549, -0.000587889158, -0.00065332623,
+    -0.000720146016, -0.000787968563, -0.000856462996, -0.000925466545, -0.000994821761, -0.00106444531,
+    -0.00113423478, -0.00120409953, -0.0012739747, -0.00134375, -0.00141333017, -0.00148262452,
+    -0.00155140345, -0.00161947601, -0.00168676406, -0.00175317668, -0.00181863636, -0.00188300579,
+    -0.00194601758, -0.00200752152, -0.00206739865, -0.00212554305, -0.00218178745, -0.00223576481,
+    -0.0022872978, -0.00233628045, -0.00238263083, -0.00242626108, -0.00246707838, -0.00250516024,
+    -0.00254059821, -0.00257340333, -0.00260357307, -0.00263103778, -0.00265552993, -0.00267693478,
+    -0.00269530465, -0.00271066146, -0.00272301751, -0.0027322393, -0.00273817714, -0.00274085162,
+    -0.00274026823, -0.00273647865, -0.00272944726, -0.00271907474, -0.0027054903, -0.00268880907,
+    -0.00266912564, -0.0026464889, -0.00262090614, -0.0025926109, -0.00256181721, -0.00252868167,
+    -0.00249334923, -0.00245590558, -0.00241613165, -0.00237397544, -0.0023295386, -0.00228289682,
+    -0.00223415877, -0.0021833756, -0.00213071567, -0.00207640021, -0.00202052035, -0.00196316007,
+    -0.00190432385, -0.00184416888, -0.00178307729, -0.00172128563, -0.00165897829, -0.00159622246,
+    -0.00153307769, -0.00146990625, -0.00140704343, -0.00134471191, -0.00128308002, -0.00122217878,
+    -0.00116181272, -0.00110208874, -0.00104317875, -0.000985161215, -0.000928092157, -0.000871871597,
+    -0.000816630172, -0.000762618886, -0.000709925953, -0.000658649087, -0.000608798748, -0.000560431173,
+    -0.000513636705, -0.000468451496, -0.0004249046, -0.0003829811, -0.000342711415, -0.000304120914,
+    -0.000267167495, -0.000231766701, -0.000197848589, -0.00016536648, -0.000134445737, -0.000105081026,
+    -7.70773008e-05, -5.03164085e-05, -2.46135095e-05, 3.21964677e-15
+};
+
+// group delay of the tables at DC, in samples
+const float blep_delay = 1.9759722;
@@ -0,0 +1,183 @@
+// dynamics processing core for [compress~], [expand~], [duck~] and
+// [noisegate~]: a peak or rms detector, a gain computer in dB, attack and
+// release smoothing of the gain and a lookahead delay line, for any number of
+// channels with either one linked gain or a gain per channel
+
+#include <m_pd.h>
+#include <math.h>
+#include "dynamics.h"
+#include "fastlog.h"
+
+#define LOG001 log(0.001)
+#define DYN_SILENCE 1e-20f  // keeps the detector off denormals and log2(0)
+#define DYN_GATE_SLOPE 1000 // gates switch within a fraction of a dB
+
+void dyn_init(t_dynamics *d, t_dyn_type type, int nch, int side, double sr){
+    d->d_type = type;
+    d->d_nch = nch < 1 ? 1 : nch;
+    d->d_ndet = side ? 1 : d->d_nch;
+    d->d_link = 1;
+    d->d_peak = 0;
+    d->d_sr = sr;
+    d->d_thresh = -10;
+    d->d_ratio = 1;
+    d->d_attack = d->d_release = 10;
+    d->d_window = 512;
+    d->d_lookahead = 0;
+    d->d_makeup = d->d_makeup_last = 1;
+    d->d_env = (float *)getbytes(d->d_ndet * sizeof(float));
+    d->d_gain = (float *)getbytes(d->d_nch * sizeof(float));
+    d->d_work = NULL;
+    d->d_nblock = 0;
+    d->d_delay = NULL;
+    d->d_dsize = d->d_dpos = 0;
+    d->d_gr = 0;
+    dyn_clear(d);
+    dyn_update(d);
+}
+
+void dyn_free(t_dynamics *d){
+    freebytes(d->d_env, d->d_ndet * sizeof(float));
+    freebytes(d->d_gain, d->d_nch * sizeof(float));
+    freebytes(d->d_work, d->d_nblock * d->d_nch * sizeof(float));
+    freebytes(d->d_delay, d->d_dsize * d->d_nch * sizeof(float));
+}
+
+void dyn_clear(t_dynamics *d){
+    for(int j = 0; j < d->d_ndet; j++)
+        d->d_env[j] = DYN_SILENCE;
+    for(int j = 0; j < d->d_nch; j++)
+        d->d_gain[j] = 0;
+    for(int i = 0; i < d->d_dsize * d->d_nch; i++)
+        d->d_delay[i] = 0;
+}
+
+// one pole coefficient that gets within -60dB of the target in 'ms'
+static float dyn_coeff(double ms, double sr){
+    double n = ms * sr * 0.001;
+    return(n < 1 ? 1 : (float)(1 - exp(LOG001 / n)));
+}
+
+void dyn_update(t_dynamics *d){
+    float ratio = d->d_ratio < 1 ? 1 : d->d_ratio;
+    switch(d->d_type){
+        case DYN_COMPRESS:
+            d->d_slope = -(1 - 1/ratio);
+            break;
+        case DYN_EXPAND:
+            d->d_slope = 1 - 1/ratio;
+            break;
+        case DYN_GATE:
+            d->d_slope = DYN_GATE_SLOPE;
+            break;
+        default:
+            d->d_slope = -ratio;
+    }
+    d->d_ca = dyn_coeff(d->d_attack, d->d_sr);
+    d->d_cr = dyn_coeff(d->d_release, d->d_sr);
+    // a one pole with the bandwidth of a moving average of 'window' samples
+    float w = d->d_window < 1 ? 1 : d->d_window;
+    d->d_cd = 2 / (w + 1);
+}
+
+void dyn_makeup(t_dynamics *d, t_float db){
+    d->d_makeup = fast_dbtorms(db);
+}
+
+void dyn_lookahead(t_dynamics *d, t_float ms){
+    d->d_lookahead = ms < 0 ? 0 : ms;
+    int size = (int)(d->d_lookahead * d->d_sr * 0.001 + 0.5), nch = d->d_nch;
+    if(size != d->d_dsize){
+        d->d_delay = (float *)resizebytes(d->d_delay,
+            d->d_dsize * nch * sizeof(float), size * nch * sizeof(float));
+        d->d_dsize = size;
+        for(int i = 0; i < size * nch; i++)
+            d->d_delay[i] = 0;
+        d->d_dpos = 0;
+    }
+}
+
+void dyn_block(t_dynamics *d, int nblock){
+    if(nblock != d->d_nblock){
+        d->d_work = (float *)resizebytes(d->d_work,
+            d->d_nblock * d->d_nch * sizeof(float), nblock * d->d_nch * sizeof(float));
+        d->d_nblock = nblock;
+    }
+}
+
+t_float dyn_reduction(t_dynamics *d){
+    t_float gr = d->d_gr;
+    d->d_gr = 0;
+    return(gr);
+}
+
+// level in dB to gain in dB
+static inline float dyn_gain(t_dynamics *d, float level){
+    float g = (level - d->d_thresh) * d->d_slope;
+    g = g < 0 ? g : 0;
+    return(g > DYN_FLOOR ? g : DYN_FLOOR);
+}
+
+// attack when the gain goes down, release when it comes back up
+static inline float dyn_smooth(t_dynamics *d, float s, float g){
+    return(s + (g - s) * (g < s ? d->d_ca : d->d_cr));
+}
+
+void dyn_perform(t_dynamics *d, int nblock, t_float **ins, t_float *side, t_float **outs){
+    int nch = d->d_nch, ndet = d->d_ndet, peak = d->d_peak, link = d->d_link;
+    int dsize = d->d_dsize, dpos = d->d_dpos;
+    float *w = d->d_work, *env = d->d_env, *gain = d->d_gain, *delay = d->d_delay;
+    float cd = d->d_cd, scale = peak ? FASTLOG_DB_LOG2 : 0.5f * FASTLOG_DB_LOG2;
+    float mk = d->d_makeup_last, dmk = (d->d_makeup - mk) / nblock;
+    // copy all inputs first, an output may share its buffer with another input
+    for(int ch = 0; ch < nch; ch++){
+        t_float *in = ins[ch];
+        for(int i = 0; i < nblock; i++)
+            w[i*nch + ch] = in[i];
+    }
+    for(int i = 0; i < nblock; i++){
+        float *v = w + i*nch;
+        float sc = side ? side[i] : 0;
+        float *det = ndet == nch ? v : &sc;
+        // detector: mean square or peak with instant attack
+        float top = DYN_SILENCE;
+        for(int j = 0; j < ndet; j++){
+            float a = peak ? fabsf(det[j]) : det[j] * det[j];
+            float e = env[j] + (a - env[j]) * cd;
+            env[j] = peak && a > e ? a : e;
+            top = env[j] > top ? env[j] : top;
+        }
+        if(dsize){ // lookahead: the gain is applied to audio from the past
+            float *dl = delay + dpos*nch;
+            for(int ch = 0; ch < nch; ch++){
+                float y = dl[ch];
+                dl[ch] = v[ch];
+                v[ch] = y;
+            }
+            dpos = dpos + 1 == dsize ? 0 : dpos + 1;
+        }
+        if(link || ndet == 1){
+            float g = dyn_gain(d, scale * fast_log2(top + DYN_SILENCE));
+            float s = gain[0] = dyn_smooth(d, gain[0], g);
+            float lin = fast_exp2(FASTLOG_LOG2_DB * s) * mk;
+            for(int ch = 0; ch < nch; ch++)
+                v[ch] *= lin;
+        }
+        else for(int ch = 0; ch < nch; ch++){
+            float g = dyn_gain(d, scale * fast_log2(env[ch] + DYN_SILENCE));
+            gain[ch] = dyn_smooth(d, gain[ch], g);
+            v[ch] *= fast_exp2(FASTLOG_LOG2_DB * gain[ch]) * mk;
+        }
+        mk += dmk;
+    }
+    d->d_dpos = dpos;
+    d->d_makeup_last = d->d_makeup;
+    int ng = link || ndet == 1 ? 1 : nch;
+    for(int j = 0; j < ng; j++)
+        d->d_gr = gain[j] < d->d_gr ? gain[j] : d->d_gr;
+    for(int ch = 0; ch < nch; ch++){
+        t_float *out = outs[ch];
+        for(int i = 0; i < nblock; i++)
+            out[i] = w[i*nch + ch];
+    }
+}
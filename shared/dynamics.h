@@ -0,0 +1,59 @@
+// dynamics processing core for [compress~], [expand~], [duck~] and
+// [noisegate~]: a peak or rms detector, a gain computer in dB, attack and
+// release smoothing of the gain and a lookahead delay line, for any number of
+// channels with either one linked gain or a gain per channel
+
+#ifndef __DYNAMICS_H__
+#define __DYNAMICS_H__
+
+#define DYN_FLOOR -120   // most gain reduction in dB
+
+typedef enum _dyn_type{
+    DYN_COMPRESS,   // reduces what's above the threshold
+    DYN_EXPAND,     // reduces what's below the threshold
+    DYN_GATE,       // mutes what's below the threshold
+    DYN_DUCK        // reduces by how much the sidechain goes above the threshold
+}t_dyn_type;
+
+typedef struct _dynamics{
+    t_dyn_type  d_type;
+    int         d_nch;      // audio channels
+    int         d_ndet;     // detector channels, 1 with a sidechain
+    int         d_link;     // one gain for all channels, from the loudest
+    int         d_peak;     // peak instead of rms detection
+    double      d_sr;
+    t_float     d_thresh;   // dB
+    t_float     d_ratio;
+    t_float     d_attack;   // ms
+    t_float     d_release;  // ms
+    t_float     d_window;   // detector averaging in samples
+    t_float     d_lookahead; // ms
+    float       d_slope;    // gain in dB for each dB above the threshold
+    float       d_ca, d_cr, d_cd; // attack, release and detector coefficients
+    float       d_makeup, d_makeup_last; // linear output gain
+    float      *d_env;      // detector state
+    float      *d_gain;     // smoothed gain in dB, one per channel
+    float      *d_work;     // the input block, channels interleaved
+    int         d_nblock;
+    float      *d_delay;    // lookahead delay line, channels interleaved
+    int         d_dsize, d_dpos;
+    float       d_gr;       // most reduction since the last report
+}t_dynamics;
+
+// 'side': the detector runs on a separate sidechain signal
+void dyn_init(t_dynamics *d, t_dyn_type type, int nch, int side, double sr);
+void dyn_free(t_dynamics *d);
+void dyn_clear(t_dynamics *d);
+// recompute coefficients after changing parameters or the sample rate
+void dyn_update(t_dynamics *d);
+void dyn_makeup(t_dynamics *d, t_float db);
+// resizes the delay line
+void dyn_lookahead(t_dynamics *d, t_float ms);
+// size the work buffer for the block
+void dyn_block(t_dynamics *d, int nblock);
+// 'side' is ignored without a sidechain, 'outs' can share buffers with 'ins'
+void dyn_perform(t_dynamics *d, int nblock, t_float **ins, t_float *side, t_float **outs);
+// the most gain reduction in dB since the last call
+t_float dyn_reduction(t_dynamics *d);
+
+#endif
@@ -0,0 +1,191 @@
+// a bank of ADSR envelopes for the bank mode of [adsr~] and [asr~], see
+// envbank.h
+
+#include <m_pd.h>
+#include <math.h>
+#include "envbank.h"
+
+#define LOG001 log(0.001)
+
+void envbank_init(t_envbank *e, int n, t_float sr){
+    e->e_n = n;
+    e->e_nactive = e->e_nended = 0;
+    e->e_active = (int *)getbytes(n * sizeof(int));
+    e->e_slot = (int *)getbytes(n * sizeof(int));
+    e->e_left = (int *)getbytes(n * sizeof(int));
+    e->e_gate = (int *)getbytes(n * sizeof(int));
+    e->e_ended = (int *)getbytes(n * sizeof(int));
+    e->e_last = (t_float *)getbytes(n * sizeof(t_float));
+    e->e_peak = (t_float *)getbytes(n * sizeof(t_float));
+    for(int i = 0; i < n; i++)
+        e->e_slot[i] = -1;
+    for(int k = 0; k < 3; k++){
+        e->e_pow[k] = NULL;
+        e->e_pown[k] = -1;
+    }
+    e->e_nblock = 0;
+    e->e_sr_khz = sr * 0.001;
+    e->e_attack = e->e_decay = e->e_release = 1;
+    e->e_sustain = 0;
+}
+
+void envbank_free(t_envbank *e){
+    int n = e->e_n;
+    freebytes(e->e_active, n * sizeof(int));
+    freebytes(e->e_slot, n * sizeof(int));
+    freebytes(e->e_left, n * sizeof(int));
+    freebytes(e->e_gate, n * sizeof(int));
+    freebytes(e->e_ended, n * sizeof(int));
+    freebytes(e->e_last, n * sizeof(t_float));
+    freebytes(e->e_peak, n * sizeof(t_float));
+    for(int k = 0; k < 3; k++)
+        freebytes(e->e_pow[k], e->e_nblock * sizeof(t_float));
+}
+
+void envbank_dsp(t_envbank *e, int nblock, t_float sr){
+    for(int k = 0; k < 3; k++){
+        e->e_pow[k] = (t_float *)resizebytes(e->e_pow[k],
+            e->e_nblock * sizeof(t_float), nblock * sizeof(t_float));
+        e->e_pown[k] = -1;
+    }
+    e->e_nblock = nblock;
+    e->e_sr_khz = sr * 0.001;
+}
+
+static int envbank_nsamps(t_envbank *e, t_float ms){
+    int n = (int)roundf(ms * e->e_sr_khz);
+    return(n < 1 ? 1 : n);
+}
+
+// a^1 to a^nblock for the one pole that gets 60dB closer in 'n' samples
+static void envbank_pow(t_envbank *e, int k, int n){
+    if(n == e->e_pown[k])
+        return;
+    double a = exp(LOG001 / n), p = 1;
+    for(int i = 0; i < e->e_nblock; i++)
+        e->e_pow[k][i] = p *= a;
+    e->e_pown[k] = n;
+}
+
+void envbank_params(t_envbank *e, t_float attack, t_float decay, t_float sustain, t_float release){
+    e->e_attack = envbank_nsamps(e, attack);
+    e->e_decay = envbank_nsamps(e, decay);
+    e->e_release = envbank_nsamps(e, release);
+    e->e_sustain = sustain;
+    if(e->e_log){
+        envbank_pow(e, 0, e->e_attack);
+        envbank_pow(e, 1, e->e_decay);
+        envbank_pow(e, 2, e->e_release);
+    }
+}
+
+int envbank_gate(t_envbank *e, int i, t_float gate){
+    if(i < 0 || i >= e->e_n)
+        return(0);
+    if(gate != 0){ // (re)trigger
+        int idle = e->e_slot[i] < 0;
+        e->e_peak[i] = gate;
+        e->e_left[i] = e->e_attack + e->e_decay;
+        e->e_gate[i] = 1;
+        if(idle){
+            e->e_slot[i] = e->e_nactive;
+            e->e_active[e->e_nactive++] = i;
+        }
+        return(idle);
+    }
+    if(e->e_gate[i] && e->e_slot[i] >= 0){ // release
+        e->e_gate[i] = 0;
+        e->e_left[i] = e->e_release;
+    }
+    return(0);
+}
+
+static void envbank_line(t_float *out, int n, t_float last, t_float inc){
+    for(int i = 0; i < n; i++)
+        out[i] = last + (i + 1) * inc;
+}
+
+static void envbank_curve(t_float *out, int n, t_float last, t_float target, t_float *pow){
+    t_float d = last - target;
+    for(int i = 0; i < n; i++)
+        out[i] = target + pow[i] * d;
+}
+
+// one envelope for a block, returns 0 if it ended
+static int envbank_run(t_envbank *e, int j, t_float *out, int nblock){
+    t_float last = e->e_last[j], peak = e->e_peak[j];
+    t_float sustain = peak * e->e_sustain;
+    int left = e->e_left[j], decay = e->e_decay, i = 0, ended = 0;
+    while(i < nblock){
+        int m = nblock - i;
+        if(e->e_gate[j]){
+            if(left > decay){ // attack
+                if(m > left - decay)
+                    m = left - decay;
+                if(e->e_log)
+                    envbank_curve(out + i, m, last, peak, e->e_pow[0]);
+                else
+                    envbank_line(out + i, m, last, (peak - last) / (left - decay));
+            }
+            else if(left > 0){ // decay
+                if(m > left)
+                    m = left;
+                if(e->e_log)
+                    envbank_curve(out + i, m, last, sustain, e->e_pow[1]);
+                else
+                    envbank_line(out + i, m, last, (sustain - last) / left);
+            }
+            else{ // sustain
+                for(; i < nblock; i++)
+                    out[i] = sustain;
+                last = sustain;
+                break;
+            }
+        }
+        else if(e->e_log){ // release, until it's below the floor
+            if(fabsf(last) < ENVBANK_FLOOR)
+                ended = 1;
+            else
+                envbank_curve(out + i, m, last, 0, e->e_pow[2]);
+        }
+        else if(left > 0){
+            if(m > left)
+                m = left;
+            envbank_line(out + i, m, last, -last / left);
+        }
+        else
+            ended = 1;
+        if(ended){
+            for(; i < nblock; i++)
+                out[i] = 0;
+            e->e_last[j] = 0;
+            return(0);
+        }
+        last = out[i + m - 1];
+        left = left > m ? left - m : 0;
+        i += m;
+    }
+    e->e_last[j] = PD_BIGORSMALL(last) ? 0. : last;
+    e->e_left[j] = left;
+    return(1);
+}
+
+void envbank_perform(t_envbank *e, int nblock, t_float **outs){
+    for(int j = 0; j < e->e_n; j++)
+        if(e->e_slot[j] < 0)
+            for(int i = 0; i < nblock; i++)
+                outs[j][i] = 0;
+    for(int k = 0; k < e->e_nactive;){
+        int j = e->e_active[k];
+        if(envbank_run(e, j, outs[j], nblock))
+            k++;
+        else{ // remove it, the last active one takes its place
+            int moved = e->e_active[--e->e_nactive];
+            e->e_active[k] = moved;
+            e->e_slot[moved] = k;
+            e->e_slot[j] = -1;
+            if(e->e_nended < e->e_n)
+                e->e_ended[e->e_nended++] = j;
+        }
+    }
+}
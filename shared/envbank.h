@@ -0,0 +1,53 @@
+// a bank of ADSR envelopes for the bank mode of [adsr~] and [asr~]
+
+// The states of all envelopes are kept as arrays, one value per envelope,
+// and only the running ones are processed: they are listed in 'e_active'.
+// Gates come as messages, so an envelope can only change stage at a block
+// boundary or when a stage ends, and each stage is rendered as a whole run:
+// linear stages add a fixed increment, the '-log' curves scale the distance
+// to the target by a table of the powers of the one pole coefficient, which
+// is shared by all envelopes. An [asr~] is an ADSR with a full sustain.
+
+#ifndef __ENVBANK_H__
+#define __ENVBANK_H__
+
+// release stages in log mode end below this level (-80dB)
+#define ENVBANK_FLOOR 0.0001f
+
+typedef struct _envbank{
+    int      e_n;           // number of envelopes
+    int      e_nactive;
+    int     *e_active;      // the running envelopes
+    int     *e_slot;        // position of each envelope in 'e_active'
+    t_float *e_last;        // current values
+    t_float *e_peak;        // attack target: the gate (velocity)
+    int     *e_left;        // samples left in the attack and decay or release
+    int     *e_gate;
+    int     *e_ended;       // envelopes that ended in the last blocks
+    int      e_nended;
+    int      e_log;         // exponential curves instead of lines
+    // parameters for this block
+    int      e_attack;      // in samples
+    int      e_decay;
+    int      e_release;
+    t_float  e_sustain;     // a ratio of the peak
+    t_float  e_sr_khz;
+    // powers of the one pole coefficients, for one block
+    t_float *e_pow[3];      // attack, decay, release
+    int      e_pown[3];     // the stage lengths they were computed for
+    int      e_nblock;
+}t_envbank;
+
+void envbank_init(t_envbank *e, int n, t_float sr);
+void envbank_free(t_envbank *e);
+void envbank_dsp(t_envbank *e, int nblock, t_float sr);
+// times in ms, stages are at least one sample long
+void envbank_params(t_envbank *e, t_float attack, t_float decay, t_float sustain, t_float release);
+// gate envelope 'i', a new gate while it's on retriggers it, 0 releases
+// it, returns 1 if it was idle
+int envbank_gate(t_envbank *e, int i, t_float gate);
+// all envelopes to 'outs', idle ones are zero; those that end are added
+// to 'e_ended'
+void envbank_perform(t_envbank *e, int nblock, t_float **outs);
+
+#endif
@@ -0,0 +1,55 @@
+// fast log2 and exp2 on floats for dB conversions in signal loops, they are
+// branchless so loops calling them vectorize
+
+// log2: the exponent from the bits of the float and an odd series in
+// (m-1)/(m+1) for the mantissa m, taken between sqrt(0.5) and sqrt(2)
+// exp2: the nearest integer straight into the exponent bits and a 6th degree
+// polynomial for the fraction, both are within 1e-6 of the libm functions
+
+#ifndef __FASTLOG_H__
+#define __FASTLOG_H__
+
+#include <stdint.h>
+
+#define FASTLOG_DB_LOG2 6.02059991327962390427  // 20*log10(2)
+#define FASTLOG_LOG2_DB 0.16609640474436811739  // log2(10)/20
+
+typedef union _fastlog_bits{
+    float       f;
+    uint32_t    i;
+}t_fastlog_bits;
+
+// x > 0, normal
+static inline float fast_log2(float x){
+    t_fastlog_bits u = {x};
+    float e = (float)(int32_t)((u.i >> 23) & 255) - 127;
+    u.i = (u.i & 0x007fffff) | 0x3f800000; // mantissa in [1, 2)
+    float m = u.f;
+    int big = m > 1.41421356f;
+    m = big ? m * 0.5f : m;
+    e = big ? e + 1 : e;
+    float t = (m - 1) / (m + 1), t2 = t * t;
+    return(e + t*(2.88539008f + t2*(0.96179669f + t2*(0.57707801f + t2*0.41219858f))));
+}
+
+static inline float fast_exp2(float x){
+    x = x < -126 ? -126 : x > 126 ? 126 : x;
+    float r = x + 0.5f, fl = (float)(int32_t)r;
+    fl = fl > r ? fl - 1 : fl; // nearest integer, the fraction is within +-0.5
+    float f = x - fl;
+    t_fastlog_bits u;
+    u.i = (uint32_t)((int32_t)fl + 127) << 23;
+    return(u.f * (1 + f*(0.69314718f + f*(0.24022651f + f*(0.05550411f
+        + f*(0.00961813f + f*(0.00133336f + f*0.00015404f)))))));
+}
+
+// amplitude to dB and back
+static inline float fast_rmstodb(float a){
+    return(FASTLOG_DB_LOG2 * fast_log2(a));
+}
+
+static inline float fast_dbtorms(float db){
+    return(fast_exp2(FASTLOG_LOG2_DB * db));
+}
+
+#endif
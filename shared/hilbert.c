@@ -0,0 +1,119 @@
+// Hilbert transformer and quadrature oscillator for [freq.shift~] and other
+// single sideband effects
+
+#include <m_pd.h>
+#include <math.h>
+#include "hilbert.h"
+
+#define TWO_PI (3.14159265358979323846 * 2.)
+
+#define A0 0.6923878
+#define A1 0.9360654322959
+#define A2 0.9882295226860
+#define A3 0.9987488452737
+#define B0 0.4021921162426
+#define B1 0.8561710882420
+#define B2 0.9722909545651
+#define B3 0.9952884791278
+
+// squared coefficients by section and lane
+static const float hilbert_coeff[HILBERT_SECTIONS][HILBERT_LANES] = {
+    {A0*A0, A0*A0, B0*B0, B0*B0},
+    {A1*A1, A1*A1, B1*B1, B1*B1},
+    {A2*A2, A2*A2, B2*B2, B2*B2},
+    {A3*A3, A3*A3, B3*B3, B3*B3}
+};
+
+void hilbert_clear(t_hilbert *h){
+    for(int k = 0; k < HILBERT_SECTIONS; k++)
+        for(int l = 0; l < HILBERT_LANES; l++)
+            h->h_x[k][l] = h->h_y[k][l] = 0;
+    h->h_delay = 0;
+    h->h_odd = 0;
+}
+
+// y[n] = a*a*(x[n] + y[n-2]) - x[n-2]
+static inline void hilbert_section(t_hilbert *h, int k, int l, float *v){
+    float t = v[l];
+    v[l] = hilbert_coeff[k][l] * (t + h->h_y[k][l]) - h->h_x[k][l];
+    h->h_x[k][l] = t;
+    h->h_y[k][l] = v[l];
+}
+
+void hilbert_perform(t_hilbert *h, int nblock, t_float *in, t_float *re, t_float *im){
+    int i = 0, odd = h->h_odd;
+    float delay = h->h_delay;
+    while(i < nblock){
+        if(!odd && i + 1 < nblock){ // an even and an odd sample in all lanes
+            float v[HILBERT_LANES] = {in[i], in[i+1], in[i], in[i+1]};
+            for(int k = 0; k < HILBERT_SECTIONS; k++)
+                for(int l = 0; l < HILBERT_LANES; l++)
+                    hilbert_section(h, k, l, v);
+            re[i] = delay, re[i+1] = v[0];
+            im[i] = -v[2], im[i+1] = -v[3];
+            delay = v[1];
+            i += 2;
+        }
+        else{ // a single sample, for blocks of 1
+            float v[HILBERT_LANES] = {in[i], in[i], in[i], in[i]};
+            for(int k = 0; k < HILBERT_SECTIONS; k++){
+                hilbert_section(h, k, odd, v);
+                hilbert_section(h, k, 2 + odd, v);
+            }
+            re[i] = delay;
+            im[i] = -v[2 + odd];
+            delay = v[odd];
+            odd = !odd;
+            i++;
+        }
+    }
+    h->h_delay = delay;
+    h->h_odd = odd;
+}
+
+void quadosc_init(t_quadosc *q, double sr){
+    q->q_sr = sr;
+    q->q_freq = 0;
+    q->q_cos = 1, q->q_sin = 0;
+    quadosc_phase(q, 0);
+}
+
+// only for setting the phase, running doesn't call libm
+void quadosc_phase(t_quadosc *q, double phase){
+    q->q_re = cos(phase * TWO_PI);
+    q->q_im = sin(phase * TWO_PI);
+}
+
+// cosine and sine of the step for 'freq': taylor series for half the angle,
+// within +-PI/2, then the double angle formulas
+static void quadosc_step(t_quadosc *q, double freq){
+    double cycles = freq / q->q_sr;
+    cycles -= (double)(long)(cycles + (cycles < 0 ? -0.5 : 0.5)); // within +-0.5
+    double x = cycles * (TWO_PI * 0.5), x2 = x*x;
+    double s = x * (1 - x2/6 * (1 - x2/20 * (1 - x2/42 * (1 - x2/72 * (1 - x2/110)))));
+    double c = 1 - x2/2 * (1 - x2/12 * (1 - x2/30 * (1 - x2/56 * (1 - x2/90 * (1 - x2/132)))));
+    q->q_sin = 2*s*c;
+    q->q_cos = c*c - s*s;
+    q->q_freq = freq;
+}
+
+void quadosc_sr(t_quadosc *q, double sr){
+    q->q_sr = sr;
+    quadosc_step(q, q->q_freq);
+}
+
+void quadosc_perform(t_quadosc *q, int nblock, t_float *freq, t_float *re, t_float *im){
+    double r = q->q_re, m = q->q_im;
+    for(int i = 0; i < nblock; i++){
+        if(freq[i] != q->q_freq)
+            quadosc_step(q, freq[i]);
+        re[i] = r, im[i] = m;
+        double t = r*q->q_cos - m*q->q_sin;
+        m = r*q->q_sin + m*q->q_cos;
+        r = t;
+    }
+    // one newton step back to the unit circle, the error is never large
+    double g = 1.5 - 0.5 * (r*r + m*m);
+    q->q_re = r * g;
+    q->q_im = m * g;
+}
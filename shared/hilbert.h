@@ -0,0 +1,45 @@
+// Hilbert transformer and quadrature oscillator for [freq.shift~] and other
+// single sideband effects
+
+// The Hilbert transformer is a pair of allpass chains whose outputs stay 90
+// degrees apart, after Olli Niemitalo's design: 4 sections in z^-2 per chain,
+// within a degree of quadrature from 20hz to 20khz at 44.1khz
+// (http://yehar.com/blog/?p=368). The z^-2 sections only look two samples
+// back, so even and odd samples run as separate streams: each section
+// processes two samples of both chains at once, a 4 lane vector.
+
+#ifndef __HILBERT_H__
+#define __HILBERT_H__
+
+#define HILBERT_SECTIONS 4
+#define HILBERT_LANES 4     // chain * 2 + sample parity
+
+typedef struct _hilbert{
+    float   h_x[HILBERT_SECTIONS][HILBERT_LANES]; // input and output two samples back
+    float   h_y[HILBERT_SECTIONS][HILBERT_LANES];
+    float   h_delay;        // the one sample delay of the first chain
+    int     h_odd;          // parity of the next sample
+}t_hilbert;
+
+// the complex sinusoid is a vector rotated by the frequency at every sample,
+// renormalized at the end of each block
+typedef struct _quadosc{
+    double  q_re, q_im;
+    double  q_cos, q_sin;   // the rotation for 'q_freq'
+    double  q_freq;
+    double  q_sr;
+}t_quadosc;
+
+void hilbert_clear(t_hilbert *h);
+// 'in' to its analytic signal, 'im' lags 're' by 90 degrees (a cosine gives
+// a sine), the outputs may be 'in'
+void hilbert_perform(t_hilbert *h, int nblock, t_float *in, t_float *re, t_float *im);
+
+void quadosc_init(t_quadosc *q, double sr);
+void quadosc_sr(t_quadosc *q, double sr);
+// set phase in cycles
+void quadosc_phase(t_quadosc *q, double phase);
+// a cosine and sine at frequency 'freq', in hz for each sample
+void quadosc_perform(t_quadosc *q, int nblock, t_float *freq, t_float *re, t_float *im);
+
+#endif
@@ -138,7 +138,10 @@ typedef struct _mifireadtx{
 
 struct _mifiread{
     t_pd         *mr_owner;
-    FILE         *mr_fp;
+    uchar        *mr_data;       /* the whole file */
+    size_t        mr_size;
+    size_t        mr_pos;        /* read position in mr_data */
+    size_t        mr_start;      /* the first track chunk */
     t_mifiheader  mr_header;
     t_mifievent   mr_event;
     uint32        mr_scoretime;  /* current time in hardticks */
@@ -156,7 +159,9 @@ struct _mifiread{
     uchar         mr_nframes;    /* fps if nonzero, else use metrical time */
     uint16        mr_format;     /* anything > 0 handled as 1, FIXME */
     uint32        mr_bytesleft;  /* nbytes remaining to be read from a track */
-    int           mr_pass;
+    int           mr_pass;       /* 1 analysing, 2 doit, 3 streaming */
+    int           mr_isnewtrack; /* streaming: no track event read yet */
+    t_symbol     *mr_tname;      /* streaming: name before a track's events */
     int           mr_eof;        /* set in case of early eof (error) */
     int           mr_newtrack;   /* reset after reading track's first event */
     t_mifireadtx  mr_ticks;
@@ -353,18 +358,19 @@ static void mifiread_earlyeof(t_mifiread *mr)
     mr->mr_eof = 1;
 }
 
+/* The file is read into memory at once and parsed from there. */
+
 /* Get next byte from track data.  On error: return 0 (which is a valid
    result) and set mr->mr_eof. */
 static uchar mifiread_getbyte(t_mifiread *mr){
     if(mr->mr_bytesleft){
-        int c;
-        if((c = fgetc(mr->mr_fp)) == EOF){
+        if(mr->mr_pos >= mr->mr_size){
             mifiread_earlyeof(mr);
             return(0);
         }
         else{
             mr->mr_bytesleft--;
-            return((uchar)c);
+            return(mr->mr_data[mr->mr_pos++]);
         }
     }
     else
@@ -372,10 +378,14 @@ static uchar mifiread_getbyte(t_mifiread *mr){
 }
 
 static uint32 mifiread_getbytes(t_mifiread *mr, uchar *buf, uint32 size){
-    size_t res;
+    size_t res = size;
     if(size > mr->mr_bytesleft)
-        size = mr->mr_bytesleft;
-    if((res = fread(buf, 1, (size_t)size, mr->mr_fp)) == size)
+        res = size = mr->mr_bytesleft;
+    if(res > mr->mr_size - mr->mr_pos)
+        res = mr->mr_size - mr->mr_pos;
+    memcpy(buf, mr->mr_data + mr->mr_pos, res);
+    mr->mr_pos += res;
+    if(res == size)
         mr->mr_bytesleft -= res;
     else
         mifiread_earlyeof(mr);
@@ -385,29 +395,36 @@ static uint32 mifiread_getbytes(t_mifiread *mr, uchar *buf, uint32 size){
 static int mifiread_skipbytes(t_mifiread *mr, uint32 size){
     if(size > mr->mr_bytesleft)
         size = mr->mr_bytesleft;
-    if(size){
-        int res = fseek(mr->mr_fp, size, SEEK_CUR);
-        if(res < 0)
-            mifiread_earlyeof(mr);
-        else
-            mr->mr_bytesleft -= size;
-        return(res);
+    if(size > mr->mr_size - mr->mr_pos){
+        mr->mr_pos = mr->mr_size;
+        mifiread_earlyeof(mr);
+        return(-1);
     }
-    else
-        return(0);
+    mr->mr_pos += size;
+    mr->mr_bytesleft -= size;
+    return(0);
 }
 
+/* On a varlen cut short by the end of the data or the track: return what
+   was read and set mr->mr_eof, like mifiread_getbyte(). */
 static uint32 mifiread_getvarlen(t_mifiread *mr){
-    uint32 n = 0;
-    uchar c;
-    uint32 count = mr->mr_bytesleft;
+    uint32 n = 0, count = mr->mr_bytesleft, max;
+    const uchar *p = mr->mr_data + mr->mr_pos;
     if(count > 4)
         count = 4;
+    if(count > mr->mr_size - mr->mr_pos)
+        count = mr->mr_size - mr->mr_pos;
+    max = count;
     while(count--){
-        n = (n << 7) + ((c = mifiread_getbyte(mr)) & 0x7f);
+        uchar c = *p++;
+        n = (n << 7) + (c & 0x7f);
         if((c & 0x80) == 0)
             break;
     }
+    mr->mr_bytesleft -= p - (mr->mr_data + mr->mr_pos);
+    mr->mr_pos = p - mr->mr_data;
+    if(count == (uint32)-1 && max < 4) // no last byte and no room for one
+        mifiread_earlyeof(mr);
     return(n);
 }
 
@@ -461,7 +478,8 @@ static void mifiread_resetticks(t_mifiread *mr){
 static void mifiread_reset(t_mifiread *mr){
     mr->mr_eof = 0;
     mr->mr_newtrack = 0;
-    mr->mr_fp = 0;
+    mr->mr_data = 0;
+    mr->mr_size = mr->mr_pos = mr->mr_start = 0;
     mr->mr_format = 0;
     mr->mr_nframes = 0;
     mr->mr_tempo = MIFIHARD_DEFTEMPO;
@@ -472,6 +490,8 @@ static void mifiread_reset(t_mifiread *mr){
     mr->mr_channel = 0;
     mr->mr_bytesleft = 0;
     mr->mr_pass = 0;
+    mr->mr_isnewtrack = 0;
+    mr->mr_tname = 0;
     mr->mr_hdtracks = 1;
     mr->mr_tracknames = 0;
     mifiread_updateticks(mr);
@@ -487,12 +507,13 @@ void mifiread_setuserticks(t_mifiread *mr, double wholeticks){
     mifiread_updateticks(mr);
 }
 
-/* open a file and read its header */
+/* read a file into memory and get its header */
 static int mifiread_startfile(t_mifiread *mr, const char *filename,
 const char *dirname, int complain){
     char errmess[MAXPDSTRING], path[MAXPDSTRING], *fnameptr;
     int fd = open_via_path(dirname, filename, "", path, &fnameptr, MAXPDSTRING, 1);
-    mr->mr_fp = 0;
+    FILE *fp = 0;
+    long size;
     if(fd < 0){
         strcpy(errmess, "cannot open");
         goto rstartfailed;
@@ -505,48 +526,72 @@ const char *dirname, int complain){
         if(fnameptr != slashpos)
             strcpy(slashpos, fnameptr);
     }
-    if(!(mr->mr_fp = sys_fopen(path, "rb"))){
+    if(!(fp = sys_fopen(path, "rb"))){
         strcpy(errmess, "cannot open");
         goto rstartfailed;
     }
-    if(fread(&mr->mr_header, 1, MIFIHARD_HEADERSIZE, mr->mr_fp) < MIFIHARD_HEADERSIZE){
+    if(fseek(fp, 0, SEEK_END) < 0 || (size = ftell(fp)) < 0 || fseek(fp, 0, SEEK_SET) < 0){
+        strcpy(errmess, "cannot read");
+        goto rstartfailed;
+    }
+    if(size < MIFIHARD_HEADERSIZE){
         strcpy(errmess, "missing header of");
         goto rstartfailed;
     }
+    if(!(mr->mr_data = getbytes(size))){
+        strcpy(errmess, "no memory for");
+        goto rstartfailed;
+    }
+    mr->mr_size = size;
+    if(fread(mr->mr_data, 1, size, fp) < (size_t)size){
+        strcpy(errmess, "cannot read");
+        goto rstartfailed;
+    }
+    fclose(fp);
+    memcpy(&mr->mr_header, mr->mr_data, MIFIHARD_HEADERSIZE);
+    mr->mr_pos = MIFIHARD_HEADERSIZE;
     return(1);
 rstartfailed:
     if(complain)
         mifi_error(mr->mr_owner, "%s file \"%s\" (errno %d: %s)", errmess, filename, errno, strerror(errno));
-    if(mr->mr_fp){
-        fclose(mr->mr_fp);
-        mr->mr_fp = 0;
+    if(fp)
+        fclose(fp);
+    if(mr->mr_data){
+        freebytes(mr->mr_data, mr->mr_size);
+        mr->mr_data = 0;
+        mr->mr_size = 0;
     }
     return(0);
 }
 
 static int mifiread_starttrack(t_mifiread *mr){
     t_mifitrackheader th;
-    long skip;
+    size_t skip;
     int notyet = 1;
     do{
-        if(fread(&th, 1, MIFIHARD_TRACKHEADERSIZE, mr->mr_fp) < MIFIHARD_TRACKHEADERSIZE)
+        if(mr->mr_size - mr->mr_pos < MIFIHARD_TRACKHEADERSIZE)
             goto nomoretracks;
+        memcpy(&th, mr->mr_data + mr->mr_pos, MIFIHARD_TRACKHEADERSIZE);
+        mr->mr_pos += MIFIHARD_TRACKHEADERSIZE;
         th.th_length = mifi_swap4(th.th_length);
         if(strncmp(th.th_type, "MTrk", 4)){
             char buf[8];
             strncpy(buf, th.th_type, 4);
             buf[4] = 0;
-            if(mr->mr_pass == 1)
+            if(mr->mr_pass != 2)
                 mifi_warning(mr->mr_owner, "unknown chunk %s in midi file... skipped", buf);
         }
         else if(th.th_length < MIFI_SHORTESTEVENT){
-            if(mr->mr_pass == 1)
+            if(mr->mr_pass != 2)
                 mifi_warning(mr->mr_owner, "empty track in midi file... skipped");
         }
         else
             notyet = 0;
-        if(notyet && (skip = th.th_length) && fseek(mr->mr_fp, skip, SEEK_CUR) < 0)
-            goto nomoretracks;
+        if(notyet && (skip = th.th_length)){
+            if(skip > mr->mr_size - mr->mr_pos)
+                goto nomoretracks;
+            mr->mr_pos += skip;
+        }
     } while(notyet);
     mr->mr_scoretime = 0;
     mr->mr_newtrack = 1;
@@ -554,7 +599,7 @@ static int mifiread_starttrack(t_mifiread *mr){
     mr->mr_bytesleft = th.th_length;
     return(1);
 nomoretracks:
-    if(mr->mr_ntracks == 0 && mr->mr_pass == 1)
+    if(mr->mr_ntracks == 0 && mr->mr_pass != 2)
         mifi_warning(mr->mr_owner, "no valid miditracks");
     return(0);
 }
@@ -576,7 +621,7 @@ nextattempt:
             ep->e_channel = mr->mr_channel;
         }
         else{
-            if(mr->mr_pass == 1)
+            if(mr->mr_pass != 2)
                 mifi_warning(mr->mr_owner, "missing running status in midi file... skip to end of track");
             goto endoftrack;
         }
@@ -625,7 +670,7 @@ nextattempt:
         if(ep->e_meta > 127){
 	    /* try to skip corrupted meta-event (quietly) */
 #ifdef MIFI_VERBOSE
-            if(mr->mr_pass == 1)
+            if(mr->mr_pass != 2)
                 mifi_warning(mr->mr_owner, "bad meta: %d > 127", ep->e_meta);
 #endif
             if(mifiread_skipbytes(mr, length) < 0)
@@ -636,7 +681,7 @@ nextattempt:
             case MIFIMETA_EOT:
                 if(length){ /* corrupted eot: ignore and skip to the real end of track */
 #ifdef MIFI_VERBOSE
-                    if(mr->mr_pass == 1)
+                    if(mr->mr_pass != 2)
                         mifi_warning(mr->mr_owner, "corrupted eot, length %d", length);
 #endif
                     goto endoftrack;
@@ -644,7 +689,7 @@ nextattempt:
                 break;
             case MIFIMETA_TEMPO:
                 if(length != 3){
-                    if(mr->mr_pass == 1)
+                    if(mr->mr_pass != 2)
                         mifi_warning(mr->mr_owner,"corrupted tempo event in midi file... skip to end of track");
                     goto endoftrack;
                 }
@@ -658,7 +703,7 @@ nextattempt:
                 break;
             case MIFIMETA_TIMESIG:
                 if(length != 4){
-                    if(mr->mr_pass == 1)
+                    if(mr->mr_pass != 2)
                         mifi_warning(mr->mr_owner, "corrupted time signature event in midi file... skip to end of track");
                     goto endoftrack;
                 }
@@ -670,7 +715,7 @@ nextattempt:
                     mr->mr_meternum = mr->mr_meterden = 4;
                 mifiread_updateticks(mr);
 /* #ifdef MIFI_DEBUG
-	    if(mr->mr_pass == 1)
+	    if(mr->mr_pass != 2)
 		loudbug_post("barspan (hard) %g", mr->mr_ticks.rt_hardbar);
 #endif */
                 break;
@@ -688,7 +733,7 @@ nextattempt:
         }
     }
     else{
-        if(mr->mr_pass == 1)
+        if(mr->mr_pass != 2)
             mifi_warning(mr->mr_owner, "unknown event type in midi file... skip to end of track");
         goto endoftrack;
     }
@@ -700,20 +745,15 @@ endoftrack:
         return(MIFIREAD_SKIP);
 }
 
-static int mifiread_restart(t_mifiread *mr, int complain){
+static int mifiread_restart(t_mifiread *mr){
     mr->mr_eof = 0;
     mr->mr_newtrack = 0;
     mr->mr_status = 0;
     mr->mr_channel = 0;
     mr->mr_bytesleft = 0;
     mr->mr_pass = 0;
-    if(fseek(mr->mr_fp, 0, SEEK_SET)){
-        if(complain)
-            mifi_error(mr->mr_owner, "file error (errno %d: %s)", errno, strerror(errno));
-        return(0);
-    }
-    else
-        return(1);
+    mr->mr_pos = mr->mr_start;
+    return(1);
 }
 
 static int mifiread_doopen(t_mifiread *mr, const char *filename, const char *dirname, int complain){
@@ -728,9 +768,11 @@ static int mifiread_doopen(t_mifiread *mr, const char *filename, const char *dir
         goto badheader;
     if((skip = mr->mr_header.h_length - MIFIHARD_HEADERDATASIZE)){
         mifi_warning(mr->mr_owner, "%ld extra bytes of midi file header... skipped", skip);
-        if(fseek(mr->mr_fp, skip, SEEK_CUR) < 0)
+        if(skip > (long)(mr->mr_size - mr->mr_pos))
             goto badstart;
+        mr->mr_pos += skip;
     }
+    mr->mr_start = mr->mr_pos;
     mr->mr_format = mifi_swap2(mr->mr_header.h_format);
     mr->mr_hdtracks = mifi_swap2(mr->mr_header.h_ntracks);
     if(mr->mr_hdtracks > 1000)  /* a sanity check */
@@ -761,11 +803,30 @@ badheader:
     if(complain)
         mifi_error(mr->mr_owner, "\"%s\" is not a valid midi file", filename);
 badstart:
-    fclose(mr->mr_fp);
-    mr->mr_fp = 0;
+    freebytes(mr->mr_data, mr->mr_size);
+    mr->mr_data = 0;
+    mr->mr_size = 0;
     return(0);
 }
 
+/* The text of a track name meta-event without surrounding spaces, and with
+   spaces, commas and semicolons replaced, or 0 if it's empty. */
+static char *mifiread_trackname(t_mifievent *ep){
+    char *p1 = (char *)(ep->e_data), *p2;
+    while(*p1 == ' ')
+        p1++;
+    if(!*p1)
+        return(0);
+    p2 = (char *)(ep->e_data + ep->e_length - 1);
+    while(p2 > p1 && *p2 == ' ')
+        *p2-- = '\0';
+    p2 = p1;
+    do if(*p2 == ' ' || *p2 == ',' || *p2 == ';')
+        *p2 = '-';
+    while(*++p2);
+    return(p1);
+}
+
 /* Gather statistics (nevents, ntracks, ntempi), pick track names, and
    allocate the maps.  To be called in the first pass of reading.
    LATER consider optional reading of nonchannel events. */
@@ -819,26 +880,15 @@ static int mifiread_analyse(t_mifiread *mr, int complain){
             if(evtype == MIFIMETA_TEMPO)
                 mr->mr_ntempi++;
             else if(evtype == MIFIMETA_TRACKNAME){
-                char *p1 = (char *)(ep->e_data);
-                if(*p1 && !*tnamebuf){ /* take the first one */
-                    while(*p1 == ' ')
-                        p1++;
-                    if(*p1){
-                        char *p2 = (char *)(ep->e_data + ep->e_length - 1);
-                        while(p2 > p1 && *p2 == ' ')
-                            *p2-- = '\0';
-                        p2 = p1;
-                        do if(*p2 == ' ' || *p2 == ',' || *p2 == ';')
-                            *p2 = '-';
-                        while(*++p2);
-                        if(tnamep){
-                            if(*tnamep == &s_)
-                            /* trackname after channel-event */
-                                *tnamep = gensym(p1);
-                            else
-                                strcpy(tnamebuf, p1);
-                        }
+                char *p1;
+                if(!*tnamebuf && (p1 = mifiread_trackname(ep))){ /* take the first one */
+                    if(tnamep){
+                        if(*tnamep == &s_)
+                        /* trackname after channel-event */
+                            *tnamep = gensym(p1);
                     }
+                    else
+                        strcpy(tnamebuf, p1);
                 }
             }
         }
@@ -898,6 +948,57 @@ doitfail:
     return(MIFIREAD_FATAL);
 }
 
+/* Streaming: the file is opened without the first pass, and each call
+   returns the next event in file order (a whole track after the other)
+   until MIFIREAD_EOF or MIFIREAD_FATAL, the mifiread_get... calls of a
+   hook work on it. */
+int mifiread_openstream(t_mifiread *mr, const char *filename, const char *dirname, int complain){
+    if(!mifiread_doopen(mr, filename, dirname, complain))
+        return(0);
+    mr->mr_pass = 3;
+    mr->mr_ntracks = 0;
+    mr->mr_nevents = 0;
+    mr->mr_ntempi = 0;
+    mr->mr_trackndx = 0;
+    return(1);
+}
+
+int mifiread_next(t_mifiread *mr){
+    int evtype;
+    while((evtype = mifiread_nextevent(mr)) == MIFIREAD_SKIP)
+        ;
+    if(evtype < 0)
+        return(evtype);
+    if(mr->mr_newtrack){
+        mr->mr_isnewtrack = 1;
+        mr->mr_tname = 0;
+    }
+    if(MIFI_ISCHANNEL(evtype) || evtype == MIFIMETA_EOT){
+        if(mr->mr_isnewtrack){
+            mr->mr_isnewtrack = 0;
+            if(mr->mr_ntracks >= mr->mr_hdtracks){
+                mifi_error(mr->mr_owner, "midi file has more tracks than header-declared %d", mr->mr_hdtracks);
+                return(MIFIREAD_FATAL);
+            }
+            mr->mr_trackndx = mr->mr_ntracks++;
+            mr->mr_tracknames[mr->mr_trackndx] = mr->mr_tname;
+        }
+        mr->mr_nevents++;
+    }
+    else if(evtype == MIFIMETA_TEMPO)
+        mr->mr_ntempi++;
+    else if(evtype == MIFIMETA_TRACKNAME){
+        char *name = mifiread_trackname(&mr->mr_event);
+        if(name && mr->mr_isnewtrack){ /* before the track's events */
+            if(!mr->mr_tname)
+                mr->mr_tname = gensym(name);
+        }
+        else if(name && !mr->mr_tracknames[mr->mr_trackndx])
+            mr->mr_tracknames[mr->mr_trackndx] = gensym(name);
+    }
+    return(evtype);
+}
+
 /* mifiread_get... calls to be used in the main read routine */
 
 int mifiread_getnevents(t_mifiread *mr){
@@ -954,28 +1055,40 @@ double mifiread_getmscoef(t_mifiread *mr){
 }
 
 t_symbol *mifiread_gettrackname(t_mifiread *mr){
-    if(mr->mr_pass == 2 && mr->mr_tracknames && mr->mr_trackndx < mr->mr_ntracks)
-        return(mr->mr_tracknames[mr->mr_trackndx]);
+    if(mr->mr_pass >= 2 && mr->mr_tracknames && mr->mr_trackndx < mr->mr_ntracks){
+        t_symbol **tnamep = mr->mr_tracknames + mr->mr_trackndx;
+        if(!*tnamep){ /* streaming, no name yet */
+            char tnamebuf[MAXPDSTRING];
+            sprintf(tnamebuf, "%d-track", mr->mr_trackndx);
+            *tnamep = gensym(tnamebuf);
+        }
+        return(*tnamep);
+    }
     else{
         post("bug: mifiread_gettrackname");
         return(0);
     }
 }
 
+/* index of the current track, among those with events */
+int mifiread_gettrackndx(t_mifiread *mr){
+    return(mr->mr_trackndx);
+}
+
 unsigned mifiread_getstatus(t_mifiread *mr){
-    if(mr->mr_pass != 2)
+    if(mr->mr_pass < 2)
         post("bug: mifiread_getstatus");
     return(mr->mr_event.e_status);
 }
 
 unsigned mifiread_getdata1(t_mifiread *mr){
-    if(mr->mr_pass != 2)
+    if(mr->mr_pass < 2)
         post("bug: mifiread_getdata1");
     return(mr->mr_event.e_data[0]);
 }
 
 unsigned mifiread_getdata2(t_mifiread *mr){
-    if(mr->mr_pass != 2)
+    if(mr->mr_pass < 2)
         post("bug: mifiread_getdata2");
     if(mr->mr_event.e_length < 2)
         post("bug: mifiread_getdata2");
@@ -983,7 +1096,7 @@ unsigned mifiread_getdata2(t_mifiread *mr){
 }
 
 unsigned mifiread_getchannel(t_mifiread *mr){
-    if(mr->mr_pass != 2)
+    if(mr->mr_pass < 2)
         post("bug: mifiread_getchannel");
     return(mr->mr_event.e_channel);
 }
@@ -995,17 +1108,20 @@ t_pd *mifiread_getowner(t_mifiread *mr){
 int mifiread_open(t_mifiread *mr, const char *filename, const char *dirname, int complain){
     return(mifiread_doopen(mr, filename, dirname, complain) &&
 	    (mifiread_analyse(mr, complain) == MIFIREAD_EOF) &&
-	    mifiread_restart(mr, complain));
+	    mifiread_restart(mr));
 }
 
 void mifiread_close(t_mifiread *mr){
     mr->mr_pass = 0;
-    if(mr->mr_fp){
-        fclose(mr->mr_fp);
-        mr->mr_fp = 0;
+    if(mr->mr_data){
+        freebytes(mr->mr_data, mr->mr_size);
+        mr->mr_data = 0;
+        mr->mr_size = 0;
     }
-    if(mr->mr_tracknames)
+    if(mr->mr_tracknames){
         freebytes(mr->mr_tracknames, mr->mr_hdtracks * sizeof(*mr->mr_tracknames));
+        mr->mr_tracknames = 0;
+    }
 }
 
 void mifiread_free(t_mifiread *mr){
@@ -78,6 +78,7 @@ double mifiread_getscoretime(t_mifiread *mr);
 double mifiread_gettempo(t_mifiread *mr);
 double mifiread_getmscoef(t_mifiread *mr);
 t_symbol *mifiread_gettrackname(t_mifiread *mr);
+int mifiread_gettrackndx(t_mifiread *mr);
 unsigned mifiread_getstatus(t_mifiread *mr);
 unsigned mifiread_getdata1(t_mifiread *mr);
 unsigned mifiread_getdata2(t_mifiread *mr);
@@ -89,6 +90,10 @@ void mifiread_setuserticks(t_mifiread *mr, double wholeticks);
 int mifiread_open(t_mifiread *mr, const char *filename,
 		  const char *dirname, int complain);
 int mifiread_doit(t_mifiread *mr, t_mifireadhook hook, void *hookdata);
+/* single pass reading, event by event (see mifi.c) */
+int mifiread_openstream(t_mifiread *mr, const char *filename,
+			const char *dirname, int complain);
+int mifiread_next(t_mifiread *mr);
 void mifiread_close(t_mifiread *mr);
 void mifiread_free(t_mifiread *mr);
 
@@ -0,0 +1,67 @@
+// additive oscillator bank shared by [oscbank~] and [oscbank2~]
+
+#include <m_pd.h>
+#include <math.h>
+#include "oscbank.h"
+
+#define TWOPI (3.14159265358979323846 * 2)
+
+// sin(2 * pi * x) for x from 0 to 2, the phase is folded into a quarter cycle
+// and evaluated with a polynomial (error around 1e-7) instead of calling sin()
+// for every oscillator, there are no branches or floor() calls so the loop
+// over the bank vectorizes
+static inline t_float oscbank_sin(double x){
+    t_float y = x - (x >= 0.5) - (x >= 1.5); // -0.5 to 0.5
+    t_float a = 0.25 - fabs(0.25 - fabs(y)); // 0 to 0.25
+    t_float u = a * TWOPI, u2 = u * u;
+    t_float p = u * (1 + u2 * (-1./6 + u2 * (1./120 + u2 * (-1./5040
+        + u2 * (1./362880 + u2 * (-1./39916800))))));
+    return(y < 0 ? -p : p);
+}
+
+void oscbank_init(t_oscbank *b, int n, t_float freq, t_float ramp){
+    bank_init(&b->b_bank, n, ramp);
+    n = b->b_bank.b_n;
+    b->b_phase = (double *)getbytes(n * sizeof(double));
+    bank_param_init(&b->b_freq, n, freq);
+    bank_param_init(&b->b_amp, n, 1);
+    bank_param_init(&b->b_offset, n, 0);
+}
+
+void oscbank_free(t_oscbank *b){
+    int n = b->b_bank.b_n;
+    freebytes(b->b_phase, n * sizeof(double));
+    bank_param_free(&b->b_freq, n);
+    bank_param_free(&b->b_amp, n);
+    bank_param_free(&b->b_offset, n);
+    bank_free(&b->b_bank);
+}
+
+void oscbank_set(t_oscbank *b, void *owner, t_bank_param *p, int ac, t_atom *av, int jump){
+    int n = bank_read(&b->b_bank, owner, ac, av);
+    if(p == &b->b_offset) for(int i = 0; i < n; i++) // phases from 0 to 1
+        b->b_bank.b_tmp[i] -= floor(b->b_bank.b_tmp[i]);
+    bank_apply(&b->b_bank, p, n, jump);
+}
+
+void oscbank_perform(t_oscbank *b, int nblock, t_float *freq, t_float *out){
+    int n = b->b_bank.b_n;
+    double rsr = 1. / b->b_bank.b_sr, *phase = b->b_phase;
+    t_float gain = 1. / n;
+    t_float *hz = b->b_freq.p_val, *amp = b->b_amp.p_val, *offset = b->b_offset.p_val;
+    for(int i = 0; i < nblock; i++){
+        double scale = (freq ? freq[i] : 1) * rsr;
+        t_float sum = 0;
+        for(int k = 0; k < n; k++){
+            double ph = phase[k], step = hz[k] * scale;
+            step = step > 0.5 ? 0.5 : step < -0.5 ? -0.5 : step; // clipped to nyquist
+            sum += amp[k] * oscbank_sin(ph + offset[k]);
+            ph += step;
+            phase[k] = ph - (ph >= 1) + (ph < 0);
+        }
+        out[i] = sum * gain;
+        bank_param_advance(&b->b_freq, n, 1);
+        bank_param_advance(&b->b_amp, n, 1);
+        bank_param_advance(&b->b_offset, n, 1);
+    }
+}
@@ -0,0 +1,25 @@
+// additive oscillator bank shared by [oscbank~] and [oscbank2~]
+
+#ifndef __OSCBANK_H__
+#define __OSCBANK_H__
+
+#include "bank.h"
+
+typedef struct _oscbank{
+    t_bank       b_bank;
+    double      *b_phase;   // running phase of each oscillator
+    t_bank_param b_freq;    // ratio ([oscbank~]) or frequency in hz ([oscbank2~])
+    t_bank_param b_amp;
+    t_bank_param b_offset;  // phase offset
+}t_oscbank;
+
+void oscbank_init(t_oscbank *b, int n, t_float freq, t_float ramp);
+void oscbank_free(t_oscbank *b);
+// set ratios/frequencies, amplitudes or phases from a list or array, the
+// values ramp over each oscillator's ramp time (or jump if 'jump' is set)
+void oscbank_set(t_oscbank *b, void *owner, t_bank_param *p, int ac, t_atom *av, int jump);
+// sum the bank into 'out', 'freq' is the fundamental that multiplies the
+// ratios ([oscbank~]) or NULL when b_freq is already in hz ([oscbank2~])
+void oscbank_perform(t_oscbank *b, int nblock, t_float *freq, t_float *out);
+
+#endif
@@ -0,0 +1,135 @@
+// 2x, 4x and 8x oversampling for nonlinear objects ([drive~], [shaper~],
+// [fold~], [wrap2~]), see oversample.h
+
+#include <m_pd.h>
+#include <math.h>
+#include "oversample.h"
+
+// allpass coefficients of each octave, alternating between the even and odd
+// chains, and their transition bandwidths relative to the higher rate
+static const int oversample_ncoefs[OVERSAMPLE_MAX_STAGES] = {8, 4, 4};
+
+static const float oversample_coefs[OVERSAMPLE_MAX_STAGES][OVERSAMPLE_MAX_COEFS] = {
+    {0.054333721650, 0.195751043209, 0.376030828100, 0.550960285942, // 0.0226
+     0.697004235415, 0.809822229284, 0.895994035375, 0.966569768715},
+    {0.068833225195, 0.252219560295, 0.505996957989, 0.813394666607}, // 0.125
+    {0.051860621461, 0.200845421380, 0.437059787177, 0.773433352009}  // 0.1875
+};
+
+void oversample_init(t_oversample *o, int factor){
+    o->o_buf = o->o_tmp = NULL;
+    o->o_nblock = 0;
+    o->o_factor = 1;
+    oversample_factor(o, factor);
+}
+
+void oversample_free(t_oversample *o){
+    freebytes(o->o_buf, o->o_nblock * o->o_factor * sizeof(t_float));
+    freebytes(o->o_tmp, o->o_nblock * o->o_factor * sizeof(t_float));
+}
+
+void oversample_clear(t_oversample *o){
+    for(int s = 0; s < OVERSAMPLE_MAX_STAGES; s++){
+        for(int k = 0; k < OVERSAMPLE_MAX_COEFS; k++){
+            o->o_up[s].h_x[k] = o->o_up[s].h_y[k] = 0;
+            o->o_down[s].h_x[k] = o->o_down[s].h_y[k] = 0;
+        }
+    }
+}
+
+static void oversample_resize(t_oversample *o, int nblock, int factor){
+    int old = o->o_nblock * o->o_factor, size = nblock * factor;
+    if(size != old){
+        o->o_buf = (t_float *)resizebytes(o->o_buf, old * sizeof(t_float), size * sizeof(t_float));
+        o->o_tmp = (t_float *)resizebytes(o->o_tmp, old * sizeof(t_float), size * sizeof(t_float));
+    }
+    o->o_nblock = nblock;
+    o->o_factor = factor;
+}
+
+int oversample_factor(t_oversample *o, int factor){
+    int shift = factor >= 8 ? 3 : factor >= 4 ? 2 : factor >= 2 ? 1 : 0;
+    oversample_resize(o, o->o_nblock, 1 << shift);
+    o->o_shift = o->o_nstages = shift;
+    oversample_clear(o);
+    return(factor == (1 << shift));
+}
+
+void oversample_dsp(t_oversample *o, int nblock){
+    oversample_resize(o, nblock, o->o_factor);
+}
+
+// flush denormals from the allpass states at the end of a block
+static void oversample_land(t_halfband *h, int nc){
+    for(int k = 0; k < nc; k++){
+        if(fabsf(h->h_x[k]) < 1e-20f)
+            h->h_x[k] = 0;
+        if(fabsf(h->h_y[k]) < 1e-20f)
+            h->h_y[k] = 0;
+    }
+}
+
+// one octave up: each input sample goes through both chains, the even chain
+// gives the first output sample and the odd one the second
+static void oversample_up_stage(t_halfband *h, int s, int n, t_float *in, t_float *out){
+    const float *c = oversample_coefs[s];
+    int nc = oversample_ncoefs[s];
+    for(int i = 0; i < n; i++){
+        float even = in[i], odd = in[i];
+        for(int k = 0; k < nc; k += 2){
+            float x0 = h->h_x[k], x1 = h->h_x[k+1];
+            h->h_x[k] = even, h->h_x[k+1] = odd;
+            even = (even - h->h_y[k]) * c[k] + x0;
+            odd = (odd - h->h_y[k+1]) * c[k+1] + x1;
+            h->h_y[k] = even, h->h_y[k+1] = odd;
+        }
+        out[2*i] = even;
+        out[2*i+1] = odd;
+    }
+    oversample_land(h, nc);
+}
+
+// one octave down: the two chains take alternate samples and are averaged
+static void oversample_down_stage(t_halfband *h, int s, int n, t_float *in, t_float *out){
+    const float *c = oversample_coefs[s];
+    int nc = oversample_ncoefs[s];
+    for(int i = 0; i < n; i++){
+        float even = in[2*i+1], odd = in[2*i];
+        for(int k = 0; k < nc; k += 2){
+            float x0 = h->h_x[k], x1 = h->h_x[k+1];
+            h->h_x[k] = even, h->h_x[k+1] = odd;
+            even = (even - h->h_y[k]) * c[k] + x0;
+            odd = (odd - h->h_y[k+1]) * c[k+1] + x1;
+            h->h_y[k] = even, h->h_y[k+1] = odd;
+        }
+        out[i] = 0.5f * (even + odd);
+    }
+    oversample_land(h, nc);
+}
+
+t_float *oversample_up(t_oversample *o, t_float *in){
+    int n = o->o_nblock, ns = o->o_nstages;
+    t_float *src = in;
+    for(int s = 0; s < ns; s++, n *= 2){
+        // alternate buffers so the last octave lands in 'o_buf'
+        t_float *dst = (ns - 1 - s) % 2 ? o->o_tmp : o->o_buf;
+        oversample_up_stage(&o->o_up[s], s, n, src, dst);
+        src = dst;
+    }
+    if(!ns) for(int i = 0; i < n; i++)
+        o->o_buf[i] = in[i];
+    return(o->o_buf);
+}
+
+void oversample_down(t_oversample *o, t_float *out){
+    int ns = o->o_nstages, n = o->o_nblock << ns;
+    t_float *src = o->o_buf;
+    for(int s = ns - 1; s >= 0; s--){
+        n /= 2;
+        t_float *dst = !s ? out : src == o->o_buf ? o->o_tmp : o->o_buf;
+        oversample_down_stage(&o->o_down[s], s, n, src, dst);
+        src = dst;
+    }
+    if(!ns) for(int i = 0; i < n; i++)
+        out[i] = o->o_buf[i];
+}
@@ -0,0 +1,47 @@
+// 2x, 4x and 8x oversampling for nonlinear objects ([drive~], [shaper~],
+// [fold~], [wrap2~]): their kernel runs on an upsampled copy of the block,
+// which then goes back down to the host rate, so the harmonics it creates
+// above the host nyquist are filtered instead of aliasing
+
+// Each octave is a polyphase IIR half-band filter: two chains of first order
+// allpasses, one for the even and one for the odd samples at the higher rate,
+// designed as in Laurent de Soras' HIIR library. The first octave has a sharp
+// transition (flat to 20khz at 44.1khz, 84dB below), later octaves only have
+// to remove images far above the audio band and use fewer coefficients.
+
+#ifndef __OVERSAMPLE_H__
+#define __OVERSAMPLE_H__
+
+#define OVERSAMPLE_MAX_STAGES 3
+#define OVERSAMPLE_MAX_COEFS 8
+
+typedef struct _halfband{
+    float   h_x[OVERSAMPLE_MAX_COEFS]; // allpass input and output states
+    float   h_y[OVERSAMPLE_MAX_COEFS];
+}t_halfband;
+
+typedef struct _oversample{
+    int         o_factor;   // 1, 2, 4 or 8
+    int         o_nstages;
+    int         o_shift;    // log2 of the factor
+    int         o_nblock;   // host block size
+    t_halfband  o_up[OVERSAMPLE_MAX_STAGES];
+    t_halfband  o_down[OVERSAMPLE_MAX_STAGES];
+    t_float    *o_buf;      // the upsampled block
+    t_float    *o_tmp;      // intermediate octaves
+}t_oversample;
+
+void oversample_init(t_oversample *o, int factor);
+void oversample_free(t_oversample *o);
+void oversample_clear(t_oversample *o);
+// the factor is rounded down to a power of 2 up to 8, returns 0 if it was
+// none of 1, 2, 4 or 8
+int oversample_factor(t_oversample *o, int factor);
+// size the buffers for the host block
+void oversample_dsp(t_oversample *o, int nblock);
+// 'in' upsampled to a block of nblock * factor, the kernel runs on it in place
+t_float *oversample_up(t_oversample *o, t_float *in);
+// the upsampled block back to 'out' at the host rate
+void oversample_down(t_oversample *o, t_float *out);
+
+#endif
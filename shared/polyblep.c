@@ -0,0 +1,287 @@
+// polyBLEP oscillator core shared by the bl.* oscillators
+
+#include <m_pd.h>
+#include <math.h>
+#include "polyblep.h"
+
+static inline t_float phasewrap(t_float phase){
+    return(phase - floor(phase));
+}
+
+static inline t_float square(t_float x){
+    return(x * x);
+}
+
+static inline t_float blep(t_float phase, t_float dt){
+    if(phase < dt)
+        return(-square(phase / dt - 1));
+    else if(phase > 1 - dt)
+        return(square((phase - 1) / dt + 1));
+    else
+        return(0.0);
+}
+
+static inline t_float blamp(t_float phase, t_float dt){
+    if(phase < dt){
+        phase = phase / dt - 1.0;
+        return(-1.0 / 3.0 * square(phase) * phase);
+    }
+    else if(phase > 1.0 - dt){
+        phase = (phase - 1.0) / dt + 1.0;
+        return(1.0 / 3.0 * square(phase) * phase);
+    }
+    else
+        return(0.0);
+}
+
+static inline t_float tri_naive(t_float phase){
+    t_float y = phase * 2;
+    return(y >= 1.5 ? (y - 2) * 2 : y >= 0.5 ? 1 - (y - 0.5) * 2 : y * 2);
+}
+
+void polyblep_init(t_polyblep *x, t_polyblep_shape shape, t_float pulse_width){
+    x->shape = shape;
+    x->pulse_width = pulse_width;
+    x->phase = 0.0;
+    x->freq_in_seconds_per_sample = 0;
+    x->last_phase_offset = 0;
+    x->sr = sys_getsr();
+    x->table = 0;
+    x->tri = 0;
+    blep_clear(&x->blep);
+}
+
+void polyblep_table(t_polyblep *x, int table){
+    x->table = table;
+    blep_clear(&x->blep);
+    x->tri = tri_naive(x->phase);
+}
+
+void polyblep_buf_init(t_polyblep_buf *b){
+    b->b_phase = b->b_dt = b->b_width = b->b_tmp = NULL;
+    b->b_index = NULL;
+    b->b_n = 0;
+}
+
+void polyblep_buf_resize(t_polyblep_buf *b, int n){
+    if(n == b->b_n)
+        return;
+    b->b_phase = (t_float *)resizebytes(b->b_phase, b->b_n * sizeof(t_float), n * sizeof(t_float));
+    b->b_dt = (t_float *)resizebytes(b->b_dt, b->b_n * sizeof(t_float), n * sizeof(t_float));
+    b->b_width = (t_float *)resizebytes(b->b_width, b->b_n * sizeof(t_float), n * sizeof(t_float));
+    b->b_tmp = (t_float *)resizebytes(b->b_tmp, b->b_n * sizeof(t_float), n * sizeof(t_float));
+    b->b_index = (int *)resizebytes(b->b_index, b->b_n * sizeof(int), n * sizeof(int));
+    b->b_n = n;
+}
+
+void polyblep_buf_free(t_polyblep_buf *b){
+    if(b->b_n){
+        freebytes(b->b_phase, b->b_n * sizeof(t_float));
+        freebytes(b->b_dt, b->b_n * sizeof(t_float));
+        freebytes(b->b_width, b->b_n * sizeof(t_float));
+        freebytes(b->b_tmp, b->b_n * sizeof(t_float));
+        freebytes(b->b_index, b->b_n * sizeof(int));
+    }
+    polyblep_buf_init(b);
+}
+
+// first pass: phase accumulation, sync and phase modulation for the block
+static void polyblep_phases(t_polyblep *x, t_polyblep_buf *b, int n,
+t_float *freq, t_float *width, t_float *sync, t_float *phase_in){
+    t_float phase = x->phase, last = x->last_phase_offset;
+    t_float rsr = 1. / x->sr;
+    for(int i = 0; i < n; i++){
+        if(sync && sync[i] > 0 && sync[i] <= 1) // Phase sync
+            phase = phasewrap(sync[i]);
+        else if(phase_in){ // Phase modulation
+            double phase_dev = phase_in[i] - last;
+            if(phase_dev >= 1 || phase_dev <= -1)
+                phase_dev = fmod(phase_dev, 1);
+            phase = phasewrap(phase + phase_dev);
+        }
+        if(phase_in)
+            last = phase_in[i];
+        b->b_phase[i] = phase;
+        phase = phasewrap(phase + (b->b_dt[i] = freq[i] * rsr));
+    }
+    x->phase = phase;
+    x->last_phase_offset = last;
+    x->freq_in_seconds_per_sample = b->b_dt[n-1];
+    if(width){ // Update pulse width, limit between 0 and 1
+        for(int i = 0; i < n; i++){
+            t_float pw = width[i];
+            b->b_width[i] = pw < 0.0001 ? 0.0001 : pw > 0.9999 ? 0.9999 : pw;
+        }
+        x->pulse_width = b->b_width[n-1];
+    }
+    else{
+        t_float pw = x->pulse_width;
+        pw = pw < 0.0001 ? 0.0001 : pw > 0.9999 ? 0.9999 : pw;
+        for(int i = 0; i < n; i++)
+            b->b_width[i] = pw;
+    }
+}
+
+// second pass: naive waveform, no branches so it can be vectorized
+static void polyblep_naive(t_polyblep *x, t_polyblep_buf *b, int n, t_float *out){
+    t_float *ph = b->b_phase, *pw = b->b_width, *dt = b->b_dt;
+    switch(x->shape){
+        case POLYBLEP_SAW:
+            if(x->table){ // the minimum phase steps lag the naive ramp by blep_delay
+                for(int i = 0; i < n; i++)
+                    out[i] = 1 - 2 * ph[i] + 2 * dt[i] * blep_delay;
+            }
+            else for(int i = 0; i < n; i++)
+                out[i] = 1 - 2 * ph[i];
+            break;
+        case POLYBLEP_SAW2:
+            for(int i = 0; i < n; i++)
+                out[i] = 2 * phasewrap(ph[i] + 0.5) - 1;
+            break;
+        case POLYBLEP_SQUARE:
+            for(int i = 0; i < n; i++)
+                out[i] = ph[i] < pw[i] ? 1 : -1;
+            break;
+        case POLYBLEP_TRIANGLE:
+            if(x->table){ // square to be integrated
+                for(int i = 0; i < n; i++)
+                    out[i] = (ph[i] < 0.25 || ph[i] >= 0.75) ? 1 : -1;
+            }
+            else for(int i = 0; i < n; i++)
+                out[i] = tri_naive(ph[i]);
+            break;
+        case POLYBLEP_VSAW:
+            for(int i = 0; i < n; i++){
+                t_float y = ph[i] * 2, w = pw[i];
+                out[i] = y >= 2 - w ? (y - 2) / w : y >= w ? 1 - (y - w) / (1 - w) : y / w;
+            }
+            break;
+        default:
+            for(int i = 0; i < n; i++)
+                out[i] = 0;
+    }
+}
+
+// collect the samples that are within one increment of the discontinuity
+// located at phase 'offset' + 'scale' * pulse width
+static int polyblep_find(t_polyblep_buf *b, int n, t_float offset, t_float scale){
+    int k = 0;
+    for(int i = 0; i < n; i++){
+        t_float t = b->b_phase[i] + offset + scale * b->b_width[i];
+        t -= (int)t;
+        t_float dt = fabs(b->b_dt[i]);
+        b->b_index[k] = i;
+        k += (t < dt || t > 1 - dt);
+    }
+    return(k);
+}
+
+// add a polyBLEP (ramp = 0) or polyBLAMP (ramp = 1) at the found samples,
+// ramps are scaled by the slope change
+static void polyblep_apply(t_polyblep *x, t_polyblep_buf *b, int n, t_float *out,
+t_float offset, t_float scale, t_float gain, int ramp){
+    int k = polyblep_find(b, n, offset, scale);
+    for(int j = 0; j < k; j++){
+        int i = b->b_index[j];
+        t_float pw = b->b_width[i];
+        t_float t = b->b_phase[i] + offset + scale * pw;
+        t -= (int)t;
+        t_float dt = fabs(b->b_dt[i]);
+        if(!ramp)
+            out[i] += gain * blep(t, dt);
+        else if(x->shape == POLYBLEP_VSAW)
+            out[i] += gain * dt / (pw - pw * pw) * blamp(t, dt);
+        else
+            out[i] += gain * dt * blamp(t, dt);
+    }
+}
+
+// table mode: add table BLEPs where the phase crosses 'edge' going up
+// (a step of 'height') or down (-'height')
+static void polyblep_table_steps(t_polyblep *x, t_polyblep_buf *b, int n,
+t_float *out, t_float edge, int use_width, t_float height){
+    int k = 0;
+    for(int i = 0; i < n; i++){
+        t_float e = use_width ? b->b_width[i] : edge;
+        t_float from = b->b_phase[i], to = from + b->b_dt[i];
+        b->b_index[k] = i;
+        k += (from < e && to >= e) || to >= e + 1 // going up, also after wrapping
+            || (from >= e && to < e) || to < e - 1; // going down
+    }
+    for(int j = 0; j < k; j++){
+        int i = b->b_index[j];
+        t_float e = use_width ? b->b_width[i] : edge;
+        t_float dt = b->b_dt[i], to = b->b_phase[i] + dt;
+        if(dt > 0){ // crossed going up, maybe after wrapping
+            t_float d = to >= e + 1 ? to - 1 - e : to - e;
+            blep_step_block(&x->blep, out, n, i + 1, d / dt, height);
+        }
+        else{
+            t_float d = to < e - 1 ? to + 1 - e : to - e;
+            blep_step_block(&x->blep, out, n, i + 1, d / dt, -height);
+        }
+    }
+}
+
+void polyblep_perform(t_polyblep *x, t_polyblep_buf *b, int n, t_float *freq,
+t_float *width, t_float *sync, t_float *phase, t_float *out){
+    t_float start = x->phase;
+    t_float *y = x->table && x->shape == POLYBLEP_TRIANGLE ? b->b_tmp : out;
+    polyblep_phases(x, b, n, freq, width, sync, phase);
+    polyblep_naive(x, b, n, y);
+    // third pass: corrections only where there's a discontinuity
+    int table = x->table && (x->shape == POLYBLEP_SAW
+        || x->shape == POLYBLEP_SQUARE || x->shape == POLYBLEP_TRIANGLE);
+    if(table){
+        blep_add(&x->blep, y, n);
+        switch(x->shape){
+            case POLYBLEP_SAW:
+                polyblep_table_steps(x, b, n, y, 1, 0, 2);
+                break;
+            case POLYBLEP_SQUARE:
+                polyblep_table_steps(x, b, n, y, 0, 1, -2);
+                polyblep_table_steps(x, b, n, y, 1, 0, 2);
+                break;
+            case POLYBLEP_TRIANGLE:
+                polyblep_table_steps(x, b, n, y, 0.25, 0, -2);
+                polyblep_table_steps(x, b, n, y, 0.75, 0, 2);
+                break;
+            default:
+                break;
+        }
+    }
+    else switch(x->shape){
+        case POLYBLEP_SAW:
+            polyblep_apply(x, b, n, y, 0, 0, 1, 0);
+            break;
+        case POLYBLEP_SAW2:
+            polyblep_apply(x, b, n, y, 0.5, 0, -1, 0);
+            break;
+        case POLYBLEP_SQUARE:
+            polyblep_apply(x, b, n, y, 0, 0, 1, 0);
+            polyblep_apply(x, b, n, y, 1, -1, -1, 0);
+            break;
+        case POLYBLEP_TRIANGLE:
+            polyblep_apply(x, b, n, y, 0.25, 0, 4, 1);
+            polyblep_apply(x, b, n, y, 0.75, 0, -4, 1);
+            break;
+        case POLYBLEP_VSAW:
+            polyblep_apply(x, b, n, y, 0, 0.5, 1, 1);
+            polyblep_apply(x, b, n, y, 1, -0.5, -1, 1);
+            break;
+    }
+    if(table && x->shape == POLYBLEP_TRIANGLE){
+        // leaky integration of the table BLEP square, phase jumps from
+        // sync or phase modulation are followed by the naive triangle
+        t_float tri = x->tri, expected = start;
+        for(int i = 0; i < n; i++){
+            t_float ph = b->b_phase[i], dt = b->b_dt[i];
+            if(ph != expected)
+                tri += tri_naive(ph) - tri_naive(expected);
+            tri = (1 - 0.02 * fabs(dt)) * tri + 4 * dt * y[i];
+            expected = phasewrap(ph + dt);
+            out[i] = tri;
+        }
+        x->tri = tri;
+    }
+}
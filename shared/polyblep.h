@@ -0,0 +1,56 @@
+// polyBLEP oscillator core shared by the bl.* oscillators
+
+// Based on LabSound polyBLEP oscillators, adapted from "Phaseshaping
+// Oscillator Algorithms for Musical Sound Synthesis" by Jari Kleimola,
+// Victor Lazzarini, Joseph Timoney, and Vesa Valimaki.
+// http://www.acoustics.hut.fi/publications/papers/smc2010-phaseshaping/
+
+#ifndef __POLYBLEP_H__
+#define __POLYBLEP_H__
+
+#include "blep.h"
+
+typedef enum _polyblep_shape{ // shapes before SAW have a pulse width
+    POLYBLEP_VSAW,
+    POLYBLEP_SQUARE,
+    POLYBLEP_SAW,
+    POLYBLEP_SAW2,
+    POLYBLEP_TRIANGLE
+}t_polyblep_shape;
+
+typedef struct _polyblep{
+    t_float pulse_width;    // Pulse width for square, morph-to-saw for triangle
+    t_float phase;          // The current phase of the oscillator.
+    t_float freq_in_seconds_per_sample;
+    t_float sr;
+    t_float last_phase_offset;
+    t_polyblep_shape shape;
+    int table;              // use minimum phase table BLEPs instead of polyBLEP
+    t_blep blep;
+    t_float tri;            // integrator state for the table triangle
+}t_polyblep;
+
+// per block scratch memory, it only holds data during one call
+typedef struct _polyblep_buf{
+    t_float *b_phase;       // phase of each sample
+    t_float *b_dt;          // phase increment of each sample
+    t_float *b_width;       // pulse width of each sample
+    t_float *b_tmp;         // table triangle: the square being integrated
+    int     *b_index;       // samples that need a correction
+    int      b_n;
+}t_polyblep_buf;
+
+void polyblep_init(t_polyblep *x, t_polyblep_shape shape, t_float pulse_width);
+void polyblep_table(t_polyblep *x, int table);
+
+void polyblep_buf_init(t_polyblep_buf *b);
+void polyblep_buf_resize(t_polyblep_buf *b, int n);
+void polyblep_buf_free(t_polyblep_buf *b);
+
+// render a block: first the phase of the whole block is accumulated, then
+// the naive waveform is written and corrections are only applied at the few
+// samples close to a discontinuity. 'width', 'sync' and 'phase' can be NULL
+void polyblep_perform(t_polyblep *x, t_polyblep_buf *b, int n, t_float *freq,
+    t_float *width, t_float *sync, t_float *phase, t_float *out);
+
+#endif
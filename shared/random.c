@@ -27,6 +27,13 @@ float random_frand(uint32_t *s1, uint32_t *s2, uint32_t *s3){
     return(u.f - 3.f);
 }
 
+void random_block(t_random_state* rstate, float *out, int n){
+    uint32_t s1 = rstate->s1, s2 = rstate->s2, s3 = rstate->s3;
+    for(int i = 0; i < n; i++)
+        out[i] = random_frand(&s1, &s2, &s3);
+    rstate->s1 = s1, rstate->s2 = s2, rstate->s3 = s3;
+}
+
 int32_t random_hash(int32_t inKey){
     // Thomas Wang's integer hash (a faster hash for integers, also very good).
     // http://www.concentric.net/~Ttwang/tech/inthash.htm
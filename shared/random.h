@@ -15,6 +15,8 @@ void random_init(t_random_state* rstate, int seed);
 int get_seed(t_symbol *s, int ac, t_atom *av, int n);
 uint32_t random_trand(uint32_t* s1, uint32_t* s2, uint32_t* s3);
 float random_frand(uint32_t* s1, uint32_t* s2, uint32_t* s3);
+// a block of 'n' floats from -1 to 1, like random_frand()
+void random_block(t_random_state* rstate, float *out, int n);
 
 // These are for [pink~]
 
@@ -0,0 +1,177 @@
+// RBJ cookbook biquad coefficients shared by [lowpass~], [highpass~], [bandpass~],
+// [bandstop~], [resonant~], [eq~], [allpass.2nd~], [lowshelf~] and [highshelf~]
+
+#include <math.h>
+#include "rbj.h"
+
+#define PI 3.14159265358979323846
+#define HALF_PI 1.57079632679489661923
+#define HALF_LOG2 0.34657359027997264
+#define LOG1000 6.907755278982137
+#define LOG10_40 0.05756462732485115 // log(10)/40
+
+// sin and cos for 0 <= x <= PI, taylor series on [0, PI/2] and a mirror
+// above, the error is below 1e-7 and cos stays accurate close to 0
+static void rbj_sincos_fast(double x, double *s, double *c){
+    double sign = x > HALF_PI ? -1 : 1;
+    double u = x > HALF_PI ? PI - x : x, u2 = u*u;
+    *s = u * (1 - u2/6 * (1 - u2/20 * (1 - u2/42 * (1 - u2/72 * (1 - u2/110)))));
+    *c = sign * (1 - u2/2 * (1 - u2/12 * (1 - u2/30 * (1 - u2/56 * (1 - u2/90 * (1 - u2/132))))));
+}
+
+static double rbj_sinh_fast(double x){
+    if(x > 1){
+        double e = exp(x);
+        return((e - 1/e) * 0.5);
+    }
+    double x2 = x*x;
+    return(x * (1 + x2/6 * (1 + x2/20 * (1 + x2/42 * (1 + x2/72)))));
+}
+
+static void rbj_coeffs(t_rbj *r, double f, double reson, double db, t_rbj_coeffs *c){
+    if(f < 0.000001) // also for the creation arguments, 0 hz gives nan
+        f = 0.000001;
+    if(f > r->r_nyq - 0.000001)
+        f = r->r_nyq - 0.000001;
+    double omega = f * PI / r->r_nyq, sin_w, cos_w, q;
+    if(r->r_fast)
+        rbj_sincos_fast(omega, &sin_w, &cos_w);
+    else
+        sin_w = sin(omega), cos_w = cos(omega);
+    if(r->r_type == RBJ_LOWSHELF || r->r_type == RBJ_HIGHSHELF){ // reson is the slope
+        double amp = exp(db * LOG10_40);
+        double alphaS = sin_w * sqrt((amp*amp + 1) * (1/reson - 1) + 2*amp);
+        double sign = r->r_type == RBJ_LOWSHELF ? 1 : -1;
+        double b0 = (amp+1) + sign*(amp-1)*cos_w + alphaS;
+        c->a0 = amp*(amp+1 - sign*(amp-1)*cos_w + alphaS) / b0;
+        c->a1 = sign*2*amp*(amp-1 - sign*(amp+1)*cos_w) / b0;
+        c->a2 = amp*(amp+1 - sign*(amp-1)*cos_w - alphaS) / b0;
+        c->b1 = sign*2*(amp-1 + sign*(amp+1)*cos_w) / b0;
+        c->b2 = -(amp+1 + sign*(amp-1)*cos_w - alphaS) / b0;
+        return;
+    }
+    if(r->r_type == RBJ_RESONANT)
+        q = r->r_bw ? f * (PI * reson/1000) / LOG1000 : reson; // t60 in ms
+    else if(r->r_bw){ // reson is bw in octaves
+        if(reson < 0.000001)
+            reson = 0.000001;
+        double x = HALF_LOG2 * reson * omega/sin_w;
+        q = 1 / (2 * (r->r_fast ? rbj_sinh_fast(x) : sinh(x)));
+    }
+    else
+        q = reson;
+    if(q < 0.000001){ // force bypass
+        c->a0 = 1, c->a1 = c->a2 = c->b1 = c->b2 = 0;
+        return;
+    }
+    double alphaQ = sin_w / (2*q);
+    double b0 = alphaQ + 1;
+    c->b1 = 2*cos_w / b0;
+    c->b2 = (alphaQ - 1) / b0;
+    switch(r->r_type){
+        case RBJ_LOWPASS:
+            c->a1 = (1 - cos_w) / b0;
+            c->a0 = c->a2 = c->a1 * 0.5;
+            break;
+        case RBJ_HIGHPASS:
+            c->a1 = -(1 + cos_w) / b0;
+            c->a0 = c->a2 = -c->a1 * 0.5;
+            break;
+        case RBJ_BANDPASS:
+            c->a0 = alphaQ / b0;
+            c->a1 = 0;
+            c->a2 = -c->a0;
+            break;
+        case RBJ_RESONANT:
+            c->a0 = alphaQ*q / b0;
+            c->a1 = 0;
+            c->a2 = -c->a0;
+            break;
+        case RBJ_BANDSTOP:
+            c->a0 = c->a2 = 1 / b0;
+            c->a1 = -c->b1;
+            break;
+        case RBJ_ALLPASS:
+            c->a0 = (1 - alphaQ) / b0;
+            c->a1 = -c->b1;
+            c->a2 = 1;
+            break;
+        default:{ // RBJ_EQ
+            double amp = exp(db * LOG10_40);
+            b0 = alphaQ/amp + 1;
+            c->a0 = (1 + alphaQ*amp) / b0;
+            c->a1 = -2*cos_w / b0;
+            c->a2 = (1 - alphaQ*amp) / b0;
+            c->b1 = -c->a1;
+            c->b2 = (alphaQ/amp - 1) / b0;
+        }
+    }
+}
+
+void rbj_update(t_rbj *r, double f, double reson, double db){
+    r->r_f = f, r->r_reson = reson, r->r_db = db;
+    rbj_coeffs(r, f, reson, db, &r->r_c);
+}
+
+// start a control period: interpolate to the coefficients of the new
+// parameters over 'r_period' samples, this is the first of those samples
+void rbj_control(t_rbj *r, double f, double reson, double db){
+    r->r_count = r->r_period - 1;
+    if(f != r->r_f || reson != r->r_reson || db != r->r_db){
+        r->r_f = f, r->r_reson = reson, r->r_db = db;
+        rbj_coeffs(r, f, reson, db, &r->r_target);
+        double k = 1. / r->r_period;
+        r->r_inc.a0 = (r->r_target.a0 - r->r_c.a0) * k;
+        r->r_inc.a1 = (r->r_target.a1 - r->r_c.a1) * k;
+        r->r_inc.a2 = (r->r_target.a2 - r->r_c.a2) * k;
+        r->r_inc.b1 = (r->r_target.b1 - r->r_c.b1) * k;
+        r->r_inc.b2 = (r->r_target.b2 - r->r_c.b2) * k;
+        r->r_c.a0 += r->r_inc.a0;
+        r->r_c.a1 += r->r_inc.a1;
+        r->r_c.a2 += r->r_inc.a2;
+        r->r_c.b1 += r->r_inc.b1;
+        r->r_c.b2 += r->r_inc.b2;
+        r->r_glide = 1;
+    }
+    else if(r->r_glide){ // landed, get rid of rounding errors
+        r->r_c = r->r_target;
+        r->r_glide = 0;
+    }
+}
+
+void rbj_set(t_rbj *r, double f, double reson, double db){
+    rbj_update(r, f, reson, db);
+    r->r_glide = r->r_count = 0;
+}
+
+void rbj_nyq(t_rbj *r, double nyq){
+    if(nyq != r->r_nyq){
+        r->r_nyq = nyq;
+        rbj_set(r, r->r_f, r->r_reson, r->r_db);
+    }
+}
+
+void rbj_bw(t_rbj *r, int bw){
+    r->r_bw = bw;
+    rbj_set(r, r->r_f, r->r_reson, r->r_db);
+}
+
+void rbj_period(t_rbj *r, int n){
+    r->r_period = n < 1 ? 1 : n;
+    rbj_set(r, r->r_f, r->r_reson, r->r_db);
+}
+
+void rbj_fast(t_rbj *r, int fast){
+    r->r_fast = fast;
+    rbj_set(r, r->r_f, r->r_reson, r->r_db);
+}
+
+void rbj_init(t_rbj *r, t_rbj_type type, int bw, double nyq){
+    r->r_type = type;
+    r->r_bw = bw;
+    r->r_fast = 0;
+    r->r_period = 1;
+    r->r_glide = r->r_count = 0;
+    r->r_nyq = nyq;
+    r->r_f = r->r_reson = r->r_db = 0;
+}
@@ -0,0 +1,72 @@
+// RBJ cookbook biquad coefficients shared by [lowpass~], [highpass~], [bandpass~],
+// [bandstop~], [resonant~], [eq~], [allpass.2nd~], [lowshelf~] and [highshelf~]
+
+#ifndef __RBJ_H__
+#define __RBJ_H__
+
+typedef enum _rbj_type{
+    RBJ_LOWPASS,
+    RBJ_HIGHPASS,
+    RBJ_BANDPASS,
+    RBJ_BANDSTOP,
+    RBJ_RESONANT,   // constant peak gain bandpass
+    RBJ_EQ,         // peaking eq, needs a gain in dB
+    RBJ_ALLPASS,
+    RBJ_LOWSHELF,   // shelves take a slope instead of 'reson' and a gain in dB
+    RBJ_HIGHSHELF
+}t_rbj_type;
+
+// y[n] = a0*x[n] + a1*x[n-1] + a2*x[n-2] + b1*y[n-1] + b2*y[n-2]
+typedef struct _rbj_coeffs{
+    double a0, a1, a2, b1, b2;
+}t_rbj_coeffs;
+
+typedef struct _rbj{
+    t_rbj_type   r_type;
+    int          r_bw;      // 'reson' is a bandwidth in octaves ([resonant~]: a t60 in ms)
+    int          r_fast;    // polynomial sin/cos/sinh instead of libm
+    int          r_period;  // control rate: new coefficients every r_period samples
+    int          r_count;   // samples left to the next control rate update
+    int          r_glide;   // coefficients are being interpolated
+    double       r_nyq;
+    double       r_f, r_reson, r_db;    // parameters of the last computed coefficients
+    t_rbj_coeffs r_c;       // coefficients in use
+    t_rbj_coeffs r_target;  // coefficients being interpolated to
+    t_rbj_coeffs r_inc;     // per sample increment towards r_target
+}t_rbj;
+
+void rbj_init(t_rbj *r, t_rbj_type type, int bw, double nyq);
+// compute the coefficients for 'f' (in hz), 'reson' (q, bandwidth, t60 or
+// slope) and 'db' straight away, any interpolation is dropped
+void rbj_set(t_rbj *r, double f, double reson, double db);
+void rbj_nyq(t_rbj *r, double nyq);
+void rbj_bw(t_rbj *r, int bw);
+// 0 or 1 computes the coefficients at every sample, larger periods compute
+// them every 'n' samples and interpolate in between
+void rbj_period(t_rbj *r, int n);
+void rbj_fast(t_rbj *r, int fast);
+void rbj_update(t_rbj *r, double f, double reson, double db);
+void rbj_control(t_rbj *r, double f, double reson, double db);
+
+// call once per sample with the current parameters before filtering with r_c,
+// unchanged parameters never recompute the coefficients
+static inline void rbj_tick(t_rbj *r, double f, double reson, double db){
+    if(r->r_period > 1){
+        if(r->r_count > 0){
+            r->r_count--;
+            if(r->r_glide){
+                r->r_c.a0 += r->r_inc.a0;
+                r->r_c.a1 += r->r_inc.a1;
+                r->r_c.a2 += r->r_inc.a2;
+                r->r_c.b1 += r->r_inc.b1;
+                r->r_c.b2 += r->r_inc.b2;
+            }
+        }
+        else
+            rbj_control(r, f, reson, db);
+    }
+    else if(f != r->r_f || reson != r->r_reson || db != r->r_db)
+        rbj_update(r, f, reson, db);
+}
+
+#endif
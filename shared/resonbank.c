@@ -0,0 +1,161 @@
+// resonator/bandpass filter bank shared by [resonbank~], [resonbank2~] and [bpbank~]
+
+#include <m_pd.h>
+#include <math.h>
+#include "resonbank.h"
+
+#define PI 3.14159265358979323846
+#define LOG1000 6.907755278982137
+
+// the biquads of [resonant~] and [bandpass~], 'reson' is a t60 decay in ms
+// (a q for [bpbank~]), a q of 0 bypasses the filter
+static void resonbank_biquad(t_resonbank *b, int j, double f, double reson, double gain){
+    double nyq = b->b_bank.b_sr * 0.5;
+    if(f < 0.000001)
+        f = 0.000001;
+    if(f > nyq - 0.000001)
+        f = nyq - 0.000001;
+    double omega = f * PI / nyq;
+    double q = b->b_mode == RESONBANK_BANDPASS ? reson : f * (PI * reson / 1000) / LOG1000;
+    if(q < 0.000001){ // bypass
+        b->b_a0[j] = 1, b->b_a2[j] = b->b_b1[j] = b->b_b2[j] = 0;
+    }
+    else{
+        double alphaQ = sin(omega) / (2*q);
+        double b0 = alphaQ + 1;
+        b->b_a0[j] = (b->b_mode == RESONBANK_BANDPASS ? alphaQ : alphaQ*q) / b0;
+        b->b_a2[j] = -b->b_a0[j];
+        b->b_b1[j] = 2*cos(omega) / b0;
+        b->b_b2[j] = (alphaQ - 1) / b0;
+    }
+    b->b_gain[j] = gain;
+}
+
+static void resonbank_band(t_resonbank *b, int k){
+    double f = b->b_freq.p_val[k], reson = b->b_reson.p_val[k];
+    double amp = b->b_amp.p_val[k];
+    if(b->b_mode != RESONBANK_RESON2){
+        resonbank_biquad(b, k, f, reson, amp);
+        return;
+    }
+    // [resonant2~]: decay minus attack resonator, normalized to a peak of 1
+    int j = k + b->b_bank.b_n;
+    double t1 = b->b_attack.p_val[k], t2 = reson, norm = 1;
+    if(t1 > 0 && t2 > 0){
+        double a = 1000 * LOG1000 / t1, d = 1000 * LOG1000 / t2;
+        if(a == d)
+            a *= 1.000001;
+        double t = log(a/d) / (a-d);
+        norm = fabs(1/(exp(-d*t) - exp(-a*t)));
+    }
+    resonbank_biquad(b, k, f, t2, amp * norm); // no decay is a bypass
+    if(t1 > 0)
+        resonbank_biquad(b, j, f, t1, -amp * norm);
+    else{ // no attack
+        b->b_a0[j] = b->b_a2[j] = b->b_b1[j] = b->b_b2[j] = b->b_gain[j] = 0;
+        b->b_y1[j] = b->b_y2[j] = 0;
+    }
+}
+
+// advance the ramps by a block and update the coefficients of the bands that changed
+static void resonbank_update(t_resonbank *b, int nblock){
+    int n = b->b_bank.b_n, *dirty = b->b_dirty;
+    t_bank_param *p[4] = {&b->b_freq, &b->b_reson, &b->b_attack, &b->b_amp};
+    int ramping = 0;
+    for(int i = 0; i < 4; i++)
+        ramping |= p[i]->p_ramping;
+    if(!ramping && !b->b_update)
+        return;
+    for(int i = 0; i < 4; i++) if(p[i]->p_ramping){
+        int *left = p[i]->p_left;
+        for(int k = 0; k < n; k++)
+            dirty[k] |= left[k] > 0;
+        bank_param_advance(p[i], n, nblock);
+    }
+    for(int k = 0; k < n; k++) if(dirty[k]){
+        resonbank_band(b, k);
+        dirty[k] = 0;
+    }
+    b->b_update = 0;
+}
+
+void resonbank_init(t_resonbank *b, t_resonbank_mode mode, int n, t_float ramp){
+    bank_init(&b->b_bank, n, ramp);
+    n = b->b_bank.b_n;
+    b->b_mode = mode;
+    bank_param_init(&b->b_freq, n, 0);
+    bank_param_init(&b->b_reson, n, 0);
+    bank_param_init(&b->b_attack, n, 0);
+    bank_param_init(&b->b_amp, n, 1);
+    b->b_dirty = (int *)getbytes(n * sizeof(int));
+    int nf = b->b_nfilters = mode == RESONBANK_RESON2 ? 2*n : n;
+    b->b_a0 = (double *)getbytes(7 * nf * sizeof(double));
+    b->b_a2 = b->b_a0 + nf;
+    b->b_b1 = b->b_a2 + nf;
+    b->b_b2 = b->b_b1 + nf;
+    b->b_gain = b->b_b2 + nf;
+    b->b_y1 = b->b_gain + nf;
+    b->b_y2 = b->b_y1 + nf;
+    b->b_x1 = b->b_x2 = 0;
+    for(int k = 0; k < n; k++)
+        b->b_dirty[k] = 1;
+    b->b_update = 1;
+    resonbank_update(b, 0);
+}
+
+void resonbank_free(t_resonbank *b){
+    int n = b->b_bank.b_n;
+    bank_param_free(&b->b_freq, n);
+    bank_param_free(&b->b_reson, n);
+    bank_param_free(&b->b_attack, n);
+    bank_param_free(&b->b_amp, n);
+    freebytes(b->b_dirty, n * sizeof(int));
+    freebytes(b->b_a0, 7 * b->b_nfilters * sizeof(double));
+    bank_free(&b->b_bank);
+}
+
+void resonbank_set(t_resonbank *b, void *owner, t_bank_param *p, int ac, t_atom *av, int jump){
+    int n = bank_read(&b->b_bank, owner, ac, av);
+    bank_apply(&b->b_bank, p, n, jump);
+    for(int k = 0; k < n; k++)
+        b->b_dirty[k] = 1;
+    b->b_update = 1;
+}
+
+void resonbank_clear(t_resonbank *b){
+    for(int j = 0; j < b->b_nfilters; j++)
+        b->b_y1[j] = b->b_y2[j] = 0;
+    b->b_x1 = b->b_x2 = 0;
+}
+
+void resonbank_sr(t_resonbank *b, t_float sr){
+    if(sr == b->b_bank.b_sr)
+        return;
+    b->b_bank.b_sr = sr;
+    for(int k = 0; k < b->b_bank.b_n; k++)
+        b->b_dirty[k] = 1;
+    b->b_update = 1;
+}
+
+void resonbank_perform(t_resonbank *b, int nblock, t_float *in, t_float *out){
+    resonbank_update(b, nblock);
+    int nf = b->b_nfilters;
+    double *a0 = b->b_a0, *a2 = b->b_a2, *b1 = b->b_b1, *b2 = b->b_b2;
+    double *gain = b->b_gain, *y1 = b->b_y1, *y2 = b->b_y2;
+    double x1 = b->b_x1, x2 = b->b_x2;
+    t_float norm = 1. / b->b_bank.b_n;
+    for(int i = 0; i < nblock; i++){
+        double xn = in[i], sum = 0;
+        for(int j = 0; j < nf; j++){ // all filters at once, this vectorizes
+            double yn = a0[j] * xn + a2[j] * x2 + b1[j] * y1[j] + b2[j] * y2[j];
+            y2[j] = y1[j];
+            y1[j] = yn;
+            sum += gain[j] * yn;
+        }
+        out[i] = sum * norm;
+        x2 = x1;
+        x1 = xn;
+    }
+    b->b_x1 = x1;
+    b->b_x2 = x2;
+}
@@ -0,0 +1,40 @@
+// resonator/bandpass filter bank shared by [resonbank~], [resonbank2~] and [bpbank~]
+
+#ifndef __RESONBANK_H__
+#define __RESONBANK_H__
+
+#include "bank.h"
+
+typedef enum _resonbank_mode{
+    RESONBANK_RESON,        // [resonbank~]: 'reson' is a decay time (t60 in ms)
+    RESONBANK_RESON2,       // [resonbank2~]: decay and attack times
+    RESONBANK_BANDPASS      // [bpbank~]: 'reson' is q
+}t_resonbank_mode;
+
+typedef struct _resonbank{
+    t_bank           b_bank;
+    t_resonbank_mode b_mode;
+    t_bank_param     b_freq;
+    t_bank_param     b_reson;   // decay time or q
+    t_bank_param     b_attack;  // [resonbank2~] only
+    t_bank_param     b_amp;
+    int             *b_dirty;   // bands whose coefficients need an update
+    int              b_update;
+    // one biquad per band ([resonbank2~] has another one for the attack
+    // after them), coefficients and state in arrays so all filters run in
+    // one vectorized loop. The input history is the same for all filters
+    int              b_nfilters;
+    double          *b_a0, *b_a2, *b_b1, *b_b2, *b_gain;
+    double          *b_y1, *b_y2;
+    double           b_x1, b_x2;
+}t_resonbank;
+
+void resonbank_init(t_resonbank *b, t_resonbank_mode mode, int n, t_float ramp);
+void resonbank_free(t_resonbank *b);
+// set frequencies, decays/qs, attacks or amplitudes from a list or array
+void resonbank_set(t_resonbank *b, void *owner, t_bank_param *p, int ac, t_atom *av, int jump);
+void resonbank_clear(t_resonbank *b);
+void resonbank_sr(t_resonbank *b, t_float sr);
+void resonbank_perform(t_resonbank *b, int nblock, t_float *in, t_float *out);
+
+#endif
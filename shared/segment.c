@@ -0,0 +1,84 @@
+// line segments for [envgen~] and [function~], see segment.h
+
+#include <m_pd.h>
+#include <math.h>
+#include "fastlog.h"
+#include "segment.h"
+
+static inline float segment_pow(float t, float p){
+    if(t >= 1)
+        return(1);
+    if(t < 1e-20f)
+        return(p == 0);
+    return(fast_exp2(p * fast_log2(t)));
+}
+
+float segment_shape(float t, float power, int flip){
+    if(fabsf(power) == 1) // linear
+        return(t);
+    float p = fabsf(power);
+    return(flip ? 1 - segment_pow(1 - t, p) : segment_pow(t, p));
+}
+
+// the curve after 'pos' samples, the mirror takes 1-t from the samples
+// left so it stays exact where the curve is steep
+static float segment_curve(t_segment *s, int pos){
+    float p = fabsf(s->s_power);
+    if(s->s_flip)
+        return(1 - segment_pow((float)(s->s_n - pos) / s->s_n, p));
+    return(segment_pow((float)pos / s->s_n, p));
+}
+
+void segment_start(t_segment *s, float start, float target, int n, float power, int flip){
+    s->s_start = s->s_value = start;
+    s->s_target = target;
+    s->s_power = power;
+    s->s_flip = flip;
+    s->s_n = n < 1 ? 1 : n;
+    s->s_pos = s->s_end = 0;
+    if(fabsf(power) == 1 || start == target)
+        s->s_chord = s->s_n;
+    else if(fabsf(power) < 1) // infinitely steep at one end, chords can't follow it
+        s->s_chord = 1;
+    else{ // a chord of length h misses the curve by at most p(p-1)h^2/8
+        float p = fabsf(power);
+        int chords = (int)ceilf(sqrtf(p * (p - 1) / (8 * SEGMENT_ERROR)));
+        s->s_chord = (s->s_n + chords - 1) / chords;
+    }
+}
+
+void segment_set(t_segment *s, float value){
+    s->s_start = s->s_target = s->s_value = s->s_next = value;
+    s->s_n = s->s_pos = s->s_end = 0;
+    s->s_inc = 0;
+}
+
+int segment_render(t_segment *s, t_float *out, int n){
+    int done = 0;
+    while(done < n && s->s_pos < s->s_n){
+        if(s->s_pos == s->s_end){ // next chord
+            int end = s->s_pos + s->s_chord;
+            if(end >= s->s_n){
+                end = s->s_n;
+                s->s_next = s->s_target;
+            }
+            else
+                s->s_next = s->s_start + (s->s_target - s->s_start) * segment_curve(s, end);
+            s->s_inc = (s->s_next - s->s_value) / (end - s->s_pos);
+            s->s_end = end;
+        }
+        int m = s->s_end - s->s_pos;
+        if(m > n - done)
+            m = n - done;
+        float v = s->s_value, inc = s->s_inc;
+        for(int i = 0; i < m; i++)
+            out[done + i] = v + (i + 1) * inc;
+        s->s_pos += m;
+        done += m;
+        if(s->s_pos == s->s_end) // land on the chord exactly
+            out[done - 1] = s->s_value = s->s_next;
+        else
+            s->s_value = v + m * inc;
+    }
+    return(done);
+}
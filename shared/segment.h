@@ -0,0 +1,43 @@
+// line segments for [envgen~] and [function~]
+
+// A segment goes from its start to its target in 'n' samples. Curved
+// segments follow t^p (or its mirror 1-(1-t)^p) and are drawn as chords,
+// as many as needed to stay within SEGMENT_ERROR of the curve, so it is only
+// evaluated at the end of each chord and the samples in between are one add
+// each. Segments shorter than that are evaluated at every sample and so are
+// exact, linear segments are a single chord. Exponents below 1 have an
+// infinite slope at one end, so those curves are evaluated at every sample.
+
+#ifndef __SEGMENT_H__
+#define __SEGMENT_H__
+
+#define SEGMENT_ERROR 1e-5f // of the segment's range
+
+typedef struct _segment{
+    float   s_start;    // value at the start
+    float   s_target;
+    float   s_power;    // exponent of the curve, 1 or -1 is linear
+    int     s_flip;     // 1-(1-t)^p instead of t^p
+    int     s_n;        // length in samples
+    int     s_pos;      // samples done
+    int     s_chord;    // samples per chord
+    int     s_end;      // sample at the end of the current chord
+    float   s_value;    // value at 's_pos'
+    float   s_next;     // value at 's_end'
+    float   s_inc;      // increment per sample in the chord
+}t_segment;
+
+// the curve at 't' from 0 to 1
+float segment_shape(float t, float power, int flip);
+// a new segment from 'start' to 'target' in 'n' samples
+void segment_start(t_segment *s, float start, float target, int n, float power, int flip);
+// no segment, holding 'value'
+void segment_set(t_segment *s, float value);
+// writes up to 'n' samples until the segment is done, returns how many
+int segment_render(t_segment *s, t_float *out, int n);
+
+static inline int segment_done(t_segment *s){
+    return(s->s_pos >= s->s_n);
+}
+
+#endif
@@ -0,0 +1,148 @@
+// zero delay feedback (topology preserving transform) state variable filters
+// used by [svfilter~] and [crossover.lr~], any number of them can run side
+// by side in arrays
+
+// After "Solving the continuous SVF equations using trapezoidal integration
+// and equivalent currents" by Andrew Simper (Cytomic) and "The Art of VA
+// Filter Design" by Vadim Zavalishin
+
+#include <m_pd.h>
+#include <math.h>
+#include "svf.h"
+
+#define PI 3.14159265358979323846
+#define QUARTER_PI 0.78539816339744830962
+#define HALF_PI 1.57079632679489661923
+
+double svf_tan(double x){
+    int flip = x > QUARTER_PI; // tan(x) = 1/tan(PI/2 - x)
+    if(flip)
+        x = HALF_PI - x;
+    double x2 = x*x;
+    double t = x * (945 - x2*(105 - x2)) / (945 - x2*(420 - 15*x2));
+    return(flip ? 1/t : t);
+}
+
+void svf_init(t_svf *s, int n, double sr){
+    s->s_n = n < 1 ? 1 : n;
+    s->s_sr = sr;
+    s->s_drive = 0;
+    n = s->s_n;
+    s->s_k = (double *)getbytes(14 * n * sizeof(double));
+    double **p[] = {&s->s_a1, &s->s_a2, &s->s_a3, &s->s_kt, &s->s_a1t, &s->s_a2t,
+        &s->s_a3t, &s->s_dk, &s->s_da1, &s->s_da2, &s->s_da3, &s->s_ic1, &s->s_ic2};
+    for(int i = 0; i < 13; i++)
+        *p[i] = s->s_k + (i+1) * n;
+    for(int j = 0; j < n; j++)
+        svf_set(s, j, 0, 2, 1);
+}
+
+void svf_free(t_svf *s){
+    freebytes(s->s_k, 14 * s->s_n * sizeof(double));
+}
+
+void svf_clear(t_svf *s){
+    for(int j = 0; j < s->s_n; j++)
+        s->s_ic1[j] = s->s_ic2[j] = 0;
+}
+
+void svf_set(t_svf *s, int j, double freq, double k, int jump){
+    double nyq = s->s_sr * 0.5;
+    if(freq < 0)
+        freq = 0;
+    if(freq > nyq * 0.99)
+        freq = nyq * 0.99;
+    if(k < 0)
+        k = 0;
+    double g = svf_tan(PI * freq / s->s_sr);
+    double a1 = 1 / (1 + g*(g + k));
+    s->s_kt[j] = k;
+    s->s_a1t[j] = a1;
+    s->s_a2t[j] = g * a1;
+    s->s_a3t[j] = g * g * a1;
+    if(jump){
+        s->s_k[j] = k;
+        s->s_a1[j] = a1;
+        s->s_a2[j] = g * a1;
+        s->s_a3[j] = g * g * a1;
+    }
+}
+
+// stop gliding and flush denormals at the end of a block
+static void svf_land(t_svf *s, int j){
+    double *ic1 = s->s_ic1, *ic2 = s->s_ic2;
+    s->s_k[j] = s->s_kt[j], s->s_a1[j] = s->s_a1t[j];
+    s->s_a2[j] = s->s_a2t[j], s->s_a3[j] = s->s_a3t[j];
+    if(!(fabs(ic1[j]) < 1e20 && fabs(ic2[j]) < 1e20)) // blew up (or nan)
+        ic1[j] = ic2[j] = 0;
+    if(fabs(ic1[j]) < 1e-20)
+        ic1[j] = 0;
+    if(fabs(ic2[j]) < 1e-20)
+        ic2[j] = 0;
+}
+
+void svf_perform(t_svf *s, int nblock, t_float *in, double *lp, double *bp, double *hp){
+    int n = s->s_n;
+    double *k = s->s_k, *a1 = s->s_a1, *a2 = s->s_a2, *a3 = s->s_a3;
+    double *dk = s->s_dk, *da1 = s->s_da1, *da2 = s->s_da2, *da3 = s->s_da3;
+    double *ic1 = s->s_ic1, *ic2 = s->s_ic2, drive = s->s_drive;
+    double r = 1. / nblock;
+    for(int j = 0; j < n; j++){
+        dk[j] = (s->s_kt[j] - k[j]) * r;
+        da1[j] = (s->s_a1t[j] - a1[j]) * r;
+        da2[j] = (s->s_a2t[j] - a2[j]) * r;
+        da3[j] = (s->s_a3t[j] - a3[j]) * r;
+    }
+    for(int i = 0; i < nblock; i++){
+        double v0 = in[i];
+        double *l = lp + i*n, *b = bp + i*n, *h = hp + i*n;
+        for(int j = 0; j < n; j++){ // all filters at once, this vectorizes
+            k[j] += dk[j], a1[j] += da1[j], a2[j] += da2[j], a3[j] += da3[j];
+            double v3 = v0 - ic2[j];
+            double v1 = a1[j]*ic1[j] + a2[j]*v3;
+            double v2 = ic2[j] + a2[j]*ic1[j] + a3[j]*v3;
+            double c1 = 2*v1 - ic1[j];
+            ic1[j] = c1 - c1*c1*c1*drive;
+            ic2[j] = 2*v2 - ic2[j];
+            l[j] = v2;
+            b[j] = v1;
+            h[j] = v0 - k[j]*v1 - v2;
+        }
+    }
+    for(int j = 0; j < n; j++)
+        svf_land(s, j);
+}
+
+void svf_run(t_svf *s, int j, int nblock, double *in, double *out, double *out2, t_svf_out type){
+    double r = 1. / nblock;
+    double k = s->s_k[j], a1 = s->s_a1[j], a2 = s->s_a2[j], a3 = s->s_a3[j];
+    double dk = (s->s_kt[j] - k) * r, da1 = (s->s_a1t[j] - a1) * r;
+    double da2 = (s->s_a2t[j] - a2) * r, da3 = (s->s_a3t[j] - a3) * r;
+    double ic1 = s->s_ic1[j], ic2 = s->s_ic2[j], drive = s->s_drive;
+    for(int i = 0; i < nblock; i++){
+        k += dk, a1 += da1, a2 += da2, a3 += da3;
+        double v0 = in[i], v3 = v0 - ic2;
+        double v1 = a1*ic1 + a2*v3;
+        double v2 = ic2 + a2*ic1 + a3*v3;
+        double c1 = 2*v1 - ic1;
+        ic1 = c1 - c1*c1*c1*drive;
+        ic2 = 2*v2 - ic2;
+        switch(type){ // the same at every sample, the loop gets unswitched
+            case SVF_LOWPASS:
+                out[i] = v2;
+                break;
+            case SVF_HIGHPASS:
+                out[i] = v0 - k*v1 - v2;
+                break;
+            case SVF_ALLPASS:
+                out[i] = v0 - 2*k*v1;
+                break;
+            default:
+                out[i] = v2;
+                out2[i] = v0 - k*v1 - v2;
+        }
+    }
+    s->s_ic1[j] = ic1;
+    s->s_ic2[j] = ic2;
+    svf_land(s, j);
+}
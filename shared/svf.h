@@ -0,0 +1,43 @@
+// zero delay feedback (topology preserving transform) state variable filters
+// used by [svfilter~] and [crossover.lr~], any number of them can run side
+// by side in arrays
+
+#ifndef __SVF_H__
+#define __SVF_H__
+
+typedef enum _svf_out{
+    SVF_LOWPASS,
+    SVF_HIGHPASS,
+    SVF_ALLPASS,
+    SVF_SPLIT       // lowpass and highpass to two buffers
+}t_svf_out;
+
+typedef struct _svf{
+    int      s_n;
+    double   s_sr;
+    // coefficients at the start of the block, where they should be by its
+    // end and the per sample step, so parameter changes glide over a block
+    double  *s_k, *s_a1, *s_a2, *s_a3;
+    double  *s_kt, *s_a1t, *s_a2t, *s_a3t;
+    double  *s_dk, *s_da1, *s_da2, *s_da3;
+    double  *s_ic1, *s_ic2;  // integrator states
+    double   s_drive;        // soft saturation of the band state
+}t_svf;
+
+void svf_init(t_svf *s, int n, double sr);
+void svf_free(t_svf *s);
+void svf_clear(t_svf *s);
+// set filter 'j' to 'freq' in hz and damping 'k' (1/q), the change happens
+// over the next block (or at once if 'jump' is set)
+void svf_set(t_svf *s, int j, double freq, double k, int jump);
+// tan(x) for 0 <= x < PI/2, a pade approximant that is cheap enough for
+// coefficients of large banks at every block
+double svf_tan(double x);
+// filter 'in' with every filter, lowpass, bandpass and highpass outputs
+// are interleaved ('n' values per sample), notch is lowpass + highpass
+void svf_perform(t_svf *s, int nblock, t_float *in, double *lp, double *bp, double *hp);
+// run filter 'j' alone over a block with its state in registers, for filters
+// in series, 'out' can be 'in' ('out2' is the highpass of SVF_SPLIT)
+void svf_run(t_svf *s, int j, int nblock, double *in, double *out, double *out2, t_svf_out type);
+
+#endif
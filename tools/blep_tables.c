@@ -0,0 +1,145 @@
+// generates shared/blep_tables.h: the minimum phase band limited impulse and
+// step tables used by [bl.imp~], [bl.imp2~] and the table mode of the other
+// bl.* oscillators. This used to run at class setup (once per class), now the
+// tables are constant data and this only needs to be rerun if the sizes change.
+//
+// build & run (no Pd needed):
+//     cc -O2 -o blep_tables tools/blep_tables.c -lm
+//     ./blep_tables > shared/blep_tables.h
+
+#define _USE_MATH_DEFINES
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+// keep these in sync with shared/blep.h
+#define LLENGTH      6 // the loglength of a fractional delayed basic waveform
+#define LOVERSAMPLE  6 // the log of the oversampling factor (nb of fract delayed waveforms)
+#define LPAD         1 // the log of the time padding factor (to reduce time aliasing)
+#define LTABLE       (LLENGTH+LOVERSAMPLE)
+#define N            (1<<LTABLE)
+#define M            (1<<(LTABLE+LPAD))
+#define S            (1<<LOVERSAMPLE)
+#define L            (1<<LLENGTH)
+#define CUTOFF       0.8 // fraction of nyquist for impulse cutoff
+#define NBPERIODS    ((double)(L) * CUTOFF / 2.0)
+
+static double real[M];
+static double imag[M];
+static double bli[N];
+static double bls[N];
+static double delay; // centroid of the impulse, in samples
+
+// in place radix 2 complex fft, unitary scaling (as the 1/sqrt(n) scaled
+// mayer_fft/mayer_ifft pair the tables were originally built with)
+static void fft(double *re, double *im, int size, int inverse){
+    int i, j, k, len;
+    for(i = 1, j = 0; i < size; i++){
+        int bit = size >> 1;
+        for(; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if(i < j){
+            double t = re[i]; re[i] = re[j]; re[j] = t;
+            t = im[i]; im[i] = im[j]; im[j] = t;
+        }
+    }
+    for(len = 2; len <= size; len <<= 1){
+        double ang = 2.0 * M_PI / len * (inverse ? 1 : -1);
+        for(i = 0; i < size; i += len){
+            for(k = 0; k < len/2; k++){
+                double wr = cos(ang * k), wi = sin(ang * k);
+                double ur = re[i+k], ui = im[i+k];
+                double vr = re[i+k+len/2] * wr - im[i+k+len/2] * wi;
+                double vi = re[i+k+len/2] * wi + im[i+k+len/2] * wr;
+                re[i+k] = ur + vr, im[i+k] = ui + vi;
+                re[i+k+len/2] = ur - vr, im[i+k+len/2] = ui - vi;
+            }
+        }
+    }
+    double scale = 1.0 / sqrt((double)size);
+    for(i = 0; i < size; i++)
+        re[i] *= scale, im[i] *= scale;
+}
+
+// convert an integer index to a phase: [0 -> pi, -pi -> 0]
+static double i2theta(int i, int size){
+    double p = 2.0 * M_PI * (double)i / (double)size;
+    if(p >= M_PI)
+        p -= 2.0 * M_PI;
+    return(p);
+}
+
+// create a minimum phase bandlimited impulse and step
+static void build_tables(void){
+    double sum, scale;
+    int i;
+    // create windowed sinc
+    memset(imag, 0, sizeof(imag));
+    real[0] = 1.0;
+    for(i = 1; i < M; i++){
+        double tw = i2theta(i, M);
+        double ts = tw * NBPERIODS * (double)(M) / (double)(N);
+        real[i] = sin(ts)/ts; // sinc
+        real[i] *= 0.42 + 0.5 * (cos(tw)) + 0.08 * (cos(2.0*tw)); // blackman window
+    }
+    // compute cepstrum
+    fft(real, imag, M, 0);
+    for(i = 0; i < M; i++){ // complex log
+        double radius = sqrt(real[i]*real[i] + imag[i]*imag[i]);
+        double angle = atan2(imag[i], real[i]);
+        real[i] = log(radius);
+        imag[i] = angle;
+    }
+    fft(real, imag, M, 1);
+    // kill anti-causal part (contribution of non minimum phase zeros)
+    for(i = M/2 + 1; i < M; i++)
+        real[i] = imag[i] = 0.0;
+    // compute inverse cepstrum
+    fft(real, imag, M, 0);
+    for(i = 0; i < M; i++){ // complex exp
+        double r = exp(real[i]);
+        double angle = imag[i];
+        real[i] = r * cos(angle);
+        imag[i] = r * sin(angle);
+    }
+    fft(real, imag, M, 1);
+    // from here on, discard the padded part [N->M-1]
+    // and work with the first N samples, normalize impulse (integral = 1)
+    sum = 0.0;
+    for(i = 0; i < N; i++)
+        sum += real[i];
+    scale = 1.0 / sum;
+    delay = 0.0;
+    for(i = 0; i < N; i++){
+        real[i] *= scale;
+        bli[i] = (double)S * real[i];
+        delay += real[i] * (double)i / (double)S;
+    }
+    // integrate impulse and invert to produce a step function from 1->0
+    sum = 0.0;
+    for(i = 0; i < N; i++){
+        sum += real[i];
+        bls[i] = 1.0 - sum;
+    }
+}
+
+static void print_table(const char *name, const char *comment, double *table){
+    printf("// %s\nconst float %s[BLEP_N] = {\n", comment, name);
+    for(int i = 0; i < N; i++)
+        printf("%s%.9g%s", i % 6 ? " " : "    ", table[i],
+            i == N-1 ? "\n" : i % 6 == 5 ? ",\n" : ",");
+    printf("};\n");
+}
+
+int main(void){
+    build_tables();
+    printf("// generated by tools/blep_tables.c, do not edit\n\n");
+    print_table("blep_bli", "band limited impulse (scaled by BLEP_S)", bli);
+    printf("\n");
+    print_table("blep_bls", "band limited step (1 -> 0)", bls);
+    printf("\n// group delay of the tables at DC, in samples\n");
+    printf("const float blep_delay = %.9g;\n", delay);
+    return(0);
+}